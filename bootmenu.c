@@ -49,6 +49,37 @@ char* MENU_ITEMS[] = { stock_name, second_name, recovery_name, NULL };
 
 extern UIParameters ui_parameters;
 
+// Changes with anything that shows in the first frame: the config, the
+// theme's files and this binary.
+static unsigned snapshot_key = 5381;
+
+static void key_add(const void* data, size_t len) {
+	const unsigned char* p = data;
+	while (len--) snapshot_key = snapshot_key * 33 + *p++;
+}
+
+static void key_add_file(const char* path) {
+	struct stat st;
+	if (stat(path, &st) == 0) {
+		key_add(&st.st_size, sizeof(st.st_size));
+		key_add(&st.st_mtime, sizeof(st.st_mtime));
+	}
+}
+
+static void key_add_theme(const char* dir) {
+	char path[PATH_MAX];
+	struct dirent* de;
+	DIR* d = opendir(dir);
+	if (d == NULL) return;
+	while ((de = readdir(d)) != NULL) {
+		if (de->d_name[0] == '.') continue;
+		snprintf(path, sizeof(path), "%s/%s", dir, de->d_name);
+		key_add(de->d_name, strlen(de->d_name));
+		key_add_file(path);
+	}
+	closedir(d);
+}
+
 void configuration(const char* file, const char* prop) {
 	//default value
 	boot_default = 0;
@@ -73,6 +104,7 @@ void configuration(const char* file, const char* prop) {
 			static char buffer[2048];
 			while(fgets(buffer, sizeof(buffer), fp) != (char *)NULL) {
 				if(buffer[0] == '#') continue;
+				key_add(buffer, strlen(buffer));
 				if(sscanf(buffer, "%39[^=]=%39[^\n]", item, value) == 2) {
 					switch(item[0]) {
 						case 'b':
@@ -83,13 +115,20 @@ void configuration(const char* file, const char* prop) {
 								if(!strcmp(value, "stock")) boot_default = 0;
 								else if(!strcmp(value, "second")) boot_default = 1;
 								else if(!strcmp(value, "recovery")) boot_default = 2;
+								break;
 							}
+							if(!strcmp(item, "dither")) { res_set_dither(atoi(value)); break; }
+							break;
+						case 'f':
+							if(!strcmp(item, "frame_cache")) ui_set_frame_cache(atoi(value));
 							break;
 						case 'k':
 							if(!strcmp(item, "keypad_light")) keypad_light = atoi(value);
 							break;
 						case 'r':
-							if(!strcmp(item, "recovery_name")) strncpy(recovery_name, value, 32);
+							if(!strcmp(item, "recovery_name")) { strncpy(recovery_name, value, 32); break; }
+							if(!strcmp(item, "render_threads")) { gr_set_render_threads(atoi(value)); break; }
+							if(!strcmp(item, "rotation")) { gr_set_rotation(atoi(value)); break; }
 							break;
 						case 's':
 							if(!strcmp(item, "stock_adbd")) { stock_adbd = atoi(value); break; }
@@ -98,10 +137,13 @@ void configuration(const char* file, const char* prop) {
 							if(!strcmp(item, "second_adbd")) { second_adbd = atoi(value); break; }
 							if(!strcmp(item, "second_init")) { second_init = atoi(value); break; } 
 							if(!strcmp(item, "second_name")) { strncpy(second_name, value, 32); break; }
+							if(!strcmp(item, "stream")) { gr_set_stream(value); break; }
 							break;
 						case 't':
 							if(!strcmp(item, "timeout")) { wait_timeout = atoi(value); break; }
 							if(!strcmp(item, "theme")) { strncpy(theme, value, 39); break; }
+							if(!strcmp(item, "theme_width")) { res_set_theme_width(atoi(value)); break; }
+							if(!strcmp(item, "triple_buffer")) { gr_set_triple_buffer(atoi(value)); break; }
 							break;
 					}
 				}
@@ -111,6 +153,15 @@ void configuration(const char* file, const char* prop) {
 	}
 
 	sprintf(RES_LOC,"/preinstall/bootmenu/themes/%s/%%s.png",theme);
+
+	char theme_dir[80];
+	snprintf(theme_dir, sizeof(theme_dir), "/preinstall/bootmenu/themes/%s", theme);
+	char theme_pack[PATH_MAX];
+	snprintf(theme_pack, sizeof(theme_pack), "%s/theme.pack", theme_dir);
+	res_set_theme_pack(theme_pack);
+	key_add(theme_dir, strlen(theme_dir));
+	key_add_theme(theme_dir);
+	key_add_file("/proc/self/exe");
 	led("button-backlight", keypad_light);
 	amoled(brightness);
 }
@@ -266,7 +317,8 @@ int main(int argc, char** argv) {
 			return EXIT_SUCCESS;
 		}
 
-		//Start ui
+		//Start ui, over the saved first frame if there is one
+		ui_show_snapshot(SNAPSHOT_FILE, snapshot_key);
 		ui_init();
 		ui_set_background(BACKGROUND_ICON_INSTALLING);
 
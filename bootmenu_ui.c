@@ -20,8 +20,10 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <linux/input.h>
 #include <pthread.h>
+#include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -44,7 +46,6 @@ UIParameters ui_parameters = {
 
 static pthread_mutex_t gUpdateMutex = PTHREAD_MUTEX_INITIALIZER;
 static gr_surface gBackgroundIcon[NUM_BACKGROUND_ICONS];
-static gr_surface *gInstallationOverlay;
 static gr_surface gProgressBarEmpty;
 static gr_surface gProgressBarFill;
 
@@ -58,6 +59,77 @@ static const struct { gr_surface* surface; const char *name; } BITMAPS[] = {
 static int gCurrentIcon = 0;
 static int gInstallingFrame = 0;
 
+// The installation overlay frames are loaded when first drawn and kept
+// while they fit in gFrameCacheLimit bytes, counted at 4 bytes a pixel;
+// the least recently drawn go first.  A loader thread decodes the next
+// FRAME_PREFETCH frames ahead of the one shown, so the animation seldom
+// waits for one.  The frames shown and last shown are never evicted: the
+// display list still compares against the latter.  gFrameLock guards
+// the frames; it nests inside gUpdateMutex, which the loader never takes.
+#define FRAME_PREFETCH 2
+
+typedef struct {
+    gr_surface surface;     // NULL if not loaded
+    unsigned used;          // gFrameClock at the last draw
+    int loading;            // being decoded, by the loader or a draw
+    int missing;            // failed to load; not tried again
+} OverlayFrame;
+
+static pthread_mutex_t gFrameLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gFrameWanted = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t gFrameLoaded = PTHREAD_COND_INITIALIZER;
+static OverlayFrame *gOverlayFrames = NULL;
+static int gFrameShown = 0, gFramePrevious = 0;
+static unsigned gFrameClock = 0;
+static size_t gFrameCacheBytes = 0;
+static size_t gFrameCacheLimit = 4 * 1024 * 1024;
+static size_t gFrameSize = 0;       // of the last frame loaded
+static pthread_t gFrameLoader;
+static int gFrameLoaderRunning = 0;
+static int gFrameLoaderStop = 0;
+
+// The screen is drawn as layers, bottom to top: the background icon, the
+// installation animation and progress bar, the dim behind the log or
+// menu, the log or menu, and the auto-boot countdown.  The background,
+// plain or dimmed, only changes with the icon or the text mode, so it is
+// drawn once into an offscreen surface and copied from there.
+typedef struct {
+    gr_surface surface;
+    int key;            // the state it was drawn for; -1 if none
+} UILayer;
+
+static UILayer gBackgroundLayer = { NULL, -1 };
+static UILayer gDimmedLayer = { NULL, -1 };
+
+// Menu buttons are drawn once per label, size and state into a sprite,
+// and then blitted as one opaque copy.  The least recently used sprite
+// is redrawn for a button that has none; a screen has fewer buttons than
+// MAX_ROWS, so none of its own sprites is taken while it is drawn.
+#define BUTTON_SPRITES MAX_ROWS
+
+typedef struct {
+    gr_surface surface;
+    char label[MAX_COLS];
+    int width, height, selected;
+    int tx, ty;         // where the label starts
+    unsigned used;      // gButtonClock at the last use; 0 if free
+} ButtonSprite;
+
+static ButtonSprite gButtonSprites[BUTTON_SPRITES];
+static unsigned gButtonClock = 0;
+
+// Where the first frame is saved for the next boot, and whether it is
+// already there; see ui_show_snapshot().
+static const char *gSnapshotPath = NULL;
+static unsigned gSnapshotKey = 0;
+static int gSnapshotSaved = 0;
+
+// Screenshots: power + volume down or SIGUSR1 takes one, and SIGUSR2
+// starts or stops taking one of every frame the progress thread draws.
+static volatile sig_atomic_t gScreenshotWanted = 0;
+static volatile sig_atomic_t gScreenshotBurst = 0;
+static int gScreenshotIndex = 0;
+
 static enum ProgressBarType {
     PROGRESSBAR_TYPE_NONE,
     PROGRESSBAR_TYPE_NORMAL,
@@ -67,9 +139,6 @@ static enum ProgressBarType {
 static float gProgressScopeStart = 0, gProgressScopeSize = 0, gProgress = 0;
 static double gProgressScopeTime, gProgressScopeDuration;
 
-// Set to 1 when both graphics pages are the same (except for the progress bar)
-static int gPagesIdentical = 0;
-
 // Log text overlay, displayed when a magic key is pressed
 static char text[MAX_ROWS][MAX_COLS];
 static int text_cols = 0, text_rows = 0;
@@ -94,14 +163,151 @@ static double now() {
     return tv.tv_sec + tv.tv_usec / 1000000.0;
 }
 
+void ui_set_frame_cache(int kb)
+{
+    if (kb < 0) kb = 0;
+    gFrameCacheLimit = (size_t) kb * 1024;
+}
+
+static size_t frame_bytes(gr_surface surface)
+{
+    return (size_t) gr_get_width(surface) * gr_get_height(surface) * 4;
+}
+
+static int load_overlay_frame(int frame, gr_surface *surface)
+{
+    char filename[40];
+    // "icon_installing_overlay01.png",
+    // "icon_installing_overlay02.png", ...
+    sprintf(filename, "icon_installing_overlay%02d", frame+1);
+    int result = res_create_surface(filename, surface);
+    if (result < 0) {
+        LOGE("Missing bitmap %s\n(Code %d)\n", filename, result);
+    }
+    return result;
+}
+
+// Frees the least recently drawn frames that are neither shown, last
+// shown nor about to be until need more bytes fit.  Returns whether they
+// do.  Should only be called with gFrameLock locked.
+static int make_frame_room_locked(size_t need)
+{
+    int n = ui_parameters.installing_frames;
+    while (gFrameCacheBytes + need > gFrameCacheLimit) {
+        int i, victim = -1;
+        for (i = 0; i < n; ++i) {
+            int ahead = (i - gFrameShown + n) % n;
+            if (gOverlayFrames[i].surface == NULL || ahead <= FRAME_PREFETCH ||
+                i == gFramePrevious) continue;
+            if (victim < 0 || gOverlayFrames[i].used < gOverlayFrames[victim].used)
+                victim = i;
+        }
+        if (victim < 0) return 0;
+        gFrameCacheBytes -= frame_bytes(gOverlayFrames[victim].surface);
+        res_free_surface(gOverlayFrames[victim].surface);
+        gOverlayFrames[victim].surface = NULL;
+    }
+    return 1;
+}
+
+// Files a frame that has finished loading, making room for it; frames
+// that must stay may keep the cache over its limit.
+// Should only be called with gFrameLock locked.
+static void store_frame_locked(int frame, gr_surface surface, int result)
+{
+    OverlayFrame *f = &gOverlayFrames[frame];
+
+    f->loading = 0;
+    if (result < 0) {
+        f->missing = 1;
+    } else {
+        gFrameSize = frame_bytes(surface);
+        make_frame_room_locked(gFrameSize);
+        f->surface = surface;
+        f->used = gFrameClock;
+        gFrameCacheBytes += gFrameSize;
+    }
+    pthread_cond_broadcast(&gFrameLoaded);
+}
+
+// Decodes the frames just ahead of the one shown, as long as they fit.
+static void *frame_loader_thread(void *cookie)
+{
+    int n = ui_parameters.installing_frames;
+
+    pthread_mutex_lock(&gFrameLock);
+    while (!gFrameLoaderStop) {
+        int i, frame = -1;
+        for (i = 1; i <= FRAME_PREFETCH && i < n; ++i) {
+            OverlayFrame *f = &gOverlayFrames[(gFrameShown + i) % n];
+            if (f->surface == NULL && !f->loading && !f->missing) {
+                frame = (gFrameShown + i) % n;
+                break;
+            }
+        }
+        if (frame < 0 || !make_frame_room_locked(gFrameSize)) {
+            pthread_cond_wait(&gFrameWanted, &gFrameLock);
+            continue;
+        }
+
+        gOverlayFrames[frame].loading = 1;
+        pthread_mutex_unlock(&gFrameLock);
+        gr_surface surface = NULL;
+        int result = load_overlay_frame(frame, &surface);
+        pthread_mutex_lock(&gFrameLock);
+        store_frame_locked(frame, surface, result);
+    }
+    pthread_mutex_unlock(&gFrameLock);
+    return NULL;
+}
+
+// Whether the frame can be drawn without waiting for the loader.
+static int overlay_frame_ready(int frame)
+{
+    pthread_mutex_lock(&gFrameLock);
+    int ready = !gOverlayFrames[frame].loading;
+    pthread_mutex_unlock(&gFrameLock);
+    return ready;
+}
+
+// Returns the surface of the given overlay frame, loading it now if the
+// loader has not, or NULL if it is missing.  It stays loaded until
+// another frame is shown.
+// Should only be called with gUpdateMutex locked.
+static gr_surface overlay_frame_locked(int frame)
+{
+    OverlayFrame *f = &gOverlayFrames[frame];
+
+    pthread_mutex_lock(&gFrameLock);
+    if (frame != gFrameShown) {
+        gFramePrevious = gFrameShown;
+        gFrameShown = frame;
+        pthread_cond_signal(&gFrameWanted);
+    }
+    while (f->loading) pthread_cond_wait(&gFrameLoaded, &gFrameLock);
+    if (f->surface == NULL && !f->missing) {
+        f->loading = 1;
+        pthread_mutex_unlock(&gFrameLock);
+        gr_surface surface = NULL;
+        int result = load_overlay_frame(frame, &surface);
+        pthread_mutex_lock(&gFrameLock);
+        store_frame_locked(frame, surface, result);
+    }
+    f->used = ++gFrameClock;
+    gr_surface surface = f->surface;
+    pthread_mutex_unlock(&gFrameLock);
+    return surface;
+}
+
 // Draw the given frame over the installation overlay animation.  The
 // background is not cleared or draw with the base icon first; we
 // assume that the frame already contains some other frame of the
 // animation.  Does nothing if no overlay animation is defined.
 // Should only be called with gUpdateMutex locked.
 static void draw_install_overlay_locked(int frame) {
-    if (gInstallationOverlay == NULL) return;
-    gr_surface surface = gInstallationOverlay[frame];
+    if (gOverlayFrames == NULL) return;
+    gr_surface surface = overlay_frame_locked(frame);
+    if (surface == NULL) return;
     int iconWidth = gr_get_width(surface);
     int iconHeight = gr_get_height(surface);
     gr_blit(surface, 0, 0, iconWidth, iconHeight,
@@ -113,7 +319,6 @@ static void draw_install_overlay_locked(int frame) {
 // Should only be called with gUpdateMutex locked.
 static void draw_background_locked(int icon)
 {
-    gPagesIdentical = 0;
     gr_color(0, 0, 0, 255);
     gr_fill(0, 0, gr_fb_width(), gr_fb_height());
 
@@ -124,18 +329,105 @@ static void draw_background_locked(int icon)
         int iconX = (gr_fb_width() - iconWidth) / 2;
         int iconY = (gr_fb_height() - iconHeight) / 2;
         gr_blit(surface, 0, 0, iconWidth, iconHeight, iconX, iconY);
-        if (icon == BACKGROUND_ICON_INSTALLING) {
-            draw_install_overlay_locked(gInstallingFrame);
-        }
     }
 }
 
-// Draw the progress bar (if any) on the screen.  Does not flip pages.
+// Fills the part of (x0, y0)-(x1, y1) that lies in the given band of
+// rows with the current color.
+static void fill_rows(int x0, int y0, int x1, int y1, int top, int bottom)
+{
+    if (y0 < top) y0 = top;
+    if (y1 > bottom) y1 = bottom;
+    if (y0 < y1) gr_fill(x0, y0, x1, y1);
+}
+
+// Darkens (x0, y0)-(x1, y1) behind the log or menu: the top of the
+// screen, where the tap hint was, is cleared, and so is the area behind
+// the menu.  Should only be called with gUpdateMutex locked.
+static void draw_dim_locked(int x0, int y0, int x1, int y1)
+{
+    gr_color(0, 0, 0, 255);
+    fill_rows(x0, y0, x1, y1, 0, 300);
+    gr_dim(x0, y0, x1, y1, 160);
+    if (show_menu) fill_rows(x0, y0, x1, y1, 300, 700);
+}
+
+static void draw_background_layer_locked(void)
+{
+    draw_background_locked(gCurrentIcon);
+}
+
+static void draw_dimmed_layer_locked(void)
+{
+    draw_background_locked(gCurrentIcon);
+    draw_dim_locked(0, 0, gr_fb_width(), gr_fb_height());
+}
+
+// Returns the surface of layer, first drawn with draw() if it was last
+// drawn for another key; NULL if there is no memory for it.
+// Should only be called with gUpdateMutex locked.
+static gr_surface layer_get_locked(UILayer *layer, int key, void (*draw)(void))
+{
+    if (layer->surface == NULL) {
+        layer->surface = gr_create_surface(gr_fb_width(), gr_fb_height());
+        if (layer->surface == NULL) return NULL;
+    }
+    if (layer->key != key) {
+        gr_draw_to(layer->surface);
+        draw();
+        gr_draw_to(NULL);
+        layer->key = key;
+    }
+    return layer->surface;
+}
+
+// Draws the background, dimmed while text is shown, as one copy.
+// Should only be called with gUpdateMutex locked.
+static void draw_backdrop_locked(void)
+{
+    gr_surface surface;
+
+    if (show_text) {
+        surface = layer_get_locked(&gDimmedLayer, gCurrentIcon | show_menu << 8,
+                                   draw_dimmed_layer_locked);
+        if (surface == NULL) draw_dimmed_layer_locked();
+    } else {
+        surface = layer_get_locked(&gBackgroundLayer, gCurrentIcon,
+                                   draw_background_layer_locked);
+        if (surface == NULL) draw_background_layer_locked();
+    }
+    if (surface != NULL) {
+        gr_blit(surface, 0, 0, gr_fb_width(), gr_fb_height(), 0, 0);
+    }
+}
+
+// Puts the plain background back under (x, y, w, h), for what is drawn
+// there before the dim.
+// Should only be called with gUpdateMutex locked.
+static void draw_undimmed_locked(int x, int y, int w, int h)
+{
+    gr_surface surface = layer_get_locked(&gBackgroundLayer, gCurrentIcon,
+                                          draw_background_layer_locked);
+    if (surface != NULL) gr_blit(surface, x, y, w, h, x, y);
+}
+
+// Draw the installation animation and the progress bar (if any) on the
+// screen, dimmed along with the background while text is shown.  Does
+// not flip pages.
 // Should only be called with gUpdateMutex locked.
 static void draw_progress_locked()
 {
-    if (gCurrentIcon == BACKGROUND_ICON_INSTALLING) {
+    gr_surface surface = NULL;
+    if (gCurrentIcon == BACKGROUND_ICON_INSTALLING && gOverlayFrames != NULL)
+        surface = overlay_frame_locked(gInstallingFrame);
+    if (surface != NULL) {
+        int x = ui_parameters.install_overlay_offset_x;
+        int y = ui_parameters.install_overlay_offset_y;
+        int w = gr_get_width(surface), h = gr_get_height(surface);
+
+        if (show_text) draw_undimmed_locked(x, y, w, h);
         draw_install_overlay_locked(gInstallingFrame);
+        if (show_text) draw_dim_locked(x, y, x + w, y + h);
     }
 
     if (gProgressBarType != PROGRESSBAR_TYPE_NONE) {
@@ -146,9 +438,7 @@ static void draw_progress_locked()
         int dx = (gr_fb_width() - width)/2;
         int dy = (3*gr_fb_height() + iconHeight - 2*height)/4;
 
-        // Erase behind the progress bar (in case this was a progress-only update)
-        gr_color(0, 0, 0, 255);
-        gr_fill(dx, dy, width, height);
+        if (show_text) draw_undimmed_locked(dx, dy, width, height);
 
         if (gProgressBarType == PROGRESSBAR_TYPE_NORMAL) {
             float progress = gProgressScopeStart + gProgress * gProgressScopeSize;
@@ -161,6 +451,8 @@ static void draw_progress_locked()
                 gr_blit(gProgressBarEmpty, pos, 0, width-pos, height, dx+pos, dy);
             }
         }
+
+        if (show_text) draw_dim_locked(dx, dy, dx + width, dy + height);
     }
 }
 
@@ -179,6 +471,113 @@ static void draw_text_line(int row, const char* t, int space) {
 #define GREY2 85, 85, 85, 255
 #define GREY3 70, 70, 70, 255
 
+// Draws a menu button with its outside corners at (x0, y0) and (x1, y1),
+// and its label starting at (tx, ty).
+static void draw_button(const char *label, int selected, int x0, int y0,
+                        int x1, int y1, int tx, int ty)
+{
+	//button color
+	if (selected) { gr_color(WHITE); }
+	else { gr_color(GREY3); }
+	gr_fill(x0, y0, x1, y1);
+
+	gr_color(GREY2);
+	gr_fill(x0+1, y0+1, x1-1, y1-1);
+
+	if (selected) { gr_color(GREEN); }
+	else { gr_color(GREY); }
+	gr_fill(x0+3, y0+3, x1-3, y1-3);
+
+	//button text
+	if (selected) { gr_color(BLACK); }
+	else { gr_color(WHITE); }
+	gr_text(tx, ty, label);
+}
+
+// Returns the sprite of a width x height button with its label at
+// (tx, ty) inside it, drawn now if there is none yet; NULL if there is
+// no memory for it.
+// Should only be called with gUpdateMutex locked.
+static gr_surface button_sprite_locked(const char *label, int selected,
+                                       int width, int height, int tx, int ty)
+{
+    ButtonSprite *sprite = NULL;
+    int i;
+
+    if (++gButtonClock == 0) {
+        // the clock wrapped: keep the sprites, forget their order
+        for (i = 0; i < BUTTON_SPRITES; i++) {
+            if (gButtonSprites[i].used) gButtonSprites[i].used = 1;
+        }
+        gButtonClock = 2;
+    }
+
+    for (i = 0; i < BUTTON_SPRITES; i++) {
+        ButtonSprite *s = &gButtonSprites[i];
+        if (s->used && s->selected == selected && s->width == width &&
+            s->height == height && s->tx == tx && s->ty == ty &&
+            !strcmp(s->label, label)) {
+            s->used = gButtonClock;
+            return s->surface;
+        }
+        if (sprite == NULL || s->used < sprite->used) sprite = s;
+    }
+
+    if (sprite->surface != NULL && (sprite->width != width ||
+                                    sprite->height != height)) {
+        res_free_surface(sprite->surface);
+        sprite->surface = NULL;
+    }
+    sprite->used = 0;
+    if (sprite->surface == NULL) {
+        sprite->surface = gr_create_surface(width, height);
+        if (sprite->surface == NULL) return NULL;
+    }
+
+    gr_draw_to(sprite->surface);
+    draw_button(label, selected, 0, 0, width, height, tx, ty);
+    gr_draw_to(NULL);
+
+    strncpy(sprite->label, label, sizeof(sprite->label) - 1);
+    sprite->label[sizeof(sprite->label) - 1] = '\0';
+    sprite->width = width;
+    sprite->height = height;
+    sprite->tx = tx;
+    sprite->ty = ty;
+    sprite->selected = selected;
+    sprite->used = gButtonClock;
+    return sprite->surface;
+}
+
+// Draws a menu button like draw_button(), from a sprite when every
+// character of the label lies within the button.
+// Should only be called with gUpdateMutex locked.
+static void draw_button_locked(const char *label, int selected, int x0,
+                               int y0, int x1, int y1, int tx, int ty)
+{
+    char ink[MAX_COLS];
+    int lead = strspn(label, " ");
+    int end = strlen(label);
+    gr_surface sprite = NULL;
+
+    while (end > lead && label[end - 1] == ' ') end--;
+    if (end - lead < (int) sizeof(ink)) {
+        memcpy(ink, label + lead, end - lead);
+        ink[end - lead] = '\0';
+        if (tx + lead * CHAR_WIDTH >= x0 &&
+            tx + lead * CHAR_WIDTH + gr_measure(ink) <= x1 &&
+            ty - CHAR_HEIGHT >= y0 && ty + CHAR_HEIGHT <= y1) {
+            sprite = button_sprite_locked(label, selected, x1 - x0, y1 - y0,
+                                          tx - x0, ty - y0);
+        }
+    }
+    if (sprite == NULL) {
+        draw_button(label, selected, x0, y0, x1, y1, tx, ty);
+        return;
+    }
+    gr_blit(sprite, 0, 0, x1 - x0, y1 - y0, x0, y0);
+}
+
 // Redraw everything on the screen.  Does not flip pages.
 // Should only be called with gUpdateMutex locked.
 static void draw_screen_locked(void)
@@ -187,28 +586,12 @@ static void draw_screen_locked(void)
 	int startx, endx;
 	char autoboot[MAX_COLS];
 	int fbwidth = gr_fb_width();
-    draw_background_locked(gCurrentIcon);
+    draw_backdrop_locked();
     draw_progress_locked();
-	
-	
-	sprintf(autoboot, "         auto-boot in %ds..", wait_timeout);
-	gr_color(YELLOW);
-	draw_text_line(34, autoboot,CHAR_HEIGHT);
 
     if (show_text) {
-		//clean until 300px (clean tap text)
-		gr_color(BLACK);
-		gr_fill(0, 0, fbwidth, 300);
-		//set all as transparent
-        gr_color(0, 0, 0, 160);
-        gr_fill(0, 0, fbwidth, gr_fb_height());
-
         int i = 0;
         if (show_menu) {
-			//full clean until 700px (clean backgroud)
-			gr_color(BLACK);
-			gr_fill(0, 300, fbwidth, 700);
-			
 			gr_color(GREEN);	
  			draw_text_line(5, " Please choose your boot preference", CHAR_HEIGHT);
 			gr_color(GREY3);	
@@ -224,24 +607,11 @@ static void draw_screen_locked(void)
 					continue;
                 }
 
-				//button color
 				starty = (i*CHAR_SPACE)+(CHAR_SPACE/2)+1;
 				endy = ((i+1)*CHAR_SPACE)+(CHAR_SPACE/2)-CHAR_HEIGHT-1;
-				if (i == menu_top+menu_sel) { gr_color(WHITE); }
-				else { gr_color(GREY3); }
-				gr_fill(startx-3, starty-3, endx+3, endy+3);
-
-				gr_color(GREY2);
-				gr_fill(startx-2, starty-2, endx+2, endy+2);
-
-				if (i == menu_top+menu_sel) { gr_color(GREEN); }
-				else { gr_color(GREY); }
-				gr_fill(startx, starty, endx, endy);
-
-				//button text
-				if (i == menu_top+menu_sel) { gr_color(BLACK); }
-				else { gr_color(WHITE); } 
-				draw_text_line(i, menu[i],CHAR_SPACE);
+				draw_button_locked(menu[i], i == menu_top+menu_sel,
+				                   startx-3, starty-3, endx+3, endy+3,
+				                   0, (i+1)*CHAR_SPACE);
             }
         } else { //show log
 	        gr_color(WHITE);
@@ -253,27 +623,55 @@ static void draw_screen_locked(void)
 		gr_color(YELLOW);
 		draw_text_line(2, TAP_BEGIN,CHAR_SPACE2);
 	}
+
+	sprintf(autoboot, "         auto-boot in %ds..", wait_timeout);
+	gr_color(YELLOW);
+	draw_text_line(34, autoboot,CHAR_HEIGHT);
 }
 
 // Redraw everything on the screen and flip the screen (make it visible).
+// The screen is recorded as a display list, so only what changed since
+// the last update is actually drawn.
 // Should only be called with gUpdateMutex locked.
 static void update_screen_locked(void)
 {
+    gr_list_begin();
     draw_screen_locked();
+    gr_list_end();
     gr_flip();
 }
 
-// Updates only the progress bar, if possible, otherwise redraws the screen.
+// Updates the progress bar; the display list limits the redraw to it.
 // Should only be called with gUpdateMutex locked.
 static void update_progress_locked(void)
 {
-    if (show_text || !gPagesIdentical) {
-        draw_screen_locked();    // Must redraw the whole screen
-        gPagesIdentical = 1;
-    } else {
-        draw_progress_locked();  // Draw only the progress bar and overlays
+    update_screen_locked();
+}
+
+// Queues the frame on screen to be saved under the next free name; the
+// PNG is written by minui in the background.
+// Should only be called with gUpdateMutex locked.
+static int take_screenshot_locked(void)
+{
+    char path[PATH_MAX];
+    struct stat st;
+
+    mkdir(SCREENSHOT_DIR, 0755);
+    do {
+        snprintf(path, sizeof(path), SCREENSHOT_DIR "/screen%04d.png",
+                 gScreenshotIndex++);
+    } while (stat(path, &st) == 0);
+    if (gr_screenshot(path) < 0) {
+        gScreenshotIndex--;
+        return -1;
     }
-    gr_flip();
+    return 0;
+}
+
+static void screenshot_signal(int sig)
+{
+    if (sig == SIGUSR1) gScreenshotWanted = 1;
+    else gScreenshotBurst = !gScreenshotBurst;
 }
 
 // Keeps the progress bar updated, even when the process is otherwise busy.
@@ -288,12 +686,15 @@ static void *progress_thread(void *cookie)
 
         // update the installation animation, if active
         // skip this if we have a text overlay (too expensive to update)
+        // hold the frame rather than wait while the next one is loading
         if (gCurrentIcon == BACKGROUND_ICON_INSTALLING &&
             ui_parameters.installing_frames > 0 &&
             !show_text) {
-            gInstallingFrame =
-                (gInstallingFrame + 1) % ui_parameters.installing_frames;
-            redraw = 1;
+            int next = (gInstallingFrame + 1) % ui_parameters.installing_frames;
+            if (overlay_frame_ready(next)) {
+                gInstallingFrame = next;
+                redraw = 1;
+            }
         }
 
         // move the progress bar forward on timed intervals, if configured
@@ -310,6 +711,14 @@ static void *progress_thread(void *cookie)
 
         if (redraw) update_progress_locked();
 
+        // a burst skips frames while the encoder catches up
+        if (gScreenshotWanted || (gScreenshotBurst && redraw)) {
+            if (take_screenshot_locked() < 0 && gScreenshotWanted) {
+                LOGW("Screenshot skipped, still saving the last ones\n");
+            }
+            gScreenshotWanted = 0;
+        }
+
         pthread_mutex_unlock(&gUpdateMutex);
         double end = now();
         // minimum of 20ms delay between frames
@@ -403,10 +812,13 @@ static int input_callback(int fd, short revents, void *data)
     }
 
 	if (fake_key) {
+		//the panel reports touches in its own orientation
+		int tx = touch_x, ty = touch_y;
+		gr_fb_map_point(&tx, &ty);
 		touch_n = now();
 		//printf("touch time %f\n",touch_n);
 		if (ev.code != KEY_BACK) {
-			if ((touch_y < 190) || (touch_y > 610)) {				
+			if ((ty < 190) || (ty > 610)) {				
 				ev.code = KEY_RESERVED;
 				if (touch_n - touch_o > 1) {
 					//printf("dummy key %f\n",touch_n - touch_o);
@@ -416,16 +828,16 @@ static int input_callback(int fd, short revents, void *data)
 					//printf("touch outside button area\n");
 				}
 			}
-			else if ((touch_y > 200) && (touch_y < 300)) { selected = ui_menu_select(0); }
-			else if ((touch_y > 350) && (touch_y < 450)) { selected = ui_menu_select(1); }
-			else if ((touch_y > 500) && (touch_y < 600)) { selected = ui_menu_select(2); }
+			else if ((ty > 200) && (ty < 300)) { selected = ui_menu_select(0); }
+			else if ((ty > 350) && (ty < 450)) { selected = ui_menu_select(1); }
+			else if ((ty > 500) && (ty < 600)) { selected = ui_menu_select(2); }
 		}
 		if ((ev.code != KEY_RESERVED) && (touch_n - touch_b > 0.2)) {
 			//printf("end & back key  %f\n",touch_n - touch_b);
 			touch_b = now();
 			vibrate(20);
 			if (ev.code != KEY_BACK) {
-				//printf("Button touched! : %d y : %d p : %d\n", touch_x, touch_y, selected);
+				//printf("Button touched! : %d y : %d p : %d\n", tx, ty, selected);
 				if (selected == last_sel) {
 					ev.type = EV_KEY;
 		           	ev.code = KEY_END;
@@ -461,6 +873,13 @@ static int input_callback(int fd, short revents, void *data)
         pthread_mutex_unlock(&gUpdateMutex);
     }
 
+    // power + volume down, as on Android
+    if (ev.value > 0 && !fake_key &&
+        ((ev.code == KEY_VOLUMEDOWN && key_pressed[KEY_POWER]) ||
+         (ev.code == KEY_POWER && key_pressed[KEY_VOLUMEDOWN]))) {
+        gScreenshotWanted = 1;
+    }
+
     if (ev.value > 0 && device_reboot_now(key_pressed, ev.code)) {
         android_reboot(ANDROID_RB_RESTART, 0, 0);
     }
@@ -480,15 +899,54 @@ static void *input_thread(void *cookie)
 
 void ui_exit(void) {
 	int i=0;
+	res_free_surface(gBackgroundLayer.surface);
+	res_free_surface(gDimmedLayer.surface);
 	for (;i<NUM_BACKGROUND_ICONS;i++) {
-		free(gBackgroundIcon[i]);
+		res_free_surface(gBackgroundIcon[i]);
+	}
+	for (i=0;i<BUTTON_SPRITES;i++) {
+		res_free_surface(gButtonSprites[i].surface);
+	}
+	res_free_surface(gProgressBarEmpty);
+	res_free_surface(gProgressBarFill);
+	if (gFrameLoaderRunning) {
+		pthread_mutex_lock(&gFrameLock);
+		gFrameLoaderStop = 1;
+		pthread_cond_signal(&gFrameWanted);
+		pthread_mutex_unlock(&gFrameLock);
+		pthread_join(gFrameLoader, NULL);
+		gFrameLoaderRunning = 0;
+	}
+	if (gOverlayFrames != NULL) {
+		for (i=0;i<ui_parameters.installing_frames;i++) {
+			res_free_surface(gOverlayFrames[i].surface);
+		}
 	}
-	free(gProgressBarEmpty);
-	free(gProgressBarFill);
-	free(gInstallationOverlay);
+	free(gOverlayFrames);
 	gr_exit();
 }
 
+void ui_show_snapshot(const char *path, unsigned key)
+{
+    gSnapshotPath = path;
+    gSnapshotKey = key;
+    gSnapshotSaved = (gr_snapshot_show(path, key) == 0);
+}
+
+// Saves the frame on screen once, if the one shown at boot was not it.
+static void save_snapshot(void)
+{
+    pthread_mutex_lock(&gUpdateMutex);
+    if (gSnapshotPath != NULL && !gSnapshotSaved) {
+        mkdir(CACHE_DIR, 0755);
+        if (gr_snapshot_save(gSnapshotPath, gSnapshotKey) < 0) {
+            LOGW("Cannot save first frame to %s\n", gSnapshotPath);
+        }
+        gSnapshotSaved = 1;
+    }
+    pthread_mutex_unlock(&gUpdateMutex);
+}
+
 void ui_init(void)
 {
     gr_init();
@@ -502,29 +960,59 @@ void ui_init(void)
     text_cols = gr_fb_width() / CHAR_WIDTH;
     if (text_cols > MAX_COLS - 1) text_cols = MAX_COLS - 1;
 
+    // decoded images are kept next to the first frame
+    res_set_cache_dir(CACHE_DIR);
+
+    // The images are decoded in one batch, spread over the CPUs: BITMAPS,
+    // then the first installation overlay frame; the loader thread
+    // fetches the others as the animation needs them.
+    int frames = ui_parameters.installing_frames > 0 ?
+            ui_parameters.installing_frames : 0;
+    int bitmaps = 0;
+    while (BITMAPS[bitmaps].name != NULL) ++bitmaps;
+    int count = bitmaps + (frames > 0);
+    const char **names = malloc(count * sizeof(*names));
+    gr_surface *surfaces = malloc(count * sizeof(*surfaces));
+    int *results = malloc(count * sizeof(*results));
+
     int i;
-    for (i = 0; BITMAPS[i].name != NULL; ++i) {
-        int result = res_create_surface(BITMAPS[i].name, BITMAPS[i].surface);
-        if (result < 0) {
-            LOGE("Missing bitmap %s\n(Code %d)\n", BITMAPS[i].name, result);
+    for (i = 0; i < bitmaps; ++i) {
+        names[i] = BITMAPS[i].name;
+    }
+    if (frames > 0) names[bitmaps] = "icon_installing_overlay01";
+    res_create_surfaces(names, surfaces, results, count);
+
+    for (i = 0; i < count; ++i) {
+        if (results[i] < 0) {
+            LOGE("Missing bitmap %s\n(Code %d)\n", names[i], results[i]);
+        }
+        if (i < bitmaps) {
+            *BITMAPS[i].surface = surfaces[i];
         }
     }
 
-    if (ui_parameters.installing_frames > 0) {
-        gInstallationOverlay = malloc(ui_parameters.installing_frames * sizeof(gr_surface));
-        for (i = 0; i < ui_parameters.installing_frames; ++i) {
-            char filename[40];
-            // "icon_installing_overlay01.png",
-            // "icon_installing_overlay02.png", ...
-            sprintf(filename, "icon_installing_overlay%02d", i+1);
-            int result = res_create_surface(filename, gInstallationOverlay+i);
-            if (result < 0) {
-                LOGE("Missing bitmap %s\n(Code %d)\n", filename, result);
-            }
+    if (frames > 0) {
+        gOverlayFrames = calloc(frames, sizeof(*gOverlayFrames));
+        pthread_mutex_lock(&gFrameLock);
+        store_frame_locked(0, surfaces[bitmaps], results[bitmaps]);
+        pthread_mutex_unlock(&gFrameLock);
+        if (frames > 1) {
+            gFrameLoaderStop = 0;
+            gFrameLoaderRunning = (pthread_create(&gFrameLoader, NULL,
+                                                  frame_loader_thread, NULL) == 0);
         }
+    }
+    free(names);
+    free(surfaces);
+    free(results);
 
+    if (frames > 0) {
         // Adjust the offset to account for the positioning of the
         // base image on the screen.
+        ui_parameters.install_overlay_offset_x =
+            res_scaled(ui_parameters.install_overlay_offset_x);
+        ui_parameters.install_overlay_offset_y =
+            res_scaled(ui_parameters.install_overlay_offset_y);
         if (gBackgroundIcon[BACKGROUND_ICON_INSTALLING] != NULL) {
             gr_surface bg = gBackgroundIcon[BACKGROUND_ICON_INSTALLING];
             ui_parameters.install_overlay_offset_x +=
@@ -532,10 +1020,11 @@ void ui_init(void)
             ui_parameters.install_overlay_offset_y +=
                 (gr_fb_height() - gr_get_height(bg)) / 2;
         }
-    } else {
-        gInstallationOverlay = NULL;
     }
 
+    signal(SIGUSR1, screenshot_signal);
+    signal(SIGUSR2, screenshot_signal);
+
     pthread_t t;
     pthread_create(&t, NULL, progress_thread, NULL);
     pthread_create(&t, NULL, input_thread, NULL);
@@ -630,9 +1119,19 @@ void ui_start_menu(char** headers, char** items, int initial_selection) {
         for (; i < text_rows; ++i) {
             if (items[i-menu_top] == NULL) break;
 			strcpy(menu[i], "                                    ");
-			len = text_cols/2 - strlen(items[i-menu_top])/2;
-            strncpy(menu[i]+len, items[i-menu_top], text_cols-1-len);
-            menu[i][text_cols-1] = '\0';
+			// names may be UTF-8: center and clip on columns, not bytes
+			len = text_cols/2 - gr_measure(items[i-menu_top])/CHAR_WIDTH/2;
+			if (len < 0) len = 0;
+            const char *p = items[i-menu_top], *end = p;
+            int col = len;
+            while (col < text_cols-1) {
+                const char *next = end;
+                if (gr_utf8_next(&next) == 0 || next - p > MAX_COLS-1-len) break;
+                end = next;
+                col++;
+            }
+            memcpy(menu[i]+len, p, end - p);
+            menu[i][len + (end - p)] = '\0';
         }
         menu_items = i - menu_top;
         show_menu = 1;
@@ -708,6 +1207,8 @@ int ui_wait_key()
         timeout.tv_sec += wait_timeout;
 
 		ui_show_progress(1, wait_timeout);
+		// the first frame is complete now
+		save_snapshot();
 
         int rc = 0;
         while (key_queue_len == 0 && rc != ETIMEDOUT) {
@@ -27,10 +27,18 @@
 #define ERROR(x...)   KLOG_ERROR("Bootmenu", x)
 #define NOTICE(x...)  KLOG_NOTICE("Bootmenu", x)
 #define INFO(x...)    KLOG_INFO("Bootmenu", x)
+// Put the first frame saved at an earlier boot with the same key on
+// screen, before ui_init(); the first frame drawn with a new key is saved.
+void ui_show_snapshot(const char *path, unsigned key);
+
 // Initialize the graphics system.
 void ui_init();
 void ui_exit();
 
+// Bound the memory held by the installing animation, in KB; frames past
+// it are loaded again when drawn.  Call before ui_init().
+void ui_set_frame_cache(int kb);
+
 // Use KEY_* codes from <linux/input.h> or KEY_DREAM_* from "minui/minui.h".
 int ui_wait_key();            // waits for a key/button press, returns the code
 int ui_key_pressed(int key);  // returns >0 if the code is currently pressed
@@ -163,4 +171,8 @@ void boot(const char* script, int adbd, int init);
 #define STOCK_MODE_FILE "/preinstall/.stock_mode"
 #define SECOND_MODE_FILE "/preinstall/.second_mode"
 
+#define CACHE_DIR "/preinstall/bootmenu/cache"
+#define SNAPSHOT_FILE CACHE_DIR "/first_frame.raw"
+#define SCREENSHOT_DIR "/preinstall/bootmenu/screenshots"
+
 #endif  // BOOTMENU_COMMON_H
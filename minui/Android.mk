@@ -1,7 +1,9 @@
 LOCAL_PATH := $(call my-dir)
 include $(CLEAR_VARS)
 
-LOCAL_SRC_FILES := graphics.c events.c resources.c
+LOCAL_SRC_FILES := graphics.c graphics_fbdev.c graphics_virtual.c \
+    events.c resources.c pack.c glyphs.c stream.c screenshot.c \
+    blend.c blend_neon.c blend_sse2.c
 
 LOCAL_C_INCLUDES +=\
     external/libpng\
@@ -16,4 +18,8 @@ ifeq ($(TARGET_RECOVERY_PIXEL_FORMAT),"BGRA_8888")
   LOCAL_CFLAGS += -DRECOVERY_BGRA
 endif
 
+ifeq ($(ARCH_ARM_HAVE_NEON),true)
+  LOCAL_ARM_NEON := true
+endif
+
 include $(BUILD_STATIC_LIBRARY)
@@ -0,0 +1,168 @@
+/*
+ * Times full-screen display-list redraws of a menu screen with the
+ * redraw split into 1 to MAXBANDS bands by gr_set_render_threads(), and
+ * checks that every band count draws the same frame.
+ *
+ *   bandbench [-b MAXBANDS] [-n FRAMES]
+ *
+ * Each band count gets its own gr_init(), FRAMES frames (default 200)
+ * after one to fill the text run cache, and gr_exit().  The background
+ * changes shade every frame so that gr_list_end() redraws all of it.
+ * MAXBANDS defaults to 4.  It runs on the virtual backend unless
+ * MINUI_BACKEND says otherwise; MINUI_VIRTUAL_SIZE, _FORMAT and _STRIDE
+ * set the screen (see graphics_virtual.c).  Exits with 1 if any band
+ * count draws a different frame from one band.  Build it on an x86
+ * Linux host against the host pixelflinger:
+ *   cc -O2 -I. -I$ANDROID_BUILD_TOP/system/core/include bandbench.c \
+ *       graphics.c graphics_fbdev.c graphics_virtual.c blend.c \
+ *       blend_sse2.c glyphs.c resources.c pack.c screenshot.c stream.c \
+ *       -L$ANDROID_HOST_OUT/lib -lpixelflinger -lpng -lz -lpthread -lm \
+ *       -o bandbench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "minui.h"
+
+#define ITEMS  8
+
+static const char *items[ITEMS] = {
+    "Normal boot", "Recovery", "Safe mode", "Boot from SD card",
+    "Fastboot", "Battery charging", "Power off", "Settings",
+};
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Records and draws frame n of the menu, its highlight moving down. */
+static void draw_frame(gr_surface logo, int n)
+{
+    int w = gr_fb_width(), h = gr_fb_height();
+    int cw, ch, i, y;
+
+    gr_font_size(&cw, &ch);
+    gr_list_begin();
+    gr_color(16, 16, 24 + (n & 1), 255);
+    gr_fill(0, 0, w, h);
+    if (logo != NULL) gr_blit(logo, 0, 0, w / 2, h / 8, w / 4, ch);
+    gr_color(255, 255, 255, 255);
+    gr_text(cw, h / 8 + 3 * ch, "Please choose your boot preference");
+    for (i = 0; i < ITEMS; i++) {
+        y = h / 8 + (5 + 2 * i) * ch;
+        if (i == n % ITEMS) {
+            gr_color(0, 128, 255, 160);
+            gr_fill(0, y - ch, w, 2 * ch);
+            gr_color(255, 255, 255, 255);
+        } else {
+            gr_color(200, 200, 200, 255);
+        }
+        gr_text(2 * cw, y + ch / 2, items[i]);
+    }
+    gr_dim(0, h - 4 * ch, w, 4 * ch, 128);
+    gr_color(255, 200, 0, 255);
+    gr_text(cw, h - ch, "Volume keys move, power selects");
+    gr_list_end();
+}
+
+/* A hash of the frame just drawn, before it is flipped. */
+static unsigned long frame_hash(void)
+{
+    const char *format = getenv("MINUI_VIRTUAL_FORMAT");
+    const char *stride = getenv("MINUI_VIRTUAL_STRIDE");
+    int bpp = format == NULL || strcmp(format, "rgb565") == 0 ? 2 : 4;
+    int w = gr_fb_width(), h = gr_fb_height();
+    size_t line = (size_t) (stride != NULL ? atoi(stride) : w) * bpp;
+    const unsigned char *p = (const unsigned char *) gr_fb_data();
+    unsigned long hash = 5381;
+    int x, y;
+
+    for (y = 0; y < h; y++, p += line) {
+        for (x = 0; x < w * bpp; x++) hash = hash * 33 + p[x];
+    }
+    return hash;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bandbench [-b MAXBANDS] [-n FRAMES]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    int max_bands = 4, frames = 200;
+    int bands, i, opt, failed = 0;
+    double first = 0;
+    unsigned long first_hash = 0;
+
+    while ((opt = getopt(argc, argv, "b:n:")) != -1) {
+        switch (opt) {
+        case 'b':
+            max_bands = atoi(optarg);
+            if (max_bands < 1) usage();
+            break;
+        case 'n':
+            frames = atoi(optarg);
+            if (frames < 1) usage();
+            break;
+        default: usage();
+        }
+    }
+    setenv("MINUI_BACKEND", "virtual", 0);
+
+    printf("%-6s %12s %8s\n", "bands", "us/frame", "speedup");
+    for (bands = 1; bands <= max_bands; bands++) {
+        gr_surface logo;
+        unsigned long hash;
+        double t;
+
+        gr_set_render_threads(bands);
+        if (gr_init() < 0) {
+            fprintf(stderr, "bandbench: gr_init failed\n");
+            return 2;
+        }
+        /* an image drawn once and blitted every frame */
+        logo = gr_create_surface(gr_fb_width() / 2, gr_fb_height() / 8);
+        if (logo != NULL) {
+            gr_draw_to(logo);
+            gr_color(90, 40, 160, 255);
+            gr_fill(0, 0, gr_fb_width() / 2, gr_fb_height() / 8);
+            gr_color(255, 255, 255, 255);
+            gr_text(8, gr_fb_height() / 16, "bootmenu");
+            gr_draw_to(NULL);
+        }
+
+        draw_frame(logo, 0);
+        gr_flip();
+        t = now();
+        for (i = 1; i <= frames; i++) {
+            draw_frame(logo, i);
+            gr_flip();
+        }
+        t = (now() - t) / frames;
+
+        /* the same frame for every band count */
+        draw_frame(logo, frames + 1);
+        hash = frame_hash();
+        gr_flip();
+        if (bands == 1) {
+            first = t;
+            first_hash = hash;
+        }
+        printf("%-6d %12.1f %7.2fx%s\n", bands, t * 1e6, first / t,
+               hash == first_hash ? "" : "  DIFFERS");
+        if (hash != first_hash) failed = 1;
+
+        res_free_surface(logo);
+        gr_exit();
+    }
+    return failed;
+}
@@ -0,0 +1,371 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Scalar rasterizer kernels.  Each generic kernel is always inlined into
+// one wrapper per destination format, so the format switch in
+// gr_load()/gr_store() is resolved at compile time.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "graphics.h"
+
+static GR_ALWAYS_INLINE void fill_generic(int format, unsigned char *dst,
+        int dstride, int w, int h, unsigned pixel)
+{
+    int x;
+    for (; h > 0; h--, dst += dstride) {
+        if (gr_bytes_per_pixel(format) == 2) {
+            unsigned short *p = (unsigned short *) dst;
+            for (x = 0; x < w; x++) p[x] = pixel;
+        } else {
+            unsigned *p = (unsigned *) dst;
+            for (x = 0; x < w; x++) p[x] = pixel;
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void fill_blend_generic(int format, unsigned char *dst,
+        int dstride, int w, int h, const GRColor *c)
+{
+    const int bpp = gr_bytes_per_pixel(format);
+    int x;
+
+    for (; h > 0; h--, dst += dstride) {
+        unsigned char *p = dst;
+        for (x = 0; x < w; x++, p += bpp) {
+            gr_blend_pixel(format, p, c->r, c->g, c->b, c->a);
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void dim_generic(int format, unsigned char *dst,
+        int dstride, int w, int h, unsigned scale)
+{
+    const int bpp = gr_bytes_per_pixel(format);
+    unsigned r, g, b;
+    int x;
+
+    for (; h > 0; h--, dst += dstride) {
+        unsigned char *p = dst;
+        for (x = 0; x < w; x++, p += bpp) {
+            gr_load(format, p, &r, &g, &b);
+            gr_store(format, p, gr_div255(r * scale), gr_div255(g * scale),
+                     gr_div255(b * scale));
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void copy_rgbx_generic(int format, unsigned char *dst,
+        int dstride, const unsigned char *src, int sstride, int w, int h)
+{
+    const int bpp = gr_bytes_per_pixel(format);
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        const unsigned char *s = src;
+        unsigned char *p = dst;
+        if (format == GGL_PIXEL_FORMAT_RGBX_8888) {
+            memcpy(dst, src, w * 4);
+            continue;
+        }
+        for (x = 0; x < w; x++, s += 4, p += bpp) {
+            gr_store(format, p, s[0], s[1], s[2]);
+        }
+    }
+}
+
+// Bayer's 4x4 matrix: 0..15, halved for the 5-bit channels and
+// quartered for the 6-bit green, so each threshold stays below the
+// truncation step.
+const unsigned char gr_dither_rgbx[4][16] = {
+    { 0, 0, 0, 0,  4, 2, 4, 0,  1, 0, 1, 0,  5, 2, 5, 0 },
+    { 6, 3, 6, 0,  2, 1, 2, 0,  7, 3, 7, 0,  3, 1, 3, 0 },
+    { 1, 0, 1, 0,  5, 2, 5, 0,  0, 0, 0, 0,  4, 2, 4, 0 },
+    { 7, 3, 7, 0,  3, 1, 3, 0,  6, 3, 6, 0,  2, 1, 2, 0 },
+};
+
+static GR_ALWAYS_INLINE void dither_rgbx_generic(int format,
+        unsigned char *dst, int dstride, const unsigned char *src,
+        int sstride, int w, int h)
+{
+    int x, y;
+
+    if (gr_bytes_per_pixel(format) == 4) {
+        copy_rgbx_generic(format, dst, dstride, src, sstride, w, h);
+        return;
+    }
+    for (y = 0; y < h; y++, dst += dstride, src += sstride) {
+        for (x = 0; x < w; x++) {
+            gr_store_dither(dst + x * 2, src + x * 4, x, y);
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void blend_rgba_generic(int format, unsigned char *dst,
+        int dstride, const unsigned char *src, int sstride, int w, int h)
+{
+    const int bpp = gr_bytes_per_pixel(format);
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        const unsigned char *s = src;
+        unsigned char *p = dst;
+        for (x = 0; x < w; x++, s += 4, p += bpp) {
+            gr_blend_pixel(format, p, s[0], s[1], s[2], s[3]);
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void blend_pre_generic(int format, unsigned char *dst,
+        int dstride, const unsigned char *src, int sstride, int w, int h)
+{
+    const int bpp = gr_bytes_per_pixel(format);
+    unsigned r, g, b, a;
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        const unsigned char *s = src;
+        unsigned char *p = dst;
+        for (x = 0; x < w; x++, s += 4, p += bpp) {
+            gr_load_pre(format, s, &r, &g, &b, &a);
+            gr_blend_pre_pixel(format, p, r, g, b, a);
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void blend_a8_generic(int format, unsigned char *dst,
+        int dstride, const unsigned char *mask, int mstride, int w, int h,
+        const GRColor *c)
+{
+    const int bpp = gr_bytes_per_pixel(format);
+    int x;
+
+    for (; h > 0; h--, dst += dstride, mask += mstride) {
+        unsigned char *p = dst;
+        for (x = 0; x < w; x++, p += bpp) {
+            gr_blend_pixel(format, p, c->r, c->g, c->b, mask[x]);
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void blend_a1_generic(int format, unsigned char *dst,
+        int dstride, const unsigned char *bits, int bstride, int bx, int w,
+        int h, const GRColor *c)
+{
+    const int bpp = gr_bytes_per_pixel(format);
+    int x;
+
+    for (; h > 0; h--, dst += dstride, bits += bstride) {
+        unsigned char *p = dst;
+        for (x = 0; x < w; x++, p += bpp) {
+            if (gr_bit(bits, bx + x)) gr_store(format, p, c->r, c->g, c->b);
+        }
+    }
+}
+
+// Turning a block walks dst a column at a time, so it is done in
+// squares small enough that the dst lines one square touches stay in
+// the cache until the square is finished.
+#define GR_ROTATE_BLOCK 32
+
+static GR_ALWAYS_INLINE void rotate_generic(int format, unsigned char *dst,
+        int dstride, const unsigned char *src, int sstride, int w, int h,
+        int rotation)
+{
+    const int bpp = gr_bytes_per_pixel(format);
+    int xs, ys, x, y, bw, bh;
+
+    dst = gr_rotate_origin(bpp, dst, dstride, w, h, rotation, &xs, &ys);
+    for (y = 0; y < h; y += GR_ROTATE_BLOCK) {
+        bh = h - y < GR_ROTATE_BLOCK ? h - y : GR_ROTATE_BLOCK;
+        for (x = 0; x < w; x += GR_ROTATE_BLOCK) {
+            bw = w - x < GR_ROTATE_BLOCK ? w - x : GR_ROTATE_BLOCK;
+            gr_rotate_pixels(bpp, dst + x * xs + y * ys, xs, ys,
+                             src + y * sstride + x * bpp, sstride, bw, bh);
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void scale_nearest_generic(int format,
+        unsigned char *dst, const unsigned char *src, int sw, int x,
+        int step, int w)
+{
+    unsigned f;
+    int i;
+
+    for (i = 0; i < w; i++, x += step) {
+        int n = gr_scale_pos(x, sw, &f);
+        if (gr_bytes_per_pixel(format) == 2)
+            ((unsigned short *) dst)[i] = ((const unsigned short *) src)[n];
+        else
+            ((unsigned *) dst)[i] = ((const unsigned *) src)[n];
+    }
+}
+
+static GR_ALWAYS_INLINE void lerp_x_generic(int format, unsigned char *dst,
+        const unsigned char *src, int sw, int x, int step, int w)
+{
+    int i;
+
+    for (i = 0; i < w; i++, x += step, dst += 4) {
+        gr_lerp_pixel(format, dst, src, sw, x);
+    }
+}
+
+static void lerp_y(unsigned char *dst, const unsigned char *a,
+                   const unsigned char *b, int n, unsigned f)
+{
+    int i;
+
+    for (i = 0; i < n; i++) dst[i] = gr_lerp8(a[i], b[i], f);
+}
+
+#define DEFINE_KERNELS(name, format)                                          \
+static void fill_##name(unsigned char *dst, int dstride, int w, int h,        \
+        unsigned pixel)                                                       \
+{                                                                             \
+    fill_generic(format, dst, dstride, w, h, pixel);                          \
+}                                                                             \
+static void fill_blend_##name(unsigned char *dst, int dstride, int w, int h,  \
+        const GRColor *c)                                                     \
+{                                                                             \
+    fill_blend_generic(format, dst, dstride, w, h, c);                        \
+}                                                                             \
+static void dim_##name(unsigned char *dst, int dstride, int w, int h,         \
+        unsigned scale)                                                       \
+{                                                                             \
+    dim_generic(format, dst, dstride, w, h, scale);                           \
+}                                                                             \
+static void copy_rgbx_##name(unsigned char *dst, int dstride,                 \
+        const unsigned char *src, int sstride, int w, int h)                  \
+{                                                                             \
+    copy_rgbx_generic(format, dst, dstride, src, sstride, w, h);              \
+}                                                                             \
+static void dither_rgbx_##name(unsigned char *dst, int dstride,               \
+        const unsigned char *src, int sstride, int w, int h)                  \
+{                                                                             \
+    dither_rgbx_generic(format, dst, dstride, src, sstride, w, h);            \
+}                                                                             \
+static void blend_rgba_##name(unsigned char *dst, int dstride,                \
+        const unsigned char *src, int sstride, int w, int h)                  \
+{                                                                             \
+    blend_rgba_generic(format, dst, dstride, src, sstride, w, h);             \
+}                                                                             \
+static void blend_pre_##name(unsigned char *dst, int dstride,                 \
+        const unsigned char *src, int sstride, int w, int h)                  \
+{                                                                             \
+    blend_pre_generic(format, dst, dstride, src, sstride, w, h);              \
+}                                                                             \
+static void blend_a8_##name(unsigned char *dst, int dstride,                  \
+        const unsigned char *mask, int mstride, int w, int h,                 \
+        const GRColor *c)                                                     \
+{                                                                             \
+    blend_a8_generic(format, dst, dstride, mask, mstride, w, h, c);           \
+}                                                                             \
+static void blend_a1_##name(unsigned char *dst, int dstride,                  \
+        const unsigned char *bits, int bstride, int bx, int w, int h,         \
+        const GRColor *c)                                                     \
+{                                                                             \
+    blend_a1_generic(format, dst, dstride, bits, bstride, bx, w, h, c);       \
+}                                                                             \
+static void rotate_##name(unsigned char *dst, int dstride,                    \
+        const unsigned char *src, int sstride, int w, int h, int rotation)    \
+{                                                                             \
+    rotate_generic(format, dst, dstride, src, sstride, w, h, rotation);       \
+}                                                                             \
+static void scale_nearest_##name(unsigned char *dst, const unsigned char *src, \
+        int sw, int x, int step, int w)                                       \
+{                                                                             \
+    scale_nearest_generic(format, dst, src, sw, x, step, w);                  \
+}                                                                             \
+static void lerp_x_##name(unsigned char *dst, const unsigned char *src,       \
+        int sw, int x, int step, int w)                                       \
+{                                                                             \
+    lerp_x_generic(format, dst, src, sw, x, step, w);                         \
+}                                                                             \
+static const GRKernels scalar_##name = {                                      \
+    fill_##name, fill_blend_##name, dim_##name, copy_rgbx_##name,             \
+    dither_rgbx_##name, blend_rgba_##name,                                    \
+    blend_pre_##name, blend_a8_##name, blend_a1_##name, rotate_##name,        \
+    scale_nearest_##name, lerp_x_##name, lerp_y,                              \
+};
+
+DEFINE_KERNELS(rgb565, GGL_PIXEL_FORMAT_RGB_565)
+DEFINE_KERNELS(rgbx8888, GGL_PIXEL_FORMAT_RGBX_8888)
+DEFINE_KERNELS(bgra8888, GGL_PIXEL_FORMAT_BGRA_8888)
+DEFINE_KERNELS(argb8888, GR_PIXEL_FORMAT_ARGB_8888)
+
+static GRKernels gr_kernels_rgb565;
+static GRKernels gr_kernels_rgbx8888;
+static GRKernels gr_kernels_bgra8888;
+static GRKernels gr_kernels_argb8888;
+
+const GRKernels *gr_get_scalar_kernels(int format)
+{
+    switch (format) {
+    case GGL_PIXEL_FORMAT_RGB_565:
+        return &scalar_rgb565;
+    case GGL_PIXEL_FORMAT_RGBX_8888:
+        return &scalar_rgbx8888;
+    case GGL_PIXEL_FORMAT_BGRA_8888:
+        return &scalar_bgra8888;
+    case GR_PIXEL_FORMAT_ARGB_8888:
+        return &scalar_argb8888;
+    }
+    return NULL;
+}
+
+const GRKernels *gr_get_kernels(int format)
+{
+    GRKernels *k;
+
+    switch (format) {
+    case GGL_PIXEL_FORMAT_RGB_565:
+        k = &gr_kernels_rgb565;
+        break;
+    case GGL_PIXEL_FORMAT_RGBX_8888:
+        k = &gr_kernels_rgbx8888;
+        break;
+    case GGL_PIXEL_FORMAT_BGRA_8888:
+        k = &gr_kernels_bgra8888;
+        break;
+    case GR_PIXEL_FORMAT_ARGB_8888:
+        k = &gr_kernels_argb8888;
+        break;
+    default:
+        return NULL;
+    }
+
+    if (k->fill == NULL) {
+        *k = *gr_get_scalar_kernels(format);
+        gr_kernels_simd(k, format);
+    }
+    return k;
+}
+
+unsigned gr_pack_pixel(int format, const GRColor *c)
+{
+    unsigned pixel = 0;
+    gr_store(format, (unsigned char *) &pixel, c->r, c->g, c->b);
+    return pixel;
+}
+
+#if !defined(GR_HAVE_NEON) && !defined(GR_HAVE_SSE2)
+void gr_kernels_simd(GRKernels *k, int format)
+{
+}
+#endif
@@ -0,0 +1,903 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// NEON rasterizer kernels, used when libminui_bm is built with
+// LOCAL_ARM_NEON.  Results are bit-identical to the scalar kernels in
+// blend.c; columns left over after the vector loop go through the same
+// scalar helpers.
+
+#include "graphics.h"
+
+#ifdef GR_HAVE_NEON
+
+#include <arm_neon.h>
+#include <string.h>
+
+// s * a + d * ~a, rounded the same way as gr_div255()
+static inline uint8x8_t blend_u8(uint8x8_t s, uint8x8_t d, uint8x8_t a)
+{
+    uint16x8_t t = vmull_u8(s, a);
+    t = vmlal_u8(t, d, vmvn_u8(a));
+    return vraddhn_u16(t, vrshrq_n_u16(t, 8));
+}
+
+// The alpha byte the way gr_blend_pixel() leaves it: pixels with zero
+// alpha keep dst untouched, all others get 0xff.
+static inline uint8x8_t alpha_u8(uint8x8_t d, uint8x8_t a)
+{
+    return vorr_u8(d, vtst_u8(a, a));
+}
+
+// d * scale, rounded the same way as gr_div255()
+static inline uint8x8_t dim_u8(uint8x8_t d, uint8x8_t scale)
+{
+    uint16x8_t t = vmull_u8(d, scale);
+    return vraddhn_u16(t, vrshrq_n_u16(t, 8));
+}
+
+static inline int all_u8(uint8x8_t v, unsigned char value)
+{
+    unsigned long long bits = vget_lane_u64(vreinterpret_u64_u8(v), 0);
+    return bits == value * 0x0101010101010101ULL;
+}
+
+static inline void unpack_565(uint16x8_t v, uint8x8_t *r, uint8x8_t *g,
+                              uint8x8_t *b)
+{
+    uint16x8_t r5 = vshrq_n_u16(v, 11);
+    uint16x8_t g6 = vandq_u16(vshrq_n_u16(v, 5), vdupq_n_u16(0x3f));
+    uint16x8_t b5 = vandq_u16(v, vdupq_n_u16(0x1f));
+    *r = vmovn_u16(vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2)));
+    *g = vmovn_u16(vorrq_u16(vshlq_n_u16(g6, 2), vshrq_n_u16(g6, 4)));
+    *b = vmovn_u16(vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2)));
+}
+
+static inline uint16x8_t pack_565(uint8x8_t r, uint8x8_t g, uint8x8_t b)
+{
+    uint16x8_t p = vshll_n_u8(r, 8);
+    p = vsriq_n_u16(p, vshll_n_u8(g, 8), 5);
+    return vsriq_n_u16(p, vshll_n_u8(b, 8), 11);
+}
+
+static inline uint16x8_t blend_565(uint16x8_t v, uint8x8_t r, uint8x8_t g,
+                                   uint8x8_t b, uint8x8_t a)
+{
+    uint8x8_t dr, dg, db;
+    unpack_565(v, &dr, &dg, &db);
+    return pack_565(blend_u8(r, dr, a), blend_u8(g, dg, a),
+                    blend_u8(b, db, a));
+}
+
+// Channel order of a 32-bit destination as seen by vld4_u8
+static GR_ALWAYS_INLINE int red_lane(int format)
+{
+    return format == GGL_PIXEL_FORMAT_BGRA_8888 ? 2 : 0;
+}
+
+static void fill_16(unsigned char *dst, int dstride, int w, int h,
+                    unsigned pixel)
+{
+    const uint16x8_t v = vdupq_n_u16(pixel);
+    int x;
+
+    for (; h > 0; h--, dst += dstride) {
+        unsigned short *p = (unsigned short *) dst;
+        for (x = 0; x + 8 <= w; x += 8) {
+            vst1q_u16(p + x, v);
+        }
+        for (; x < w; x++) p[x] = pixel;
+    }
+}
+
+static void fill_32(unsigned char *dst, int dstride, int w, int h,
+                    unsigned pixel)
+{
+    const uint32x4_t v = vdupq_n_u32(pixel);
+    int x;
+
+    for (; h > 0; h--, dst += dstride) {
+        unsigned *p = (unsigned *) dst;
+        for (x = 0; x + 4 <= w; x += 4) {
+            vst1q_u32(p + x, v);
+        }
+        for (; x < w; x++) p[x] = pixel;
+    }
+}
+
+static GR_ALWAYS_INLINE void fill_blend_32(int format, unsigned char *dst,
+        int dstride, int w, int h, const GRColor *c)
+{
+    const int ri = red_lane(format), bi = 2 - ri;
+    const uint8x8_t a = vdup_n_u8(c->a);
+    const uint8x8_t r = vdup_n_u8(c->r);
+    const uint8x8_t g = vdup_n_u8(c->g);
+    const uint8x8_t b = vdup_n_u8(c->b);
+    int x;
+
+    if (c->a == 0) return;
+    for (; h > 0; h--, dst += dstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8x4_t d = vld4_u8(dst + x * 4);
+            d.val[ri] = blend_u8(r, d.val[ri], a);
+            d.val[1] = blend_u8(g, d.val[1], a);
+            d.val[bi] = blend_u8(b, d.val[bi], a);
+            d.val[3] = vdup_n_u8(0xff);
+            vst4_u8(dst + x * 4, d);
+        }
+        for (; x < w; x++) {
+            gr_blend_pixel(format, dst + x * 4, c->r, c->g, c->b, c->a);
+        }
+    }
+}
+
+static void fill_blend_rgbx8888(unsigned char *dst, int dstride, int w,
+                                int h, const GRColor *c)
+{
+    fill_blend_32(GGL_PIXEL_FORMAT_RGBX_8888, dst, dstride, w, h, c);
+}
+
+static void fill_blend_bgra8888(unsigned char *dst, int dstride, int w,
+                                int h, const GRColor *c)
+{
+    fill_blend_32(GGL_PIXEL_FORMAT_BGRA_8888, dst, dstride, w, h, c);
+}
+
+static void fill_blend_rgb565(unsigned char *dst, int dstride, int w, int h,
+                              const GRColor *c)
+{
+    const uint8x8_t a = vdup_n_u8(c->a);
+    const uint8x8_t r = vdup_n_u8(c->r);
+    const uint8x8_t g = vdup_n_u8(c->g);
+    const uint8x8_t b = vdup_n_u8(c->b);
+    int x;
+
+    if (c->a == 0) return;
+    for (; h > 0; h--, dst += dstride) {
+        unsigned short *p = (unsigned short *) dst;
+        for (x = 0; x + 8 <= w; x += 8) {
+            vst1q_u16(p + x, blend_565(vld1q_u16(p + x), r, g, b, a));
+        }
+        for (; x < w; x++) {
+            gr_blend_pixel(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                           c->r, c->g, c->b, c->a);
+        }
+    }
+}
+
+static void dim_32(unsigned char *dst, int dstride, int w, int h,
+                   unsigned scale)
+{
+    const uint8x8_t s = vdup_n_u8(scale);
+    unsigned char *p;
+    int x;
+
+    for (; h > 0; h--, dst += dstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8x4_t d = vld4_u8(dst + x * 4);
+            d.val[0] = dim_u8(d.val[0], s);
+            d.val[1] = dim_u8(d.val[1], s);
+            d.val[2] = dim_u8(d.val[2], s);
+            d.val[3] = vdup_n_u8(0xff);
+            vst4_u8(dst + x * 4, d);
+        }
+        // the channel order does not matter when all are scaled alike
+        for (p = dst + x * 4; x < w; x++, p += 4) {
+            p[0] = gr_div255(p[0] * scale);
+            p[1] = gr_div255(p[1] * scale);
+            p[2] = gr_div255(p[2] * scale);
+            p[3] = 0xff;
+        }
+    }
+}
+
+static void dim_rgb565(unsigned char *dst, int dstride, int w, int h,
+                       unsigned scale)
+{
+    const uint8x8_t s = vdup_n_u8(scale);
+    uint8x8_t r, g, b;
+    unsigned dr, dg, db;
+    int x;
+
+    for (; h > 0; h--, dst += dstride) {
+        unsigned short *p = (unsigned short *) dst;
+        for (x = 0; x + 8 <= w; x += 8) {
+            unpack_565(vld1q_u16(p + x), &r, &g, &b);
+            vst1q_u16(p + x, pack_565(dim_u8(r, s), dim_u8(g, s),
+                                      dim_u8(b, s)));
+        }
+        for (; x < w; x++) {
+            gr_load(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2, &dr, &dg, &db);
+            gr_store(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                     gr_div255(dr * scale), gr_div255(dg * scale),
+                     gr_div255(db * scale));
+        }
+    }
+}
+
+static void copy_rgbx_bgra8888(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8x4_t s = vld4_u8(src + x * 4);
+            uint8x8_t t = s.val[0];
+            s.val[0] = s.val[2];
+            s.val[2] = t;
+            s.val[3] = vdup_n_u8(0xff);
+            vst4_u8(dst + x * 4, s);
+        }
+        for (; x < w; x++) {
+            const unsigned char *s = src + x * 4;
+            gr_store(GGL_PIXEL_FORMAT_BGRA_8888, dst + x * 4,
+                     s[0], s[1], s[2]);
+        }
+    }
+}
+
+static void copy_rgbx_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        unsigned short *p = (unsigned short *) dst;
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8x4_t s = vld4_u8(src + x * 4);
+            vst1q_u16(p + x, pack_565(s.val[0], s.val[1], s.val[2]));
+        }
+        for (; x < w; x++) {
+            const unsigned char *s = src + x * 4;
+            gr_store(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2, s[0], s[1], s[2]);
+        }
+    }
+}
+
+static void dither_rgbx_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    int x, y;
+
+    for (y = 0; y < h; y++, dst += dstride, src += sstride) {
+        unsigned short *p = (unsigned short *) dst;
+        unsigned char row[32];
+        uint8x8x4_t d;
+        // the row's four thresholds twice over, one lane per pixel
+        memcpy(row, gr_dither_rgbx[y & 3], 16);
+        memcpy(row + 16, gr_dither_rgbx[y & 3], 16);
+        d = vld4_u8(row);
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8x4_t s = vld4_u8(src + x * 4);
+            vst1q_u16(p + x, pack_565(vqadd_u8(s.val[0], d.val[0]),
+                                      vqadd_u8(s.val[1], d.val[1]),
+                                      vqadd_u8(s.val[2], d.val[2])));
+        }
+        for (; x < w; x++) gr_store_dither(dst + x * 2, src + x * 4, x, y);
+    }
+}
+
+static GR_ALWAYS_INLINE void blend_rgba_32(int format, unsigned char *dst,
+        int dstride, const unsigned char *src, int sstride, int w, int h)
+{
+    const int ri = red_lane(format), bi = 2 - ri;
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8x4_t s = vld4_u8(src + x * 4);
+            uint8x8x4_t d;
+
+            if (all_u8(s.val[3], 0)) continue;
+            if (all_u8(s.val[3], 255)) {
+                d.val[ri] = s.val[0];
+                d.val[1] = s.val[1];
+                d.val[bi] = s.val[2];
+            } else {
+                d = vld4_u8(dst + x * 4);
+                d.val[ri] = blend_u8(s.val[0], d.val[ri], s.val[3]);
+                d.val[1] = blend_u8(s.val[1], d.val[1], s.val[3]);
+                d.val[bi] = blend_u8(s.val[2], d.val[bi], s.val[3]);
+                d.val[3] = alpha_u8(d.val[3], s.val[3]);
+                vst4_u8(dst + x * 4, d);
+                continue;
+            }
+            d.val[3] = vdup_n_u8(0xff);
+            vst4_u8(dst + x * 4, d);
+        }
+        for (; x < w; x++) {
+            const unsigned char *s = src + x * 4;
+            gr_blend_pixel(format, dst + x * 4, s[0], s[1], s[2], s[3]);
+        }
+    }
+}
+
+static void blend_rgba_rgbx8888(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    blend_rgba_32(GGL_PIXEL_FORMAT_RGBX_8888, dst, dstride, src, sstride,
+                  w, h);
+}
+
+static void blend_rgba_bgra8888(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    blend_rgba_32(GGL_PIXEL_FORMAT_BGRA_8888, dst, dstride, src, sstride,
+                  w, h);
+}
+
+static void blend_rgba_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        unsigned short *p = (unsigned short *) dst;
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8x4_t s = vld4_u8(src + x * 4);
+            if (all_u8(s.val[3], 0)) continue;
+            if (all_u8(s.val[3], 255)) {
+                vst1q_u16(p + x, pack_565(s.val[0], s.val[1], s.val[2]));
+            } else {
+                vst1q_u16(p + x, blend_565(vld1q_u16(p + x), s.val[0],
+                                           s.val[1], s.val[2], s.val[3]));
+            }
+        }
+        for (; x < w; x++) {
+            const unsigned char *s = src + x * 4;
+            gr_blend_pixel(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                           s[0], s[1], s[2], s[3]);
+        }
+    }
+}
+
+// premultiplied s + d * ~a
+static inline uint8x8_t over_u8(uint8x8_t s, uint8x8_t d, uint8x8_t ia)
+{
+    uint16x8_t t = vmull_u8(d, ia);
+    return vadd_u8(s, vraddhn_u16(t, vrshrq_n_u16(t, 8)));
+}
+
+static GR_ALWAYS_INLINE void blend_pre_32(int format, unsigned char *dst,
+        int dstride, const unsigned char *src, int sstride, int w, int h)
+{
+    unsigned r, g, b, a;
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8x4_t s = vld4_u8(src + x * 4);
+            uint8x8x4_t d;
+            uint8x8_t ia;
+
+            if (all_u8(s.val[3], 0)) continue;
+            if (all_u8(s.val[3], 255)) {
+                vst4_u8(dst + x * 4, s);
+                continue;
+            }
+            // the premultiplied layout already has the channel order
+            // of the destination
+            ia = vmvn_u8(s.val[3]);
+            d = vld4_u8(dst + x * 4);
+            d.val[0] = over_u8(s.val[0], d.val[0], ia);
+            d.val[1] = over_u8(s.val[1], d.val[1], ia);
+            d.val[2] = over_u8(s.val[2], d.val[2], ia);
+            d.val[3] = alpha_u8(d.val[3], s.val[3]);
+            vst4_u8(dst + x * 4, d);
+        }
+        for (; x < w; x++) {
+            gr_load_pre(format, src + x * 4, &r, &g, &b, &a);
+            gr_blend_pre_pixel(format, dst + x * 4, r, g, b, a);
+        }
+    }
+}
+
+static void blend_pre_rgbx8888(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    blend_pre_32(GGL_PIXEL_FORMAT_RGBX_8888, dst, dstride, src, sstride,
+                 w, h);
+}
+
+static void blend_pre_bgra8888(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    blend_pre_32(GGL_PIXEL_FORMAT_BGRA_8888, dst, dstride, src, sstride,
+                 w, h);
+}
+
+static void blend_pre_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    unsigned r, g, b, a;
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        unsigned short *p = (unsigned short *) dst;
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8x4_t s = vld4_u8(src + x * 4);
+            uint8x8_t dr, dg, db, ia;
+
+            if (all_u8(s.val[3], 0)) continue;
+            if (all_u8(s.val[3], 255)) {
+                vst1q_u16(p + x, pack_565(s.val[0], s.val[1], s.val[2]));
+                continue;
+            }
+            ia = vmvn_u8(s.val[3]);
+            unpack_565(vld1q_u16(p + x), &dr, &dg, &db);
+            vst1q_u16(p + x, pack_565(over_u8(s.val[0], dr, ia),
+                    over_u8(s.val[1], dg, ia), over_u8(s.val[2], db, ia)));
+        }
+        for (; x < w; x++) {
+            gr_load_pre(GGL_PIXEL_FORMAT_RGB_565, src + x * 4,
+                        &r, &g, &b, &a);
+            gr_blend_pre_pixel(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                               r, g, b, a);
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void blend_a8_32(int format, unsigned char *dst,
+        int dstride, const unsigned char *mask, int mstride, int w, int h,
+        const GRColor *c)
+{
+    const int ri = red_lane(format), bi = 2 - ri;
+    const uint32x4_t color = vdupq_n_u32(gr_pack_pixel(format, c));
+    const uint8x8_t r = vdup_n_u8(c->r);
+    const uint8x8_t g = vdup_n_u8(c->g);
+    const uint8x8_t b = vdup_n_u8(c->b);
+    int x;
+
+    for (; h > 0; h--, dst += dstride, mask += mstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8_t a = vld1_u8(mask + x);
+            uint8x8x4_t d;
+
+            if (all_u8(a, 0)) continue;
+            if (all_u8(a, 255)) {
+                vst1q_u32((unsigned *) (dst + x * 4), color);
+                vst1q_u32((unsigned *) (dst + x * 4 + 16), color);
+                continue;
+            }
+            d = vld4_u8(dst + x * 4);
+            d.val[ri] = blend_u8(r, d.val[ri], a);
+            d.val[1] = blend_u8(g, d.val[1], a);
+            d.val[bi] = blend_u8(b, d.val[bi], a);
+            d.val[3] = alpha_u8(d.val[3], a);
+            vst4_u8(dst + x * 4, d);
+        }
+        for (; x < w; x++) {
+            gr_blend_pixel(format, dst + x * 4, c->r, c->g, c->b, mask[x]);
+        }
+    }
+}
+
+static void blend_a8_rgbx8888(unsigned char *dst, int dstride,
+        const unsigned char *mask, int mstride, int w, int h,
+        const GRColor *c)
+{
+    blend_a8_32(GGL_PIXEL_FORMAT_RGBX_8888, dst, dstride, mask, mstride,
+                w, h, c);
+}
+
+static void blend_a8_bgra8888(unsigned char *dst, int dstride,
+        const unsigned char *mask, int mstride, int w, int h,
+        const GRColor *c)
+{
+    blend_a8_32(GGL_PIXEL_FORMAT_BGRA_8888, dst, dstride, mask, mstride,
+                w, h, c);
+}
+
+static void blend_a8_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *mask, int mstride, int w, int h,
+        const GRColor *c)
+{
+    const uint16x8_t color = vdupq_n_u16(
+            gr_pack_pixel(GGL_PIXEL_FORMAT_RGB_565, c));
+    const uint8x8_t r = vdup_n_u8(c->r);
+    const uint8x8_t g = vdup_n_u8(c->g);
+    const uint8x8_t b = vdup_n_u8(c->b);
+    int x;
+
+    for (; h > 0; h--, dst += dstride, mask += mstride) {
+        unsigned short *p = (unsigned short *) dst;
+        for (x = 0; x + 8 <= w; x += 8) {
+            uint8x8_t a = vld1_u8(mask + x);
+            if (all_u8(a, 0)) continue;
+            if (all_u8(a, 255)) {
+                vst1q_u16(p + x, color);
+                continue;
+            }
+            vst1q_u16(p + x, blend_565(vld1q_u16(p + x), r, g, b, a));
+        }
+        for (; x < w; x++) {
+            gr_blend_pixel(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                           c->r, c->g, c->b, mask[x]);
+        }
+    }
+}
+
+// per-pixel 0xff/0x00 masks for eight bits, most significant first
+static inline uint8x8_t expand_bits(unsigned m)
+{
+    static const uint8_t sel[8] = { 0x80, 0x40, 0x20, 0x10, 8, 4, 2, 1 };
+    return vtst_u8(vdup_n_u8(m), vld1_u8(sel));
+}
+
+// the first four 0xff/0x00 byte masks of a, widened to 32-bit lanes
+static inline uint32x4_t widen_mask(uint8x8_t a)
+{
+    int16x8_t m16 = vmovl_s8(vreinterpret_s8_u8(a));
+    return vreinterpretq_u32_s32(vmovl_s16(vget_low_s16(m16)));
+}
+
+static GR_ALWAYS_INLINE void blend_a1_32(int format, unsigned char *dst,
+        int dstride, const unsigned char *bits, int bstride, int bx, int w,
+        int h, const GRColor *c)
+{
+    const uint32x4_t color = vdupq_n_u32(gr_pack_pixel(format, c));
+    int x;
+
+    for (; h > 0; h--, dst += dstride, bits += bstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            unsigned *p = (unsigned *) (dst + x * 4);
+            unsigned m = gr_bits8(bits, bx + x);
+            uint8x8_t a;
+
+            if (m == 0) continue;
+            a = expand_bits(m);
+            vst1q_u32(p, vbslq_u32(widen_mask(a), color, vld1q_u32(p)));
+            vst1q_u32(p + 4, vbslq_u32(widen_mask(vext_u8(a, a, 4)), color,
+                                       vld1q_u32(p + 4)));
+        }
+        for (; x < w; x++) {
+            if (gr_bit(bits, bx + x))
+                gr_store(format, dst + x * 4, c->r, c->g, c->b);
+        }
+    }
+}
+
+static void blend_a1_rgbx8888(unsigned char *dst, int dstride,
+        const unsigned char *bits, int bstride, int bx, int w, int h,
+        const GRColor *c)
+{
+    blend_a1_32(GGL_PIXEL_FORMAT_RGBX_8888, dst, dstride, bits, bstride, bx,
+                w, h, c);
+}
+
+static void blend_a1_bgra8888(unsigned char *dst, int dstride,
+        const unsigned char *bits, int bstride, int bx, int w, int h,
+        const GRColor *c)
+{
+    blend_a1_32(GGL_PIXEL_FORMAT_BGRA_8888, dst, dstride, bits, bstride, bx,
+                w, h, c);
+}
+
+static void blend_a1_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *bits, int bstride, int bx, int w, int h,
+        const GRColor *c)
+{
+    const uint16x8_t color = vdupq_n_u16(
+            gr_pack_pixel(GGL_PIXEL_FORMAT_RGB_565, c));
+    int x;
+
+    for (; h > 0; h--, dst += dstride, bits += bstride) {
+        unsigned short *p = (unsigned short *) dst;
+        for (x = 0; x + 8 <= w; x += 8) {
+            unsigned m = gr_bits8(bits, bx + x);
+            uint16x8_t sel;
+
+            if (m == 0) continue;
+            sel = vreinterpretq_u16_s16(
+                    vmovl_s8(vreinterpret_s8_u8(expand_bits(m))));
+            vst1q_u16(p + x, vbslq_u16(sel, color, vld1q_u16(p + x)));
+        }
+        for (; x < w; x++) {
+            if (gr_bit(bits, bx + x))
+                gr_store(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                         c->r, c->g, c->b);
+        }
+    }
+}
+
+// Turned blocks are walked in squares of GR_ROTATE_BLOCK (see blend.c),
+// each cut into tiles that are transposed in registers: 4x4 pixels at
+// 32 bits, 8x8 at 16.  Loading the tile rows bottom up makes the
+// transpose come out turned by 90 rather than 270 degrees.
+#define GR_ROTATE_BLOCK 32
+
+static inline uint32x4_t reverse_32(uint32x4_t v)
+{
+    v = vrev64q_u32(v);
+    return vcombine_u32(vget_high_u32(v), vget_low_u32(v));
+}
+
+static inline uint16x8_t reverse_16(uint16x8_t v)
+{
+    v = vrev64q_u16(v);
+    return vcombine_u16(vget_high_u16(v), vget_low_u16(v));
+}
+
+static inline void tile_32(unsigned char *d, int dstep,
+                           const unsigned char *s, int sstep)
+{
+    uint32x4x2_t p = vtrnq_u32(vld1q_u32((const uint32_t *) s),
+                               vld1q_u32((const uint32_t *) (s + sstep)));
+    uint32x4x2_t q = vtrnq_u32(vld1q_u32((const uint32_t *) (s + 2 * sstep)),
+                               vld1q_u32((const uint32_t *) (s + 3 * sstep)));
+
+    vst1q_u32((uint32_t *) d, vcombine_u32(vget_low_u32(p.val[0]),
+                                           vget_low_u32(q.val[0])));
+    vst1q_u32((uint32_t *) (d + dstep), vcombine_u32(vget_low_u32(p.val[1]),
+                                                     vget_low_u32(q.val[1])));
+    vst1q_u32((uint32_t *) (d + 2 * dstep),
+              vcombine_u32(vget_high_u32(p.val[0]), vget_high_u32(q.val[0])));
+    vst1q_u32((uint32_t *) (d + 3 * dstep),
+              vcombine_u32(vget_high_u32(p.val[1]), vget_high_u32(q.val[1])));
+}
+
+static inline void tile_16(unsigned char *d, int dstep,
+                           const unsigned char *s, int sstep)
+{
+    uint16x8x2_t p[4];
+    uint32x4x2_t q[4];
+    uint32x4_t c[8];
+    int i;
+
+    // p[i]: rows 2i and 2i+1 with their even, then odd columns paired
+    for (i = 0; i < 4; i++) {
+        p[i] = vtrnq_u16(
+                vld1q_u16((const uint16_t *) (s + 2 * i * sstep)),
+                vld1q_u16((const uint16_t *) (s + (2 * i + 1) * sstep)));
+    }
+    // q[0], q[1]: rows 0-3 with columns (0, 4), (2, 6), then (1, 5),
+    // (3, 7) together; q[2], q[3] the same for rows 4-7
+    for (i = 0; i < 4; i += 2) {
+        q[i] = vtrnq_u32(vreinterpretq_u32_u16(p[i].val[0]),
+                         vreinterpretq_u32_u16(p[i + 1].val[0]));
+        q[i + 1] = vtrnq_u32(vreinterpretq_u32_u16(p[i].val[1]),
+                             vreinterpretq_u32_u16(p[i + 1].val[1]));
+    }
+    for (i = 0; i < 2; i++) {
+        c[2 * i] = vcombine_u32(vget_low_u32(q[0].val[i]),
+                                vget_low_u32(q[2].val[i]));
+        c[2 * i + 1] = vcombine_u32(vget_low_u32(q[1].val[i]),
+                                    vget_low_u32(q[3].val[i]));
+        c[2 * i + 4] = vcombine_u32(vget_high_u32(q[0].val[i]),
+                                    vget_high_u32(q[2].val[i]));
+        c[2 * i + 5] = vcombine_u32(vget_high_u32(q[1].val[i]),
+                                    vget_high_u32(q[3].val[i]));
+    }
+    for (i = 0; i < 8; i++, d += dstep) {
+        vst1q_u16((uint16_t *) d, vreinterpretq_u16_u32(c[i]));
+    }
+}
+
+static GR_ALWAYS_INLINE void rotate_simd(int bpp, unsigned char *dst,
+        int dstride, const unsigned char *src, int sstride, int w, int h,
+        int rotation)
+{
+    const int n = 16 / bpp;     // tile size
+    int xs, ys, x, y, bx, by, bw, bh, tw, th;
+
+    dst = gr_rotate_origin(bpp, dst, dstride, w, h, rotation, &xs, &ys);
+    tw = w - w % n;
+    th = h - h % n;
+
+    if (rotation == 180) {
+        // every row is just reversed
+        for (y = 0; y < h; y++, src += sstride, dst += ys) {
+            for (x = 0; x < tw; x += n) {
+                const unsigned char *s = src + x * bpp;
+                unsigned char *d = dst + (x + n - 1) * xs;
+                if (bpp == 2) {
+                    vst1q_u16((uint16_t *) d,
+                              reverse_16(vld1q_u16((const uint16_t *) s)));
+                } else {
+                    vst1q_u32((uint32_t *) d,
+                              reverse_32(vld1q_u32((const uint32_t *) s)));
+                }
+            }
+            gr_rotate_pixels(bpp, dst + tw * xs, xs, ys, src + tw * bpp,
+                             sstride, w - tw, 1);
+        }
+        return;
+    }
+
+    for (by = 0; by < th; by += GR_ROTATE_BLOCK) {
+        bh = th - by < GR_ROTATE_BLOCK ? th - by : GR_ROTATE_BLOCK;
+        for (bx = 0; bx < tw; bx += GR_ROTATE_BLOCK) {
+            bw = tw - bx < GR_ROTATE_BLOCK ? tw - bx : GR_ROTATE_BLOCK;
+            // down a column of tiles, so that each tile carries on
+            // the dst lines the one before it wrote
+            for (x = bx; x < bx + bw; x += n) {
+                for (y = by; y < by + bh; y += n) {
+                    const unsigned char *s = src + y * sstride + x * bpp;
+                    unsigned char *d = dst + x * xs + y * ys;
+                    int sstep = sstride;
+                    if (rotation == 90) {
+                        // ys < 0: the bottom row of the tile comes first
+                        d += (n - 1) * ys;
+                        s += (n - 1) * sstride;
+                        sstep = -sstride;
+                    }
+                    if (bpp == 2) tile_16(d, xs, s, sstep);
+                    else tile_32(d, xs, s, sstep);
+                }
+            }
+        }
+    }
+    // what is left of the right and bottom edges
+    gr_rotate_pixels(bpp, dst + tw * xs, xs, ys, src + tw * bpp, sstride,
+                     w - tw, h);
+    gr_rotate_pixels(bpp, dst + th * ys, xs, ys, src + th * sstride, sstride,
+                     tw, h - th);
+}
+
+static void rotate_16(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h, int rotation)
+{
+    rotate_simd(2, dst, dstride, src, sstride, w, h, rotation);
+}
+
+static void rotate_32(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h, int rotation)
+{
+    rotate_simd(4, dst, dstride, src, sstride, w, h, rotation);
+}
+
+// Resampling: the byte-wise mixes run in 16-bit lanes; lerp_x fetches
+// each pixel pair with one load while both lie inside the row, and
+// leaves the clamped ends to gr_lerp_pixel().
+static inline uint16x4_t lerp_pair(const unsigned char *p, unsigned f)
+{
+    uint16x8_t t = vmulq_u16(vmovl_u8(vld1_u8(p)),
+                             vcombine_u16(vdup_n_u16(256 - f),
+                                          vdup_n_u16(f)));
+    return vadd_u16(vget_low_u16(t), vget_high_u16(t));
+}
+
+static void lerp_x_32(unsigned char *dst, const unsigned char *src, int sw,
+                      int x, int step, int w)
+{
+    int i = 0;
+
+    for (; i < w; i += 2, x += 2 * step, dst += 8) {
+        int n0 = x >> 16, n1 = (x + step) >> 16;
+        uint16x4_t s0, s1;
+
+        if (i + 2 > w || x < 0 || n1 >= sw - 1) {
+            gr_lerp_pixel(GGL_PIXEL_FORMAT_RGBX_8888, dst, src, sw, x);
+            if (i + 1 < w) {
+                gr_lerp_pixel(GGL_PIXEL_FORMAT_RGBX_8888, dst + 4, src, sw,
+                              x + step);
+            }
+            continue;
+        }
+        s0 = lerp_pair(src + n0 * 4, (x >> 8) & 0xff);
+        s1 = lerp_pair(src + n1 * 4, ((x + step) >> 8) & 0xff);
+        vst1_u8(dst, vrshrn_n_u16(vcombine_u16(s0, s1), 8));
+    }
+}
+
+// Four RGB_565 pixels at a time: each pair is one 32-bit load, and
+// widening it to 8 bits a channel leaves the two values of a channel
+// side by side for a pairwise add.
+static inline uint32x4_t lerp_565(uint16x8_t v, uint16x8_t wt, int shift,
+                                  int bits)
+{
+    v = vandq_u16(vshrq_n_u16(v, shift), vdupq_n_u16((1 << bits) - 1));
+    v = vorrq_u16(vshlq_n_u16(v, 8 - bits), vshrq_n_u16(v, 2 * bits - 8));
+    return vrshrq_n_u32(vpaddlq_u16(vmulq_u16(v, wt)), 8);
+}
+
+static void lerp_x_rgb565(unsigned char *dst, const unsigned char *src,
+                          int sw, int x, int step, int w)
+{
+    int i = 0;
+
+    for (; i < w; i += 4, x += 4 * step, dst += 16) {
+        uint32_t p[4];
+        uint16_t f[8];
+        uint16x8_t v, wt;
+        uint32x4_t c;
+        int k;
+
+        if (i + 4 > w || x < 0 || (x + 3 * step) >> 16 >= sw - 1) {
+            for (k = 0; k < 4 && i + k < w; k++) {
+                gr_lerp_pixel(GGL_PIXEL_FORMAT_RGB_565, dst + k * 4, src, sw,
+                              x + k * step);
+            }
+            continue;
+        }
+        for (k = 0; k < 4; k++) {
+            int xk = x + k * step;
+            memcpy(&p[k], src + (xk >> 16) * 2, 4);
+            f[2 * k + 1] = (xk >> 8) & 0xff;
+            f[2 * k] = 256 - f[2 * k + 1];
+        }
+        v = vreinterpretq_u16_u32(vld1q_u32(p));
+        wt = vld1q_u16(f);
+        c = vorrq_u32(lerp_565(v, wt, 11, 5),
+                      vshlq_n_u32(lerp_565(v, wt, 5, 6), 8));
+        c = vorrq_u32(c, vshlq_n_u32(lerp_565(v, wt, 0, 5), 16));
+        vst1q_u32((uint32_t *) dst, vorrq_u32(c, vdupq_n_u32(0xff000000)));
+    }
+}
+
+static void lerp_y(unsigned char *dst, const unsigned char *a,
+                   const unsigned char *b, int n, unsigned f)
+{
+    const uint8x8_t vf = vdup_n_u8(f);
+    int i = 0;
+
+    // a * 256 + (b - a) * f, which wraps in between but not at the end
+    for (; i + 8 <= n; i += 8) {
+        uint8x8_t va = vld1_u8(a + i);
+        uint16x8_t t = vmlal_u8(vshll_n_u8(va, 8), vld1_u8(b + i), vf);
+        vst1_u8(dst + i, vrshrn_n_u16(vmlsl_u8(t, va, vf), 8));
+    }
+    for (; i < n; i++) dst[i] = gr_lerp8(a[i], b[i], f);
+}
+
+void gr_kernels_simd(GRKernels *k, int format)
+{
+    if (gr_bytes_per_pixel(format) == 2) k->rotate = rotate_16;
+    else k->rotate = rotate_32;
+    if (gr_bytes_per_pixel(format) == 2) k->lerp_x = lerp_x_rgb565;
+    else k->lerp_x = lerp_x_32;
+    k->lerp_y = lerp_y;
+
+    switch (format) {
+    case GGL_PIXEL_FORMAT_RGB_565:
+        k->fill = fill_16;
+        k->fill_blend = fill_blend_rgb565;
+        k->dim = dim_rgb565;
+        k->copy_rgbx = copy_rgbx_rgb565;
+        k->dither_rgbx = dither_rgbx_rgb565;
+        k->blend_rgba = blend_rgba_rgb565;
+        k->blend_pre = blend_pre_rgb565;
+        k->blend_a8 = blend_a8_rgb565;
+        k->blend_a1 = blend_a1_rgb565;
+        break;
+    case GGL_PIXEL_FORMAT_RGBX_8888:
+        // copy_rgbx is a plain memcpy already
+        k->fill = fill_32;
+        k->fill_blend = fill_blend_rgbx8888;
+        k->dim = dim_32;
+        k->blend_rgba = blend_rgba_rgbx8888;
+        k->blend_pre = blend_pre_rgbx8888;
+        k->blend_a8 = blend_a8_rgbx8888;
+        k->blend_a1 = blend_a1_rgbx8888;
+        break;
+    case GGL_PIXEL_FORMAT_BGRA_8888:
+        k->fill = fill_32;
+        k->fill_blend = fill_blend_bgra8888;
+        k->dim = dim_32;
+        k->copy_rgbx = copy_rgbx_bgra8888;
+        k->blend_rgba = blend_rgba_bgra8888;
+        k->blend_pre = blend_pre_bgra8888;
+        k->blend_a8 = blend_a8_bgra8888;
+        k->blend_a1 = blend_a1_bgra8888;
+        break;
+    case GR_PIXEL_FORMAT_ARGB_8888:
+        // the blend kernels assume alpha in the last byte
+        k->fill = fill_32;
+        break;
+    }
+}
+
+#endif
@@ -0,0 +1,974 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SSE2 rasterizer kernels, used when libminui_bm is built for x86.
+// Results are bit-identical to the scalar kernels in blend.c; columns
+// left over after the vector loop go through the same scalar helpers.
+
+#include "graphics.h"
+
+#ifdef GR_HAVE_SSE2
+
+#include <emmintrin.h>
+#include <string.h>
+
+#define ALPHA_MASK 0xff000000
+
+// round(t / 255) per 16-bit lane, where t already includes the +128
+static inline __m128i div255_biased(__m128i t)
+{
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+// s * a + d * (255 - a) for four 32-bit pixels; a holds each pixel's
+// alpha repeated in all four of its bytes.
+static inline __m128i blend_px4(__m128i s, __m128i d, __m128i a)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c255 = _mm_set1_epi16(255);
+    const __m128i c128 = _mm_set1_epi16(128);
+    __m128i a_lo = _mm_unpacklo_epi8(a, zero);
+    __m128i a_hi = _mm_unpackhi_epi8(a, zero);
+    __m128i lo = _mm_add_epi16(
+            _mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), a_lo),
+            _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero),
+                            _mm_sub_epi16(c255, a_lo)));
+    __m128i hi = _mm_add_epi16(
+            _mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), a_hi),
+            _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero),
+                            _mm_sub_epi16(c255, a_hi)));
+    lo = div255_biased(_mm_add_epi16(lo, c128));
+    hi = div255_biased(_mm_add_epi16(hi, c128));
+    return _mm_packus_epi16(lo, hi);
+}
+
+// blend_px4() with the alpha byte set the way gr_blend_pixel() leaves
+// it: pixels with zero alpha keep dst untouched, all others get 0xff.
+static inline __m128i blend_store(__m128i s, __m128i d, __m128i a)
+{
+    __m128i skip = _mm_cmpeq_epi32(a, _mm_setzero_si128());
+    __m128i v = _mm_or_si128(blend_px4(s, d, a), _mm_set1_epi32(ALPHA_MASK));
+    return _mm_or_si128(_mm_andnot_si128(skip, v), _mm_and_si128(skip, d));
+}
+
+// RGBA byte order to BGRA byte order
+static inline __m128i swap_rb(__m128i s)
+{
+    const __m128i ag = _mm_set1_epi32(0xff00ff00);
+    const __m128i ff = _mm_set1_epi32(0xff);
+    return _mm_or_si128(_mm_and_si128(s, ag),
+            _mm_or_si128(_mm_and_si128(_mm_srli_epi32(s, 16), ff),
+                         _mm_slli_epi32(_mm_and_si128(s, ff), 16)));
+}
+
+// unpack eight RGB_565 pixels to 8-bit channels in 16-bit lanes
+static inline void unpack_565(__m128i v, __m128i *r, __m128i *g, __m128i *b)
+{
+    __m128i r5 = _mm_srli_epi16(v, 11);
+    __m128i g6 = _mm_and_si128(_mm_srli_epi16(v, 5), _mm_set1_epi16(0x3f));
+    __m128i b5 = _mm_and_si128(v, _mm_set1_epi16(0x1f));
+    *r = _mm_or_si128(_mm_slli_epi16(r5, 3), _mm_srli_epi16(r5, 2));
+    *g = _mm_or_si128(_mm_slli_epi16(g6, 2), _mm_srli_epi16(g6, 4));
+    *b = _mm_or_si128(_mm_slli_epi16(b5, 3), _mm_srli_epi16(b5, 2));
+}
+
+static inline __m128i pack_565(__m128i r, __m128i g, __m128i b)
+{
+    return _mm_or_si128(_mm_or_si128(
+            _mm_slli_epi16(_mm_srli_epi16(r, 3), 11),
+            _mm_slli_epi16(_mm_srli_epi16(g, 2), 5)),
+            _mm_srli_epi16(b, 3));
+}
+
+// split eight RGBA_8888 pixels, four in s0 and four in s1, into
+// channels in 16-bit lanes
+static inline void split_rgba(__m128i s0, __m128i s1, __m128i *r,
+                              __m128i *g, __m128i *b, __m128i *a)
+{
+    const __m128i ff = _mm_set1_epi32(0xff);
+    *r = _mm_packs_epi32(_mm_and_si128(s0, ff), _mm_and_si128(s1, ff));
+    *g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 8), ff),
+                         _mm_and_si128(_mm_srli_epi32(s1, 8), ff));
+    *b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 16), ff),
+                         _mm_and_si128(_mm_srli_epi32(s1, 16), ff));
+    if (a) {
+        *a = _mm_packs_epi32(_mm_srli_epi32(s0, 24), _mm_srli_epi32(s1, 24));
+    }
+}
+
+static inline void unpack_rgba(const unsigned char *src, __m128i *r,
+                               __m128i *g, __m128i *b, __m128i *a)
+{
+    split_rgba(_mm_loadu_si128((const __m128i *) src),
+               _mm_loadu_si128((const __m128i *) (src + 16)), r, g, b, a);
+}
+
+// s * a + d * (255 - a) for one channel in 16-bit lanes
+static inline __m128i blend_ch(__m128i s, __m128i d, __m128i a)
+{
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(s, a),
+            _mm_mullo_epi16(d, _mm_sub_epi16(_mm_set1_epi16(255), a)));
+    return div255_biased(_mm_add_epi16(t, _mm_set1_epi16(128)));
+}
+
+static inline __m128i blend_565(__m128i v, __m128i r, __m128i g, __m128i b,
+                                __m128i a)
+{
+    __m128i dr, dg, db;
+    unpack_565(v, &dr, &dg, &db);
+    return pack_565(blend_ch(r, dr, a), blend_ch(g, dg, a),
+                    blend_ch(b, db, a));
+}
+
+static void fill_16(unsigned char *dst, int dstride, int w, int h,
+                    unsigned pixel)
+{
+    const __m128i v = _mm_set1_epi16(pixel);
+    int x;
+
+    for (; h > 0; h--, dst += dstride) {
+        unsigned short *p = (unsigned short *) dst;
+        for (x = 0; x + 8 <= w; x += 8) {
+            _mm_storeu_si128((__m128i *) (p + x), v);
+        }
+        for (; x < w; x++) p[x] = pixel;
+    }
+}
+
+static void fill_32(unsigned char *dst, int dstride, int w, int h,
+                    unsigned pixel)
+{
+    const __m128i v = _mm_set1_epi32(pixel);
+    int x;
+
+    for (; h > 0; h--, dst += dstride) {
+        unsigned *p = (unsigned *) dst;
+        for (x = 0; x + 4 <= w; x += 4) {
+            _mm_storeu_si128((__m128i *) (p + x), v);
+        }
+        for (; x < w; x++) p[x] = pixel;
+    }
+}
+
+static GR_ALWAYS_INLINE void fill_blend_32(int format, unsigned char *dst,
+        int dstride, int w, int h, const GRColor *c)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha = _mm_set1_epi32(ALPHA_MASK);
+    const __m128i ia = _mm_set1_epi16(255 - c->a);
+    const __m128i sa = _mm_add_epi16(_mm_mullo_epi16(
+            _mm_unpacklo_epi8(_mm_set1_epi32(gr_pack_pixel(format, c)), zero),
+            _mm_set1_epi16(c->a)), _mm_set1_epi16(128));
+    int x;
+
+    if (c->a == 0) return;
+    for (; h > 0; h--, dst += dstride) {
+        for (x = 0; x + 4 <= w; x += 4) {
+            __m128i *p = (__m128i *) (dst + x * 4);
+            __m128i d = _mm_loadu_si128(p);
+            __m128i lo = _mm_add_epi16(
+                    _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), ia), sa);
+            __m128i hi = _mm_add_epi16(
+                    _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), ia), sa);
+            d = _mm_packus_epi16(div255_biased(lo), div255_biased(hi));
+            _mm_storeu_si128(p, _mm_or_si128(d, alpha));
+        }
+        for (; x < w; x++) {
+            gr_blend_pixel(format, dst + x * 4, c->r, c->g, c->b, c->a);
+        }
+    }
+}
+
+static void fill_blend_rgbx8888(unsigned char *dst, int dstride, int w,
+                                int h, const GRColor *c)
+{
+    fill_blend_32(GGL_PIXEL_FORMAT_RGBX_8888, dst, dstride, w, h, c);
+}
+
+static void fill_blend_bgra8888(unsigned char *dst, int dstride, int w,
+                                int h, const GRColor *c)
+{
+    fill_blend_32(GGL_PIXEL_FORMAT_BGRA_8888, dst, dstride, w, h, c);
+}
+
+static void fill_blend_rgb565(unsigned char *dst, int dstride, int w, int h,
+                              const GRColor *c)
+{
+    const __m128i a = _mm_set1_epi16(c->a);
+    const __m128i r = _mm_set1_epi16(c->r);
+    const __m128i g = _mm_set1_epi16(c->g);
+    const __m128i b = _mm_set1_epi16(c->b);
+    int x;
+
+    if (c->a == 0) return;
+    for (; h > 0; h--, dst += dstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            __m128i *p = (__m128i *) (dst + x * 2);
+            _mm_storeu_si128(p, blend_565(_mm_loadu_si128(p), r, g, b, a));
+        }
+        for (; x < w; x++) {
+            gr_blend_pixel(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                           c->r, c->g, c->b, c->a);
+        }
+    }
+}
+
+static void dim_32(unsigned char *dst, int dstride, int w, int h,
+                   unsigned scale)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha = _mm_set1_epi32(ALPHA_MASK);
+    const __m128i c128 = _mm_set1_epi16(128);
+    const __m128i s = _mm_set1_epi16(scale);
+    unsigned char *p;
+    int x;
+
+    for (; h > 0; h--, dst += dstride) {
+        for (x = 0; x + 4 <= w; x += 4) {
+            __m128i *q = (__m128i *) (dst + x * 4);
+            __m128i d = _mm_loadu_si128(q);
+            __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), s);
+            __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), s);
+            lo = div255_biased(_mm_add_epi16(lo, c128));
+            hi = div255_biased(_mm_add_epi16(hi, c128));
+            _mm_storeu_si128(q, _mm_or_si128(_mm_packus_epi16(lo, hi), alpha));
+        }
+        // the channel order does not matter when all are scaled alike
+        for (p = dst + x * 4; x < w; x++, p += 4) {
+            p[0] = gr_div255(p[0] * scale);
+            p[1] = gr_div255(p[1] * scale);
+            p[2] = gr_div255(p[2] * scale);
+            p[3] = 0xff;
+        }
+    }
+}
+
+static void dim_rgb565(unsigned char *dst, int dstride, int w, int h,
+                       unsigned scale)
+{
+    const __m128i c128 = _mm_set1_epi16(128);
+    const __m128i s = _mm_set1_epi16(scale);
+    __m128i r, g, b;
+    unsigned dr, dg, db;
+    int x;
+
+    for (; h > 0; h--, dst += dstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            __m128i *p = (__m128i *) (dst + x * 2);
+            unpack_565(_mm_loadu_si128(p), &r, &g, &b);
+            r = div255_biased(_mm_add_epi16(_mm_mullo_epi16(r, s), c128));
+            g = div255_biased(_mm_add_epi16(_mm_mullo_epi16(g, s), c128));
+            b = div255_biased(_mm_add_epi16(_mm_mullo_epi16(b, s), c128));
+            _mm_storeu_si128(p, pack_565(r, g, b));
+        }
+        for (; x < w; x++) {
+            unsigned char *p = dst + x * 2;
+            gr_load(GGL_PIXEL_FORMAT_RGB_565, p, &dr, &dg, &db);
+            gr_store(GGL_PIXEL_FORMAT_RGB_565, p, gr_div255(dr * scale),
+                     gr_div255(dg * scale), gr_div255(db * scale));
+        }
+    }
+}
+
+static void copy_rgbx_bgra8888(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    const __m128i alpha = _mm_set1_epi32(ALPHA_MASK);
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        for (x = 0; x + 4 <= w; x += 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) (src + x * 4));
+            _mm_storeu_si128((__m128i *) (dst + x * 4),
+                             _mm_or_si128(swap_rb(s), alpha));
+        }
+        for (; x < w; x++) {
+            const unsigned char *s = src + x * 4;
+            gr_store(GGL_PIXEL_FORMAT_BGRA_8888, dst + x * 4,
+                     s[0], s[1], s[2]);
+        }
+    }
+}
+
+static void copy_rgbx_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    __m128i r, g, b;
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            unpack_rgba(src + x * 4, &r, &g, &b, NULL);
+            _mm_storeu_si128((__m128i *) (dst + x * 2), pack_565(r, g, b));
+        }
+        for (; x < w; x++) {
+            const unsigned char *s = src + x * 4;
+            gr_store(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2, s[0], s[1], s[2]);
+        }
+    }
+}
+
+static void dither_rgbx_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    __m128i r, g, b;
+    int x, y;
+
+    for (y = 0; y < h; y++, dst += dstride, src += sstride) {
+        // four pixels per register, so every one gets the whole row
+        const __m128i d =
+                _mm_loadu_si128((const __m128i *) gr_dither_rgbx[y & 3]);
+        for (x = 0; x + 8 <= w; x += 8) {
+            const __m128i *s = (const __m128i *) (src + x * 4);
+            split_rgba(_mm_adds_epu8(_mm_loadu_si128(s), d),
+                       _mm_adds_epu8(_mm_loadu_si128(s + 1), d),
+                       &r, &g, &b, NULL);
+            _mm_storeu_si128((__m128i *) (dst + x * 2), pack_565(r, g, b));
+        }
+        for (; x < w; x++) gr_store_dither(dst + x * 2, src + x * 4, x, y);
+    }
+}
+
+static GR_ALWAYS_INLINE void blend_rgba_32(int format, unsigned char *dst,
+        int dstride, const unsigned char *src, int sstride, int w, int h)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha = _mm_set1_epi32(ALPHA_MASK);
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        for (x = 0; x + 4 <= w; x += 4) {
+            __m128i *p = (__m128i *) (dst + x * 4);
+            __m128i s = _mm_loadu_si128((const __m128i *) (src + x * 4));
+            __m128i a = _mm_and_si128(s, alpha);
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, zero)) == 0xffff)
+                continue;
+            if (format == GGL_PIXEL_FORMAT_BGRA_8888)
+                s = swap_rb(s);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, alpha)) == 0xffff) {
+                _mm_storeu_si128(p, _mm_or_si128(s, alpha));
+                continue;
+            }
+            a = _mm_srli_epi32(a, 24);
+            a = _mm_or_si128(a, _mm_slli_epi32(a, 8));
+            a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+            _mm_storeu_si128(p, blend_store(s, _mm_loadu_si128(p), a));
+        }
+        for (; x < w; x++) {
+            const unsigned char *s = src + x * 4;
+            gr_blend_pixel(format, dst + x * 4, s[0], s[1], s[2], s[3]);
+        }
+    }
+}
+
+static void blend_rgba_rgbx8888(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    blend_rgba_32(GGL_PIXEL_FORMAT_RGBX_8888, dst, dstride, src, sstride,
+                  w, h);
+}
+
+static void blend_rgba_bgra8888(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    blend_rgba_32(GGL_PIXEL_FORMAT_BGRA_8888, dst, dstride, src, sstride,
+                  w, h);
+}
+
+static void blend_rgba_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    const __m128i opaque = _mm_set1_epi16(255);
+    __m128i r, g, b, a;
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            __m128i *p = (__m128i *) (dst + x * 2);
+            unpack_rgba(src + x * 4, &r, &g, &b, &a);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(a, opaque)) == 0xffff) {
+                _mm_storeu_si128(p, pack_565(r, g, b));
+            } else if (_mm_movemask_epi8(_mm_cmpeq_epi16(a,
+                        _mm_setzero_si128())) != 0xffff) {
+                _mm_storeu_si128(p, blend_565(_mm_loadu_si128(p),
+                                              r, g, b, a));
+            }
+        }
+        for (; x < w; x++) {
+            const unsigned char *s = src + x * 4;
+            gr_blend_pixel(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                           s[0], s[1], s[2], s[3]);
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void blend_pre_32(int format, unsigned char *dst,
+        int dstride, const unsigned char *src, int sstride, int w, int h)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha = _mm_set1_epi32(ALPHA_MASK);
+    const __m128i c128 = _mm_set1_epi16(128);
+    unsigned r, g, b, a;
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        for (x = 0; x + 4 <= w; x += 4) {
+            __m128i *p = (__m128i *) (dst + x * 4);
+            __m128i s = _mm_loadu_si128((const __m128i *) (src + x * 4));
+            __m128i sa = _mm_and_si128(s, alpha);
+            __m128i d, ia, skip, lo, hi;
+
+            skip = _mm_cmpeq_epi32(sa, zero);
+            if (_mm_movemask_epi8(skip) == 0xffff) continue;
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, alpha)) == 0xffff) {
+                _mm_storeu_si128(p, s);
+                continue;
+            }
+            ia = _mm_srli_epi32(sa, 24);
+            ia = _mm_or_si128(ia, _mm_slli_epi32(ia, 8));
+            ia = _mm_or_si128(ia, _mm_slli_epi32(ia, 16));
+            ia = _mm_xor_si128(ia, _mm_set1_epi32(-1));
+            d = _mm_loadu_si128(p);
+            lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero),
+                                 _mm_unpacklo_epi8(ia, zero));
+            hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero),
+                                 _mm_unpackhi_epi8(ia, zero));
+            lo = div255_biased(_mm_add_epi16(lo, c128));
+            hi = div255_biased(_mm_add_epi16(hi, c128));
+            s = _mm_or_si128(_mm_adds_epu8(s, _mm_packus_epi16(lo, hi)),
+                             alpha);
+            _mm_storeu_si128(p, _mm_or_si128(_mm_andnot_si128(skip, s),
+                                             _mm_and_si128(skip, d)));
+        }
+        for (; x < w; x++) {
+            gr_load_pre(format, src + x * 4, &r, &g, &b, &a);
+            gr_blend_pre_pixel(format, dst + x * 4, r, g, b, a);
+        }
+    }
+}
+
+static void blend_pre_rgbx8888(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    blend_pre_32(GGL_PIXEL_FORMAT_RGBX_8888, dst, dstride, src, sstride,
+                 w, h);
+}
+
+static void blend_pre_bgra8888(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    blend_pre_32(GGL_PIXEL_FORMAT_BGRA_8888, dst, dstride, src, sstride,
+                 w, h);
+}
+
+// premultiplied s + d * (255 - a) for one channel in 16-bit lanes
+static inline __m128i over_ch(__m128i s, __m128i d, __m128i ia)
+{
+    return _mm_add_epi16(s, div255_biased(_mm_add_epi16(
+            _mm_mullo_epi16(d, ia), _mm_set1_epi16(128))));
+}
+
+static void blend_pre_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h)
+{
+    const __m128i opaque = _mm_set1_epi16(255);
+    __m128i r, g, b, a, dr, dg, db;
+    unsigned sr, sg, sb, sa;
+    int x;
+
+    for (; h > 0; h--, dst += dstride, src += sstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            __m128i *p = (__m128i *) (dst + x * 2);
+            unpack_rgba(src + x * 4, &r, &g, &b, &a);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(a, opaque)) == 0xffff) {
+                _mm_storeu_si128(p, pack_565(r, g, b));
+                continue;
+            }
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(a,
+                        _mm_setzero_si128())) == 0xffff) {
+                continue;
+            }
+            a = _mm_sub_epi16(opaque, a);
+            unpack_565(_mm_loadu_si128(p), &dr, &dg, &db);
+            _mm_storeu_si128(p, pack_565(over_ch(r, dr, a),
+                    over_ch(g, dg, a), over_ch(b, db, a)));
+        }
+        for (; x < w; x++) {
+            gr_load_pre(GGL_PIXEL_FORMAT_RGB_565, src + x * 4,
+                        &sr, &sg, &sb, &sa);
+            gr_blend_pre_pixel(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                               sr, sg, sb, sa);
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void blend_a8_32(int format, unsigned char *dst,
+        int dstride, const unsigned char *mask, int mstride, int w, int h,
+        const GRColor *c)
+{
+    const __m128i color = _mm_set1_epi32(gr_pack_pixel(format, c));
+    unsigned m;
+    int x;
+
+    for (; h > 0; h--, dst += dstride, mask += mstride) {
+        for (x = 0; x + 4 <= w; x += 4) {
+            __m128i *p = (__m128i *) (dst + x * 4);
+            __m128i a;
+
+            memcpy(&m, mask + x, 4);
+            if (m == 0) continue;
+            if (m == 0xffffffff) {
+                _mm_storeu_si128(p, color);
+                continue;
+            }
+            a = _mm_cvtsi32_si128(m);
+            a = _mm_unpacklo_epi8(a, a);
+            a = _mm_unpacklo_epi16(a, a);
+            _mm_storeu_si128(p, blend_store(color, _mm_loadu_si128(p), a));
+        }
+        for (; x < w; x++) {
+            gr_blend_pixel(format, dst + x * 4, c->r, c->g, c->b, mask[x]);
+        }
+    }
+}
+
+static void blend_a8_rgbx8888(unsigned char *dst, int dstride,
+        const unsigned char *mask, int mstride, int w, int h,
+        const GRColor *c)
+{
+    blend_a8_32(GGL_PIXEL_FORMAT_RGBX_8888, dst, dstride, mask, mstride,
+                w, h, c);
+}
+
+static void blend_a8_bgra8888(unsigned char *dst, int dstride,
+        const unsigned char *mask, int mstride, int w, int h,
+        const GRColor *c)
+{
+    blend_a8_32(GGL_PIXEL_FORMAT_BGRA_8888, dst, dstride, mask, mstride,
+                w, h, c);
+}
+
+static void blend_a8_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *mask, int mstride, int w, int h,
+        const GRColor *c)
+{
+    const __m128i color = _mm_set1_epi16(
+            gr_pack_pixel(GGL_PIXEL_FORMAT_RGB_565, c));
+    const __m128i r = _mm_set1_epi16(c->r);
+    const __m128i g = _mm_set1_epi16(c->g);
+    const __m128i b = _mm_set1_epi16(c->b);
+    unsigned long long m;
+    int x;
+
+    for (; h > 0; h--, dst += dstride, mask += mstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            __m128i *p = (__m128i *) (dst + x * 2);
+
+            memcpy(&m, mask + x, 8);
+            if (m == 0) continue;
+            if (m == ~0ULL) {
+                _mm_storeu_si128(p, color);
+                continue;
+            }
+            _mm_storeu_si128(p, blend_565(_mm_loadu_si128(p), r, g, b,
+                    _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)
+                            (mask + x)), _mm_setzero_si128())));
+        }
+        for (; x < w; x++) {
+            gr_blend_pixel(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                           c->r, c->g, c->b, mask[x]);
+        }
+    }
+}
+
+static GR_ALWAYS_INLINE void blend_a1_32(int format, unsigned char *dst,
+        int dstride, const unsigned char *bits, int bstride, int bx, int w,
+        int h, const GRColor *c)
+{
+    const __m128i color = _mm_set1_epi32(gr_pack_pixel(format, c));
+    const __m128i sel_lo = _mm_set_epi32(0x10, 0x20, 0x40, 0x80);
+    const __m128i sel_hi = _mm_set_epi32(0x01, 0x02, 0x04, 0x08);
+    int x;
+
+    for (; h > 0; h--, dst += dstride, bits += bstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            __m128i *p = (__m128i *) (dst + x * 4);
+            unsigned m = gr_bits8(bits, bx + x);
+            __m128i v = _mm_set1_epi32(m), a;
+
+            if (m == 0) continue;
+            a = _mm_cmpeq_epi32(_mm_and_si128(v, sel_lo), sel_lo);
+            _mm_storeu_si128(p, _mm_or_si128(_mm_and_si128(a, color),
+                    _mm_andnot_si128(a, _mm_loadu_si128(p))));
+            a = _mm_cmpeq_epi32(_mm_and_si128(v, sel_hi), sel_hi);
+            _mm_storeu_si128(p + 1, _mm_or_si128(_mm_and_si128(a, color),
+                    _mm_andnot_si128(a, _mm_loadu_si128(p + 1))));
+        }
+        for (; x < w; x++) {
+            if (gr_bit(bits, bx + x))
+                gr_store(format, dst + x * 4, c->r, c->g, c->b);
+        }
+    }
+}
+
+static void blend_a1_rgbx8888(unsigned char *dst, int dstride,
+        const unsigned char *bits, int bstride, int bx, int w, int h,
+        const GRColor *c)
+{
+    blend_a1_32(GGL_PIXEL_FORMAT_RGBX_8888, dst, dstride, bits, bstride, bx,
+                w, h, c);
+}
+
+static void blend_a1_bgra8888(unsigned char *dst, int dstride,
+        const unsigned char *bits, int bstride, int bx, int w, int h,
+        const GRColor *c)
+{
+    blend_a1_32(GGL_PIXEL_FORMAT_BGRA_8888, dst, dstride, bits, bstride, bx,
+                w, h, c);
+}
+
+static void blend_a1_rgb565(unsigned char *dst, int dstride,
+        const unsigned char *bits, int bstride, int bx, int w, int h,
+        const GRColor *c)
+{
+    const __m128i color = _mm_set1_epi16(
+            gr_pack_pixel(GGL_PIXEL_FORMAT_RGB_565, c));
+    const __m128i sel = _mm_set_epi16(0x01, 0x02, 0x04, 0x08,
+                                      0x10, 0x20, 0x40, 0x80);
+    int x;
+
+    for (; h > 0; h--, dst += dstride, bits += bstride) {
+        for (x = 0; x + 8 <= w; x += 8) {
+            __m128i *p = (__m128i *) (dst + x * 2);
+            unsigned m = gr_bits8(bits, bx + x);
+            __m128i a;
+
+            if (m == 0) continue;
+            a = _mm_set1_epi16(m);
+            a = _mm_cmpeq_epi16(_mm_and_si128(a, sel), sel);
+            _mm_storeu_si128(p, _mm_or_si128(_mm_and_si128(a, color),
+                    _mm_andnot_si128(a, _mm_loadu_si128(p))));
+        }
+        for (; x < w; x++) {
+            if (gr_bit(bits, bx + x))
+                gr_store(GGL_PIXEL_FORMAT_RGB_565, dst + x * 2,
+                         c->r, c->g, c->b);
+        }
+    }
+}
+
+// Turned blocks are walked in squares of GR_ROTATE_BLOCK (see blend.c),
+// each cut into tiles that are transposed in registers: 4x4 pixels at
+// 32 bits, 8x8 at 16.  Loading the tile rows bottom up makes the
+// transpose come out turned by 90 rather than 270 degrees.
+#define GR_ROTATE_BLOCK 32
+
+static inline __m128i reverse_32(__m128i v)
+{
+    return _mm_shuffle_epi32(v, 0x1b);
+}
+
+static inline __m128i reverse_16(__m128i v)
+{
+    v = _mm_shufflelo_epi16(v, 0x1b);
+    v = _mm_shufflehi_epi16(v, 0x1b);
+    return _mm_shuffle_epi32(v, 0x4e);
+}
+
+static inline void tile_32(unsigned char *d, int dstep, const unsigned char *s,
+                    int sstep)
+{
+    __m128i r0 = _mm_loadu_si128((const __m128i *) s);
+    __m128i r1 = _mm_loadu_si128((const __m128i *) (s + sstep));
+    __m128i r2 = _mm_loadu_si128((const __m128i *) (s + 2 * sstep));
+    __m128i r3 = _mm_loadu_si128((const __m128i *) (s + 3 * sstep));
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+    __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+    __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+    __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+    _mm_storeu_si128((__m128i *) d, _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *) (d + dstep), _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *) (d + 2 * dstep), _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128((__m128i *) (d + 3 * dstep), _mm_unpackhi_epi64(t2, t3));
+}
+
+static inline void tile_16(unsigned char *d, int dstep, const unsigned char *s,
+                    int sstep)
+{
+    __m128i r[8], t[8], u[8];
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        r[i] = _mm_loadu_si128((const __m128i *) (s + i * sstep));
+    }
+    for (i = 0; i < 4; i++) {
+        t[i] = _mm_unpacklo_epi16(r[2 * i], r[2 * i + 1]);
+        t[i + 4] = _mm_unpackhi_epi16(r[2 * i], r[2 * i + 1]);
+    }
+    // u[0..3]: columns 0-1 and 2-3 of rows 0-3, then of rows 4-7
+    for (i = 0; i < 8; i += 4) {
+        u[i] = _mm_unpacklo_epi32(t[i], t[i + 1]);
+        u[i + 1] = _mm_unpackhi_epi32(t[i], t[i + 1]);
+        u[i + 2] = _mm_unpacklo_epi32(t[i + 2], t[i + 3]);
+        u[i + 3] = _mm_unpackhi_epi32(t[i + 2], t[i + 3]);
+    }
+    for (i = 0; i < 8; i += 4) {
+        _mm_storeu_si128((__m128i *) d, _mm_unpacklo_epi64(u[i], u[i + 2]));
+        d += dstep;
+        _mm_storeu_si128((__m128i *) d, _mm_unpackhi_epi64(u[i], u[i + 2]));
+        d += dstep;
+        _mm_storeu_si128((__m128i *) d,
+                         _mm_unpacklo_epi64(u[i + 1], u[i + 3]));
+        d += dstep;
+        _mm_storeu_si128((__m128i *) d,
+                         _mm_unpackhi_epi64(u[i + 1], u[i + 3]));
+        d += dstep;
+    }
+}
+
+static GR_ALWAYS_INLINE void rotate_simd(int bpp, unsigned char *dst,
+        int dstride, const unsigned char *src, int sstride, int w, int h,
+        int rotation)
+{
+    const int n = 16 / bpp;     // tile size
+    int xs, ys, x, y, bx, by, bw, bh, tw, th;
+
+    dst = gr_rotate_origin(bpp, dst, dstride, w, h, rotation, &xs, &ys);
+    tw = w - w % n;
+    th = h - h % n;
+
+    if (rotation == 180) {
+        // every row is just reversed
+        for (y = 0; y < h; y++, src += sstride, dst += ys) {
+            for (x = 0; x < tw; x += n) {
+                __m128i v = _mm_loadu_si128((const __m128i *) (src + x * bpp));
+                v = bpp == 2 ? reverse_16(v) : reverse_32(v);
+                _mm_storeu_si128((__m128i *) (dst + (x + n - 1) * xs), v);
+            }
+            gr_rotate_pixels(bpp, dst + tw * xs, xs, ys, src + tw * bpp,
+                             sstride, w - tw, 1);
+        }
+        return;
+    }
+
+    for (by = 0; by < th; by += GR_ROTATE_BLOCK) {
+        bh = th - by < GR_ROTATE_BLOCK ? th - by : GR_ROTATE_BLOCK;
+        for (bx = 0; bx < tw; bx += GR_ROTATE_BLOCK) {
+            bw = tw - bx < GR_ROTATE_BLOCK ? tw - bx : GR_ROTATE_BLOCK;
+            // down a column of tiles, so that each tile carries on
+            // the dst lines the one before it wrote
+            for (x = bx; x < bx + bw; x += n) {
+                for (y = by; y < by + bh; y += n) {
+                    const unsigned char *s = src + y * sstride + x * bpp;
+                    unsigned char *d = dst + x * xs + y * ys;
+                    int sstep = sstride;
+                    if (rotation == 90) {
+                        // ys < 0: the bottom row of the tile comes first
+                        d += (n - 1) * ys;
+                        s += (n - 1) * sstride;
+                        sstep = -sstride;
+                    }
+                    if (bpp == 2) tile_16(d, xs, s, sstep);
+                    else tile_32(d, xs, s, sstep);
+                }
+            }
+        }
+    }
+    // what is left of the right and bottom edges
+    gr_rotate_pixels(bpp, dst + tw * xs, xs, ys, src + tw * bpp, sstride,
+                     w - tw, h);
+    gr_rotate_pixels(bpp, dst + th * ys, xs, ys, src + th * sstride, sstride,
+                     tw, h - th);
+}
+
+static void rotate_16(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h, int rotation)
+{
+    rotate_simd(2, dst, dstride, src, sstride, w, h, rotation);
+}
+
+static void rotate_32(unsigned char *dst, int dstride,
+        const unsigned char *src, int sstride, int w, int h, int rotation)
+{
+    rotate_simd(4, dst, dstride, src, sstride, w, h, rotation);
+}
+
+// Resampling: the byte-wise mixes run eight 16-bit lanes at a time;
+// lerp_x fetches each pixel pair with one load while both lie inside
+// the row, and leaves the clamped ends to gr_lerp_pixel().
+static void lerp_x_32(unsigned char *dst, const unsigned char *src, int sw,
+                      int x, int step, int w)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i half = _mm_set1_epi32(128);
+    int i = 0;
+
+    for (; i < w; i += 2, x += 2 * step, dst += 8) {
+        int n0 = x >> 16, n1 = (x + step) >> 16;
+        unsigned f0 = (x >> 8) & 0xff, f1 = ((x + step) >> 8) & 0xff;
+        __m128i p0, p1, q, m0, m1;
+
+        if (i + 2 > w || x < 0 || n1 >= sw - 1) {
+            gr_lerp_pixel(GGL_PIXEL_FORMAT_RGBX_8888, dst, src, sw, x);
+            if (i + 1 < w) {
+                gr_lerp_pixel(GGL_PIXEL_FORMAT_RGBX_8888, dst + 4, src, sw,
+                              x + step);
+            }
+            continue;
+        }
+        // each pixel next to the one after it, byte by byte, so that
+        // one multiply-add per channel mixes them
+        p0 = _mm_loadl_epi64((const __m128i *) (src + n0 * 4));
+        p1 = _mm_loadl_epi64((const __m128i *) (src + n1 * 4));
+        p0 = _mm_unpacklo_epi8(p0, _mm_srli_si128(p0, 4));
+        p1 = _mm_unpacklo_epi8(p1, _mm_srli_si128(p1, 4));
+        q = _mm_unpacklo_epi64(p0, p1);
+        m0 = _mm_madd_epi16(_mm_unpacklo_epi8(q, zero),
+                            _mm_set1_epi32(f0 << 16 | (256 - f0)));
+        m1 = _mm_madd_epi16(_mm_unpackhi_epi8(q, zero),
+                            _mm_set1_epi32(f1 << 16 | (256 - f1)));
+        m0 = _mm_srli_epi32(_mm_add_epi32(m0, half), 8);
+        m1 = _mm_srli_epi32(_mm_add_epi32(m1, half), 8);
+        q = _mm_packs_epi32(m0, m1);
+        _mm_storel_epi64((__m128i *) dst, _mm_packus_epi16(q, q));
+    }
+}
+
+// Four RGB_565 pixels at a time: each pair is one 32-bit load, and
+// widening it to 8 bits a channel leaves the two values of a channel
+// side by side for the multiply-add.
+static inline __m128i widen_565(__m128i v, int shift, int bits)
+{
+    v = _mm_and_si128(_mm_srli_epi16(v, shift),
+                      _mm_set1_epi16((1 << bits) - 1));
+    return _mm_or_si128(_mm_slli_epi16(v, 8 - bits),
+                        _mm_srli_epi16(v, 2 * bits - 8));
+}
+
+static void lerp_x_rgb565(unsigned char *dst, const unsigned char *src,
+                          int sw, int x, int step, int w)
+{
+    const __m128i half = _mm_set1_epi32(128);
+    int i = 0;
+
+    for (; i < w; i += 4, x += 4 * step, dst += 16) {
+        unsigned p[4], f[4];
+        __m128i v, wt, r, g, b;
+        int k;
+
+        if (i + 4 > w || x < 0 || (x + 3 * step) >> 16 >= sw - 1) {
+            for (k = 0; k < 4 && i + k < w; k++) {
+                gr_lerp_pixel(GGL_PIXEL_FORMAT_RGB_565, dst + k * 4, src, sw,
+                              x + k * step);
+            }
+            continue;
+        }
+        for (k = 0; k < 4; k++) {
+            int xk = x + k * step;
+            memcpy(&p[k], src + (xk >> 16) * 2, 4);
+            f[k] = (xk >> 8) & 0xff;
+            f[k] = f[k] << 16 | (256 - f[k]);
+        }
+        v = _mm_loadu_si128((const __m128i *) p);
+        wt = _mm_loadu_si128((const __m128i *) f);
+        r = _mm_madd_epi16(widen_565(v, 11, 5), wt);
+        g = _mm_madd_epi16(widen_565(v, 5, 6), wt);
+        b = _mm_madd_epi16(widen_565(v, 0, 5), wt);
+        r = _mm_srli_epi32(_mm_add_epi32(r, half), 8);
+        g = _mm_srli_epi32(_mm_add_epi32(g, half), 8);
+        b = _mm_srli_epi32(_mm_add_epi32(b, half), 8);
+        v = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                         _mm_or_si128(_mm_slli_epi32(b, 16),
+                                      _mm_set1_epi32(ALPHA_MASK)));
+        _mm_storeu_si128((__m128i *) dst, v);
+    }
+}
+
+static void lerp_y(unsigned char *dst, const unsigned char *a,
+                   const unsigned char *b, int n, unsigned f)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i wa = _mm_set1_epi16(256 - f);
+    const __m128i wb = _mm_set1_epi16(f);
+    const __m128i half = _mm_set1_epi16(128);
+    int i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *) (a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *) (b + i));
+        __m128i lo = _mm_add_epi16(
+                _mm_mullo_epi16(_mm_unpacklo_epi8(va, zero), wa),
+                _mm_mullo_epi16(_mm_unpacklo_epi8(vb, zero), wb));
+        __m128i hi = _mm_add_epi16(
+                _mm_mullo_epi16(_mm_unpackhi_epi8(va, zero), wa),
+                _mm_mullo_epi16(_mm_unpackhi_epi8(vb, zero), wb));
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, half), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, half), 8);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_packus_epi16(lo, hi));
+    }
+    for (; i < n; i++) dst[i] = gr_lerp8(a[i], b[i], f);
+}
+
+void gr_kernels_simd(GRKernels *k, int format)
+{
+    if (gr_bytes_per_pixel(format) == 2) k->rotate = rotate_16;
+    else k->rotate = rotate_32;
+    if (gr_bytes_per_pixel(format) == 2) k->lerp_x = lerp_x_rgb565;
+    else k->lerp_x = lerp_x_32;
+    k->lerp_y = lerp_y;
+
+    switch (format) {
+    case GGL_PIXEL_FORMAT_RGB_565:
+        k->fill = fill_16;
+        k->fill_blend = fill_blend_rgb565;
+        k->dim = dim_rgb565;
+        k->copy_rgbx = copy_rgbx_rgb565;
+        k->dither_rgbx = dither_rgbx_rgb565;
+        k->blend_rgba = blend_rgba_rgb565;
+        k->blend_pre = blend_pre_rgb565;
+        k->blend_a8 = blend_a8_rgb565;
+        k->blend_a1 = blend_a1_rgb565;
+        break;
+    case GGL_PIXEL_FORMAT_RGBX_8888:
+        // copy_rgbx is a plain memcpy already
+        k->fill = fill_32;
+        k->fill_blend = fill_blend_rgbx8888;
+        k->dim = dim_32;
+        k->blend_rgba = blend_rgba_rgbx8888;
+        k->blend_pre = blend_pre_rgbx8888;
+        k->blend_a8 = blend_a8_rgbx8888;
+        k->blend_a1 = blend_a1_rgbx8888;
+        break;
+    case GGL_PIXEL_FORMAT_BGRA_8888:
+        k->fill = fill_32;
+        k->fill_blend = fill_blend_bgra8888;
+        k->dim = dim_32;
+        k->copy_rgbx = copy_rgbx_bgra8888;
+        k->blend_rgba = blend_rgba_bgra8888;
+        k->blend_pre = blend_pre_bgra8888;
+        k->blend_a8 = blend_a8_bgra8888;
+        k->blend_a1 = blend_a1_bgra8888;
+        break;
+    case GR_PIXEL_FORMAT_ARGB_8888:
+        // the blend kernels assume alpha in the last byte
+        k->fill = fill_32;
+        break;
+    }
+}
+
+#endif
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Glyphs beyond the ASCII strip of the built-in font.  They come from a
+// compact table of Source Code Pro (SIL Open Font License 1.1) drawn in
+// the same 15x24 cell (mkglyphs.c), and are unpacked on first use into a
+// fixed 1-bpp atlas.  A hash of code points finds a cached glyph in O(1);
+// when the atlas is full the least recently used glyph makes room.
+
+#include <string.h>
+
+#include "minui.h"
+#include "graphics.h"
+#include "sourcecodepro_15x24.h"
+
+#define GR_GLYPH_SLOTS    128
+#define GR_GLYPH_BUCKETS  256   // power of two
+#define GR_ATLAS_STRIDE   ((GR_GLYPH_SLOTS * GLYPHS_CWIDTH + 7) / 8)
+
+typedef struct {
+    unsigned cp;
+    unsigned used;      // gr_glyph_clock at the last hit; 0 if free
+    int next;           // next slot + 1 in the same bucket; 0 ends it
+} GRGlyphSlot;
+
+static GRGlyphSlot gr_glyph_slots[GR_GLYPH_SLOTS];
+static int gr_glyph_buckets[GR_GLYPH_BUCKETS];  // first slot + 1, or 0
+static unsigned gr_glyph_clock = 0;
+static unsigned char gr_atlas[GLYPHS_CHEIGHT * GR_ATLAS_STRIDE];
+
+unsigned gr_utf8_next(const char **s)
+{
+    const unsigned char *p = (const unsigned char *) *s;
+    unsigned cp, min;
+    int n, i;
+
+    if (p[0] < 0x80) {
+        if (p[0]) (*s)++;
+        return p[0];
+    }
+    if ((p[0] & 0xe0) == 0xc0) {
+        cp = p[0] & 0x1f; n = 1; min = 0x80;
+    } else if ((p[0] & 0xf0) == 0xe0) {
+        cp = p[0] & 0x0f; n = 2; min = 0x800;
+    } else if ((p[0] & 0xf8) == 0xf0) {
+        cp = p[0] & 0x07; n = 3; min = 0x10000;
+    } else {
+        (*s)++;
+        return 0xfffd;
+    }
+    for (i = 1; i <= n; i++) {
+        if ((p[i] & 0xc0) != 0x80) {
+            // truncated: resume at the byte that broke the sequence
+            *s += i;
+            return 0xfffd;
+        }
+        cp = (cp << 6) | (p[i] & 0x3f);
+    }
+    *s += n + 1;
+    if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp < 0xe000))
+        return 0xfffd;
+    return cp;
+}
+
+unsigned gr_utf8_length(const char *s)
+{
+    unsigned n = 0;
+    while (gr_utf8_next(&s)) n++;
+    return n;
+}
+
+static inline unsigned glyph_bucket(unsigned cp)
+{
+    return (cp * 2654435761u) >> 24 & (GR_GLYPH_BUCKETS - 1);
+}
+
+static void glyph_describe(int slot, GRGlyph *g)
+{
+    g->bits = gr_atlas;
+    g->stride = GR_ATLAS_STRIDE;
+    g->bx = slot * GLYPHS_CWIDTH;
+}
+
+// the atlas cell holding cp, or -1
+static int glyph_lookup(unsigned cp)
+{
+    int i;
+
+    for (i = gr_glyph_buckets[glyph_bucket(cp)]; i; ) {
+        if (gr_glyph_slots[i - 1].cp == cp) return i - 1;
+        i = gr_glyph_slots[i - 1].next;
+    }
+    return -1;
+}
+
+int gr_glyph_find(unsigned cp, GRGlyph *g)
+{
+    int n = glyph_lookup(cp);
+
+    if (n < 0) return -1;
+    glyph_describe(n, g);
+    return 0;
+}
+
+static void glyph_unlink(int n)
+{
+    int *link = &gr_glyph_buckets[glyph_bucket(gr_glyph_slots[n].cp)];
+
+    while (*link != n + 1) link = &gr_glyph_slots[*link - 1].next;
+    *link = gr_glyph_slots[n].next;
+}
+
+// Unpacks the table entry for cp into atlas cell n.
+static void glyph_unpack(int n, unsigned cp)
+{
+    const unsigned char *p;
+    unsigned page = cp < 0x10000 ? glyphs_page[cp >> 8] : GLYPHS_NONE;
+    unsigned offset = GLYPHS_NONE, top, rows, y, x;
+    int bx = n * GLYPHS_CWIDTH;
+
+    if (page != GLYPHS_NONE) offset = glyphs_index[page * 256 + (cp & 0xff)];
+    if (offset == GLYPHS_NONE) offset = GLYPHS_MISSING;
+    p = glyphs_data + offset;
+    top = p[0];
+    rows = p[1];
+    p += 2;
+
+    for (y = 0; y < GLYPHS_CHEIGHT; y++) {
+        unsigned char *row = gr_atlas + y * GR_ATLAS_STRIDE;
+        const unsigned char *src = NULL;
+        if (y >= top && y < top + rows) src = p + (y - top) * GLYPHS_STRIDE;
+        for (x = 0; x < GLYPHS_CWIDTH; x++) {
+            unsigned bit = bx + x;
+            if (src != NULL && (src[x >> 3] & (0x80 >> (x & 7))))
+                row[bit >> 3] |= 0x80 >> (bit & 7);
+            else
+                row[bit >> 3] &= ~(0x80 >> (bit & 7));
+        }
+    }
+}
+
+void gr_glyph_get(unsigned cp, GRGlyph *g)
+{
+    GRGlyphSlot *slot;
+    int i, n;
+
+    if (++gr_glyph_clock == 0) {
+        // the clock wrapped: keep the glyphs, forget their order
+        for (i = 0; i < GR_GLYPH_SLOTS; i++) {
+            if (gr_glyph_slots[i].used) gr_glyph_slots[i].used = 1;
+        }
+        gr_glyph_clock = 2;
+    }
+
+    if ((n = glyph_lookup(cp)) >= 0) {
+        gr_glyph_slots[n].used = gr_glyph_clock;
+        glyph_describe(n, g);
+        return;
+    }
+
+    // a free cell, or else the least recently used one
+    n = 0;
+    for (i = 0; i < GR_GLYPH_SLOTS; i++) {
+        if (!gr_glyph_slots[i].used) {
+            n = i;
+            break;
+        }
+        if (gr_glyph_slots[i].used < gr_glyph_slots[n].used) n = i;
+    }
+    slot = &gr_glyph_slots[n];
+    if (slot->used) glyph_unlink(n);
+
+    glyph_unpack(n, cp);
+    slot->cp = cp;
+    slot->used = gr_glyph_clock;
+    slot->next = gr_glyph_buckets[glyph_bucket(cp)];
+    gr_glyph_buckets[glyph_bucket(cp)] = n + 1;
+
+    glyph_describe(n, g);
+}
+
+void gr_glyph_cache_clear(void)
+{
+    memset(gr_glyph_slots, 0, sizeof(gr_glyph_slots));
+    memset(gr_glyph_buckets, 0, sizeof(gr_glyph_buckets));
+    gr_glyph_clock = 0;
+}
@@ -16,36 +16,32 @@
 
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
+#include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
 #include <stdio.h>
+#include <time.h>
 
-#include <sys/ioctl.h>
-#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 
-#include <linux/fb.h>
-#include <linux/kd.h>
-
 #include <pixelflinger/pixelflinger.h>
 
 #include "roboto_15x24.h"
 #include "minui.h"
-
-#if defined(RECOVERY_BGRA)
-#define PIXEL_FORMAT GGL_PIXEL_FORMAT_BGRA_8888
-#define PIXEL_SIZE   4
-#elif defined(RECOVERY_RGBX)
-#define PIXEL_FORMAT GGL_PIXEL_FORMAT_RGBX_8888
-#define PIXEL_SIZE   4
-#else
-#define PIXEL_FORMAT GGL_PIXEL_FORMAT_RGB_565
-#define PIXEL_SIZE   2
-#endif
+#include "graphics.h"
 
 typedef struct {
-    GGLSurface texture;
+    const unsigned char *bits;  /* 1 bpp glyph strip, in .rodata */
+    unsigned stride;            /* bytes per row of bits */
+    unsigned width;
+    unsigned height;
+    GGLSurface texture;         /* A_8 copy for pixelflinger, on demand */
+    GGLSurface glyph;           /* A_8 copy of one glyph outside bits */
     unsigned cwidth;
     unsigned cheight;
     unsigned ascent;
@@ -53,137 +49,564 @@ typedef struct {
 
 static GRFont *gr_font = 0;
 static GGLContext *gr_context = 0;
-static GGLSurface gr_font_texture;
-static GGLSurface gr_framebuffer[2];
+static GGLSurface gr_framebuffer[GR_MAX_PAGES];
 static GGLSurface gr_mem_surface;
 static unsigned gr_active_fb = 0;
 
-static int gr_fb_fd = -1;
-static int gr_vt_fd = -1;
+/* The surface pixelflinger's color buffer points at, and the native
+ * kernels for its format; primitives the kernels cover bypass
+ * pixelflinger entirely. */
+static GGLSurface *gr_draw = NULL;
+static const GRKernels *gr_kernels = NULL;
+static GRColor gr_current_color = { 255, 255, 255, 255 };
+
+/* Set when the backend can switch between the two pages: we then draw
+ * straight into the hidden page and gr_flip() is a pan with no copy. */
+static int gr_direct = 0;
+
+/* the display the pages are shown on; see graphics_fbdev.c and
+ * graphics_virtual.c */
+static minui_backend *gr_backend = NULL;
+
+/* Clockwise turn, in degrees, from what we draw to the panel.  When it
+ * is not 0 we draw into memory at the turned size, and gr_flip() turns
+ * the damaged regions as it copies them into the page. */
+static int gr_rotation_wanted = 0;
+static int gr_rotation = 0;
+
+/* Triple buffering.  gr_flip() only posts the finished page; a display
+ * thread puts the latest posted page on screen at the next vsync, and a
+ * page posted over one that was never shown replaces it.  Drawing then
+ * overlaps scanout and only waits for the display while a pan is in
+ * progress.  gr_lock guards the page roles below and the stats. */
+static int gr_triple_wanted = 0;
+static int gr_triple = 0;
+static pthread_t gr_vsync_thread;
+static pthread_mutex_t gr_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gr_page_freed = PTHREAD_COND_INITIALIZER;
+static int gr_vsync_stop = 0;
+static int gr_page_pending = -1;   /* posted, waiting for a vsync */
+static int gr_page_showing = -1;   /* being panned to */
+static unsigned gr_page_back = 0;  /* being drawn */
+static unsigned gr_vsync_shown = 0;
+static unsigned gr_vsync_missed = 0;
+static unsigned gr_vsync_dropped = 0;
+
+/* Damage tracking.  Every primitive records the rectangle it touched in
+ * the damage list of the frame being drawn.  A page only has to be
+ * brought up to date within the damage of the frames drawn since it was
+ * last shown, so gr_flip() copies that instead of the whole surface. */
+#define GR_DAMAGE_RECTS   8
+#define GR_DAMAGE_FRAMES  4
+#define GR_FRAME_NONE     ((unsigned) -1)
+
+typedef struct {
+    GRRect rect[GR_DAMAGE_RECTS];
+    unsigned count;
+} GRDamage;
+
+/* Glyph-run cache.  gr_text() renders a whole string's coverage once
+ * into a 1-bpp strip and then draws it with a single blend_a1 call; the
+ * color is applied by the kernel, so entries are keyed by font and text
+ * only.  The least recently used run is evicted to stay in budget. */
+#define GR_TEXT_CACHE_RUNS   32
+#define GR_TEXT_CACHE_BYTES  (256 * 1024)
+
+typedef struct {
+    GRFont *font;
+    unsigned hash;
+    unsigned used;      /* gr_text_clock at the last hit; 0 if free */
+    char *text;
+    unsigned char *bits;
+    int stride;         /* bytes per row of bits */
+    int width;
+    int height;
+} GRTextRun;
+
+static GRTextRun gr_text_runs[GR_TEXT_CACHE_RUNS];
+static unsigned gr_text_clock = 0;
+static size_t gr_text_bytes = 0;
+
+/* Retained display list.  Between gr_list_begin() and gr_list_end()
+ * primitives are recorded with their inputs and bounds instead of drawn.
+ * gr_list_end() matches the new list against the one drawn last, as the
+ * longest common subsequence of identical commands, and redraws every new
+ * command overlapping a command that did not match, clipped to those.
+ * Commands hidden there by a later opaque fill or blit are skipped. */
+#define GR_LIST_DIFF_MAX  256
+
+enum { GR_CMD_FILL, GR_CMD_BLIT, GR_CMD_TEXT, GR_CMD_SCALE,
+       GR_CMD_STALE };     /* shows a surface drawn into since; matches
+                            * nothing */
+
+typedef struct {
+    int type;
+    unsigned hash;
+    GRRect bounds;          /* also the clip of a scaled blit */
+    GRColor color;          /* fill, text */
+    gr_surface source;      /* blit */
+    int sx, sy, w, h;       /* blit source; right and bottom edges of a fill */
+    int x, y;
+    int dw, dh, filter;     /* scaled blit */
+    char *text;
+} GRCommand;
+
+typedef struct {
+    GRCommand *cmd;
+    unsigned count;
+    unsigned size;
+} GRList;
+
+static GRList gr_lists[2];
+static GRList *gr_list_new = &gr_lists[0];  /* being recorded */
+static GRList *gr_list_old = &gr_lists[1];  /* last drawn */
+static int gr_recording = 0;
+/* cleared whenever the draw surface is changed outside a list */
+static int gr_list_valid = 0;
+
+/* Band rendering.  A large redraw is split into gr_bands horizontal
+ * bands: the caller of gr_list_end() draws the first and a worker thread
+ * each of the others, all from the same list.  Only lists the native
+ * kernels can draw entirely are split, since pixelflinger has one
+ * context.  gr_band_lock guards the job fields. */
+#define GR_MAX_BANDS        8
+#define GR_BAND_MIN_PIXELS  (64 * 1024)
+
+static int gr_bands_wanted = 1;
+static int gr_bands = 1;
+static pthread_t gr_band_threads[GR_MAX_BANDS];
+static pthread_mutex_t gr_band_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gr_band_start = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t gr_band_done = PTHREAD_COND_INITIALIZER;
+static unsigned gr_band_job = 0;    /* bumped to start the workers */
+static int gr_band_busy = 0;        /* workers not done with the job */
+static int gr_band_stop = 0;
+static const GRList *gr_band_list;
+static const GRDamage *gr_band_dirty;
+
+/* Offscreen drawing.  While gr_draw_to() has gr_draw pointing at a
+ * surface of gr_create_surface(), gr_screen is the page or memory
+ * surface frames are drawn into, and the list state is set aside:
+ * drawing offscreen is immediate and adds no damage. */
+static GGLSurface *gr_screen = NULL;
+static int gr_screen_recording;
+static int gr_screen_list_valid;
+
+static GRDamage gr_damage[GR_DAMAGE_FRAMES];
+static GRRect gr_clip;
+static unsigned gr_frame = 1;
+static unsigned gr_page_frame[GR_MAX_PAGES] = {
+    GR_FRAME_NONE, GR_FRAME_NONE, GR_FRAME_NONE
+};
+
+/* A saved frame, shown by gr_snapshot_show() before gr_init(): the
+ * header, then the rows of the page, packed, in its pixel format. */
+typedef struct {
+    char magic[4];      /* "GRSN" */
+    unsigned key;
+    unsigned width;
+    unsigned height;
+    unsigned format;
+} GRSnapshotHeader;
 
-static struct fb_var_screeninfo vi;
-static struct fb_fix_screeninfo fi;
+static int gr_snapshot_shown = 0;
+
+/* Streaming to a debugging client (stream.c), and what was drawn since
+ * the stream's copy of the frame was last brought up to date. */
+static char gr_stream_address[108] = "";    /* as long as sun_path */
+static int gr_streaming = 0;
+static GRDamage gr_stream_todo;
+
+static void get_memory_surface(GGLSurface* ms) {
+  GGLSurface *fb = &gr_framebuffer[0];
+  ms->version = sizeof(*ms);
+  ms->width = gr_fb_width();
+  ms->height = gr_fb_height();
+  ms->stride = (gr_rotation % 180) ? ms->width : fb->stride;
+  ms->data = malloc(ms->stride * ms->height * gr_bytes_per_pixel(fb->format));
+  ms->format = fb->format;
+}
 
-static int get_framebuffer(GGLSurface *fb)
+/* Primitives draw nothing outside the clip rectangle; pixelflinger is
+ * held to it with the scissor test. */
+static void set_clip(int x0, int y0, int x1, int y1)
 {
-    int fd;
-    void *bits;
+    GGLContext *gl = gr_context;
 
-    fd = open("/dev/graphics/fb0", O_RDWR);
-    if (fd < 0) {
-        perror("cannot open fb0");
-        return -1;
+    gr_clip.x0 = x0;
+    gr_clip.y0 = y0;
+    gr_clip.x1 = x1;
+    gr_clip.y1 = y1;
+    if (x0 == 0 && y0 == 0 &&
+        x1 == (int) gr_draw->width && y1 == (int) gr_draw->height) {
+        gl->disable(gl, GGL_SCISSOR_TEST);
+    } else {
+        gl->scissor(gl, x0, y0, x1 - x0, y1 - y0);
+        gl->enable(gl, GGL_SCISSOR_TEST);
     }
+}
 
-    if (ioctl(fd, FBIOGET_VSCREENINFO, &vi) < 0) {
-        perror("failed to get fb0 info");
-        close(fd);
-        return -1;
+static void set_draw_surface(GGLSurface *s)
+{
+    GGLContext *gl = gr_context;
+
+    gr_draw = s;
+    gr_kernels = gr_get_kernels(s->format);
+    gl->colorBuffer(gl, s);
+    set_clip(0, 0, s->width, s->height);
+}
+
+static inline unsigned char *draw_pixels(int x, int y)
+{
+    int bpp = gr_bytes_per_pixel(gr_draw->format);
+    return gr_draw->data + (y * gr_draw->stride + x) * bpp;
+}
+
+static inline int draw_stride(void)
+{
+    return gr_draw->stride * gr_bytes_per_pixel(gr_draw->format);
+}
+
+/* Clips a w x h copy from (sx, sy) of a sw x sh source to (dx, dy)
+ * against the source and clip.  Returns 0 if nothing is left to draw. */
+static int clip_copy(const GRRect *clip, int sw, int sh, int *sx, int *sy,
+                     int *w, int *h, int *dx, int *dy)
+{
+    int d;
+
+    if (*sx < 0) { *dx -= *sx; *w += *sx; *sx = 0; }
+    if (*sy < 0) { *dy -= *sy; *h += *sy; *sy = 0; }
+    if ((d = clip->x0 - *dx) > 0) { *sx += d; *w -= d; *dx += d; }
+    if ((d = clip->y0 - *dy) > 0) { *sy += d; *h -= d; *dy += d; }
+    if (*w > sw - *sx) *w = sw - *sx;
+    if (*h > sh - *sy) *h = sh - *sy;
+    if (*w > clip->x1 - *dx) *w = clip->x1 - *dx;
+    if (*h > clip->y1 - *dy) *h = clip->y1 - *dy;
+    return *w > 0 && *h > 0;
+}
+
+/* source formats the native kernels can draw into gr_draw */
+static int blit_supported(int format)
+{
+    return format == gr_draw->format ||
+           format == GGL_PIXEL_FORMAT_RGBX_8888 ||
+           format == GGL_PIXEL_FORMAT_RGBA_8888 ||
+           format == gr_premultiplied_format(gr_draw->format);
+}
+
+int gr_draw_format(void)
+{
+    return gr_draw != NULL ? gr_draw->format : -1;
+}
+
+const GGLSurface *gr_last_frame(void)
+{
+    if (gr_draw == NULL) return NULL;
+    /* after a flip the page or memory we draw into holds the frame
+     * just finished, until drawing starts */
+    return gr_screen != NULL ? gr_screen : gr_draw;
+}
+
+static inline int rect_area(const GRRect *r)
+{
+    return (r->x1 - r->x0) * (r->y1 - r->y0);
+}
+
+static inline void rect_union(GRRect *r, const GRRect *o)
+{
+    if (o->x0 < r->x0) r->x0 = o->x0;
+    if (o->y0 < r->y0) r->y0 = o->y0;
+    if (o->x1 > r->x1) r->x1 = o->x1;
+    if (o->y1 > r->y1) r->y1 = o->y1;
+}
+
+/* shrinks r to its overlap with o; returns 0 if there is none */
+static inline int rect_intersect(GRRect *r, const GRRect *o)
+{
+    if (o->x0 > r->x0) r->x0 = o->x0;
+    if (o->y0 > r->y0) r->y0 = o->y0;
+    if (o->x1 < r->x1) r->x1 = o->x1;
+    if (o->y1 < r->y1) r->y1 = o->y1;
+    return r->x0 < r->x1 && r->y0 < r->y1;
+}
+
+static void damage_add(GRDamage *d, int x0, int y0, int x1, int y1)
+{
+    GRRect r, u;
+    unsigned i, best = 0;
+    int growth, best_growth = -1;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > gr_fb_width()) x1 = gr_fb_width();
+    if (y1 > gr_fb_height()) y1 = gr_fb_height();
+    if (x0 >= x1 || y0 >= y1) return;
+
+    r.x0 = x0; r.y0 = y0; r.x1 = x1; r.y1 = y1;
+    for (i = 0; i < d->count; i++) {
+        GRRect *o = &d->rect[i];
+        if (o->x0 <= x0 && o->y0 <= y0 && o->x1 >= x1 && o->y1 >= y1)
+            return;
+    }
+    if (d->count < GR_DAMAGE_RECTS) {
+        d->rect[d->count++] = r;
+        return;
     }
 
-    vi.bits_per_pixel = PIXEL_SIZE * 8;
-    if (PIXEL_FORMAT == GGL_PIXEL_FORMAT_BGRA_8888) {
-      vi.red.offset     = 8;
-      vi.red.length     = 8;
-      vi.green.offset   = 16;
-      vi.green.length   = 8;
-      vi.blue.offset    = 24;
-      vi.blue.length    = 8;
-      vi.transp.offset  = 0;
-      vi.transp.length  = 8;
-    } else if (PIXEL_FORMAT == GGL_PIXEL_FORMAT_RGBX_8888) {
-      vi.red.offset     = 24;
-      vi.red.length     = 8;
-      vi.green.offset   = 16;
-      vi.green.length   = 8;
-      vi.blue.offset    = 8;
-      vi.blue.length    = 8;
-      vi.transp.offset  = 0;
-      vi.transp.length  = 8;
-    } else { /* RGB565*/
-      vi.red.offset     = 11;
-      vi.red.length     = 5;
-      vi.green.offset   = 5;
-      vi.green.length   = 6;
-      vi.blue.offset    = 0;
-      vi.blue.length    = 5;
-      vi.transp.offset  = 0;
-      vi.transp.length  = 0;
-    }
-    if (ioctl(fd, FBIOPUT_VSCREENINFO, &vi) < 0) {
-        perror("failed to put fb0 info");
-        close(fd);
-        return -1;
+    /* out of slots: grow whichever rectangle gets the least bigger */
+    for (i = 0; i < d->count; i++) {
+        u = d->rect[i];
+        rect_union(&u, &r);
+        growth = rect_area(&u) - rect_area(&d->rect[i]);
+        if (best_growth < 0 || growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
     }
+    rect_union(&d->rect[best], &r);
+}
 
-    if (ioctl(fd, FBIOGET_FSCREENINFO, &fi) < 0) {
-        perror("failed to get fb0 info");
-        close(fd);
-        return -1;
+static inline void gr_damage_rect(int x0, int y0, int x1, int y1)
+{
+    if (gr_screen != NULL) return;
+    if (x0 < gr_clip.x0) x0 = gr_clip.x0;
+    if (y0 < gr_clip.y0) y0 = gr_clip.y0;
+    if (x1 > gr_clip.x1) x1 = gr_clip.x1;
+    if (y1 > gr_clip.y1) y1 = gr_clip.y1;
+    damage_add(&gr_damage[gr_frame % GR_DAMAGE_FRAMES], x0, y0, x1, y1);
+}
+
+/* turn rectangle r of src, which is what we draw into, onto page fb */
+static void rotate_rect(GGLSurface *fb, const GGLSurface *src,
+                        const GRRect *r)
+{
+    int bpp = gr_bytes_per_pixel(fb->format);
+    int x, y;
+
+    switch (gr_rotation) {
+    case 90:  x = src->height - r->y1; y = r->x0; break;
+    case 180: x = src->width - r->x1;  y = src->height - r->y1; break;
+    default:  x = r->y0;               y = src->width - r->x1; break;
     }
+    gr_get_kernels(fb->format)->rotate(
+            fb->data + (y * fb->stride + x) * bpp, fb->stride * bpp,
+            src->data + (r->y0 * src->stride + r->x0) * bpp,
+            src->stride * bpp, r->x1 - r->x0, r->y1 - r->y0, gr_rotation);
+}
 
-    bits = mmap(0, fi.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-    if (bits == MAP_FAILED) {
-        perror("failed to mmap framebuffer");
-        close(fd);
-        return -1;
+/* copy the regions drawn since page n was last brought up to date
+ * from the surface they were drawn on into it */
+static void update_page(unsigned n, const GGLSurface *from)
+{
+    GRDamage todo;
+    unsigned f, i;
+    GGLSurface *fb = &gr_framebuffer[n];
+    unsigned char *dst = fb->data;
+    const unsigned char *src = from->data;
+    int bpp = gr_bytes_per_pixel(fb->format);
+    size_t line = fb->stride * bpp;
+
+    todo.count = 0;
+    if (gr_page_frame[n] == GR_FRAME_NONE ||
+        gr_frame - gr_page_frame[n] > GR_DAMAGE_FRAMES) {
+        damage_add(&todo, 0, 0, from->width, from->height);
+    } else {
+        for (f = gr_page_frame[n] + 1; f != gr_frame + 1; f++) {
+            GRDamage *d = &gr_damage[f % GR_DAMAGE_FRAMES];
+            for (i = 0; i < d->count; i++) {
+                damage_add(&todo, d->rect[i].x0, d->rect[i].y0,
+                           d->rect[i].x1, d->rect[i].y1);
+            }
+        }
+    }
+
+    for (i = 0; i < todo.count; i++) {
+        GRRect *r = &todo.rect[i];
+        size_t off = r->y0 * line + r->x0 * bpp;
+        size_t len = (r->x1 - r->x0) * bpp;
+        int y;
+
+        if (gr_rotation) {
+            rotate_rect(fb, from, r);
+            continue;
+        }
+        if (r->x0 == 0 && r->x1 == (int) fb->width) {
+            memcpy(dst + off, src + off, (r->y1 - r->y0) * line);
+            continue;
+        }
+        for (y = r->y0; y < r->y1; y++, off += line) {
+            memcpy(dst + off, src + off, len);
+        }
     }
+}
+
+/* hand the stream what changed in the frame just finished, as drawn,
+ * or keep it for the next frame if the stream is busy */
+static void stream_frame(const GGLSurface *from)
+{
+    GRDamage *d = &gr_damage[gr_frame % GR_DAMAGE_FRAMES];
+    unsigned i;
+
+    if (!gr_streaming) return;
+    for (i = 0; i < d->count; i++) {
+        damage_add(&gr_stream_todo, d->rect[i].x0, d->rect[i].y0,
+                   d->rect[i].x1, d->rect[i].y1);
+    }
+    if (gr_stream_update(from, gr_stream_todo.rect,
+                         gr_stream_todo.count) == 0)
+        gr_stream_todo.count = 0;
+}
+
+static void flip_direct(void)
+{
+    unsigned shown = (gr_active_fb + 1) & 1;
 
-    fb->version = sizeof(*fb);
-    fb->width = vi.xres;
-    fb->height = vi.yres;
-    fb->stride = fi.line_length/PIXEL_SIZE;
-    fb->data = bits;
-    fb->format = PIXEL_FORMAT;
-    memset(fb->data, 0, vi.yres * fi.line_length);
+    /* show the page we just drew */
+    gr_backend->show(gr_backend, shown);
+    gr_page_frame[shown] = gr_frame;
+    gr_active_fb = shown;
 
-    fb++;
+    /* the other page is now the one we draw into; it is one frame
+     * behind, so catch it up from the page on screen */
+    update_page(shown ^ 1, &gr_framebuffer[shown]);
+    gr_page_frame[shown ^ 1] = gr_frame;
+    stream_frame(&gr_framebuffer[shown]);
 
-    fb->version = sizeof(*fb);
-    fb->width = vi.xres;
-    fb->height = vi.yres;
-    fb->stride = fi.line_length/PIXEL_SIZE;
-    fb->data = (void*) (((unsigned) bits) + vi.yres * fi.line_length);
-    fb->format = PIXEL_FORMAT;
-    memset(fb->data, 0, vi.yres * fi.line_length);
+    gr_frame++;
+    gr_damage[gr_frame % GR_DAMAGE_FRAMES].count = 0;
 
-    return fd;
+    set_draw_surface(&gr_framebuffer[shown ^ 1]);
 }
 
-static void get_memory_surface(GGLSurface* ms) {
-  ms->version = sizeof(*ms);
-  ms->width = vi.xres;
-  ms->height = vi.yres;
-  ms->stride = fi.line_length/PIXEL_SIZE;
-  ms->data = malloc(fi.line_length * vi.yres);
-  ms->format = PIXEL_FORMAT;
+static long long now_usec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
 }
 
-static void set_active_framebuffer(unsigned n)
+static void *vsync_thread(void *arg)
 {
-    if (n > 1) return;
-    vi.yres_virtual = vi.yres * PIXEL_SIZE;
-    vi.yoffset = n * vi.yres;
-    vi.bits_per_pixel = PIXEL_SIZE * 8;
-    if (ioctl(gr_fb_fd, FBIOPUT_VSCREENINFO, &vi) < 0) {
-        perror("active fb swap failed");
+    unsigned period = gr_backend->frame_usec ? gr_backend->frame_usec : 16667;
+    long long last = now_usec(), next = last + period, now;
+    int timer = 0;
+
+    for (;;) {
+        /* wait for vsync, or pace ourselves if the driver cannot */
+        if (!timer && gr_backend->wait_vsync(gr_backend) < 0) {
+            fprintf(stderr, "no vsync from %s, using a %u us timer\n",
+                    gr_backend->name, period);
+            timer = 1;
+        }
+        if (timer) {
+            struct timespec ts;
+            ts.tv_sec = next / 1000000;
+            ts.tv_nsec = (next % 1000000) * 1000;
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL)
+                   == EINTR)
+                ;
+        }
+
+        pthread_mutex_lock(&gr_lock);
+        now = now_usec();
+        if (now - last > period + period / 2) {
+            gr_vsync_missed += (now - last + period / 2) / period - 1;
+        }
+        last = now;
+        next += period;
+        if (next <= now) next = now + period;
+
+        /* on exit, still show the last page posted */
+        if (gr_vsync_stop && gr_page_pending < 0) {
+            pthread_mutex_unlock(&gr_lock);
+            break;
+        }
+        gr_page_showing = gr_page_pending;
+        gr_page_pending = -1;
+        pthread_mutex_unlock(&gr_lock);
+
+        if (gr_page_showing < 0) continue;
+        gr_backend->show(gr_backend, gr_page_showing);
+
+        pthread_mutex_lock(&gr_lock);
+        gr_active_fb = gr_page_showing;
+        gr_page_showing = -1;
+        gr_vsync_shown++;
+        pthread_cond_signal(&gr_page_freed);
+        pthread_mutex_unlock(&gr_lock);
     }
+    return NULL;
+}
+
+/* a page that is neither on screen, being shown nor posted */
+static int free_page(void)
+{
+    unsigned n;
+    for (n = 0; n < 3; n++) {
+        if (n != gr_active_fb && (int) n != gr_page_showing &&
+            (int) n != gr_page_pending)
+            return n;
+    }
+    return -1;
+}
+
+static void flip_triple(void)
+{
+    unsigned posted = gr_page_back;
+    int next;
+
+    gr_page_frame[posted] = gr_frame;
+
+    pthread_mutex_lock(&gr_lock);
+    if (gr_page_pending >= 0) gr_vsync_dropped++;
+    gr_page_pending = posted;
+    while ((next = free_page()) < 0) {
+        pthread_cond_wait(&gr_page_freed, &gr_lock);
+    }
+    pthread_mutex_unlock(&gr_lock);
+
+    /* the display only reads the posted page, so it is safe to catch
+     * the next page up from it */
+    update_page(next, &gr_framebuffer[posted]);
+    gr_page_frame[next] = gr_frame;
+    stream_frame(&gr_framebuffer[posted]);
+
+    gr_frame++;
+    gr_damage[gr_frame % GR_DAMAGE_FRAMES].count = 0;
+
+    gr_page_back = next;
+    set_draw_surface(&gr_framebuffer[next]);
 }
 
 void gr_flip(void)
 {
-    GGLContext *gl = gr_context;
+    gr_draw_to(NULL);
+
+    if (gr_triple) {
+        flip_triple();
+        return;
+    }
+
+    if (gr_direct) {
+        flip_direct();
+        return;
+    }
 
     /* swap front and back buffers */
     gr_active_fb = (gr_active_fb + 1) & 1;
 
-    /* copy data from the in-memory surface to the buffer we're about
-     * to make active. */
-    memcpy(gr_framebuffer[gr_active_fb].data, gr_mem_surface.data,
-           fi.line_length * vi.yres);
+    /* bring the buffer we're about to make active up to date with the
+     * in-memory surface. */
+    update_page(gr_active_fb, &gr_mem_surface);
+    gr_page_frame[gr_active_fb] = gr_frame;
+    stream_frame(&gr_mem_surface);
+
+    /* start a new frame with no damage */
+    gr_frame++;
+    gr_damage[gr_frame % GR_DAMAGE_FRAMES].count = 0;
 
     /* inform the display driver */
-    set_active_framebuffer(gr_active_fb);
+    gr_backend->show(gr_backend, gr_active_fb);
 }
 
 void gr_color(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
@@ -195,11 +618,16 @@ void gr_color(unsigned char r, unsigned char g, unsigned char b, unsigned char a
     color[2] = ((b << 8) | b) + 1;
     color[3] = ((a << 8) | a) + 1;
     gl->color4xv(gl, color);
+
+    gr_current_color.r = r;
+    gr_current_color.g = g;
+    gr_current_color.b = b;
+    gr_current_color.a = a;
 }
 
 int gr_measure(const char *s)
 {
-    return gr_font->cwidth * strlen(s);
+    return gr_font->cwidth * gr_utf8_length(s);
 }
 
 void gr_font_size(int *x, int *y)
@@ -208,46 +636,525 @@ void gr_font_size(int *x, int *y)
     *y = gr_font->cheight;
 }
 
-int gr_text(int x, int y, const char *s)
+static void text_run_free(GRTextRun *run)
+{
+    gr_text_bytes -= run->stride * run->height;
+    free(run->text);
+    free(run->bits);
+    memset(run, 0, sizeof(*run));
+}
+
+static void text_cache_clear(void)
+{
+    int i;
+    for (i = 0; i < GR_TEXT_CACHE_RUNS; i++) {
+        if (gr_text_runs[i].used) text_run_free(&gr_text_runs[i]);
+    }
+}
+
+/* djb2, so most runs are ruled out without comparing text. */
+static unsigned text_hash(const char *s)
+{
+    unsigned hash = 5381;
+    for (; *s; s++) hash = hash * 33 + (unsigned char) *s;
+    return hash;
+}
+
+/* Looks s up without touching the LRU order, so the band workers can
+ * share the cache while it is not being changed. */
+static GRTextRun *text_run_find(GRFont *font, const char *s, unsigned hash)
+{
+    int i;
+
+    for (i = 0; i < GR_TEXT_CACHE_RUNS; i++) {
+        GRTextRun *run = &gr_text_runs[i];
+        if (run->used && run->font == font && run->hash == hash &&
+                strcmp(run->text, s) == 0) {
+            return run;
+        }
+    }
+    return NULL;
+}
+
+/* Finds the 1-bpp coverage of code point cp: row y starts at bit *bx of
+ * *bits + y * *stride.  Printable ASCII comes from the font strip, the
+ * rest from the glyph atlas, which is only read unless load is set.
+ * Returns -1 if there is nothing to draw. */
+static int font_glyph(GRFont *font, unsigned cp, int load,
+                      const unsigned char **bits, int *stride, int *bx)
+{
+    GRGlyph g;
+
+    if (cp < 32) return -1;
+    if (cp < 128) {
+        *bits = font->bits;
+        *stride = font->stride;
+        *bx = (cp - 32) * font->cwidth;
+        return 0;
+    }
+    if (load) {
+        gr_glyph_get(cp, &g);
+    } else if (gr_glyph_find(cp, &g) < 0) {
+        return -1;
+    }
+    *bits = g.bits;
+    *stride = g.stride;
+    *bx = g.bx;
+    return 0;
+}
+
+/* Returns the cached coverage of s in font, rendering it if needed, or
+ * NULL if it cannot be cached (empty, too large, or out of memory). */
+static GRTextRun *text_run_get(GRFont *font, const char *s)
+{
+    GRTextRun *run, *victim = NULL;
+    unsigned hash = text_hash(s);
+    size_t len = gr_utf8_length(s), size;
+    const char *p;
+    int i, row, stride;
+
+    if (++gr_text_clock == 0) {
+        /* the clock wrapped: start the LRU order over */
+        text_cache_clear();
+        gr_text_clock = 1;
+    }
+
+    if ((run = text_run_find(font, s, hash)) != NULL) {
+        run->used = gr_text_clock;
+        return run;
+    }
+
+    stride = (len * font->cwidth + 7) / 8;
+    size = stride * font->cheight;
+    if (size == 0 || size > GR_TEXT_CACHE_BYTES / 4) return NULL;
+
+    /* evict least recently used runs until the new one fits */
+    for (;;) {
+        victim = NULL;
+        for (i = 0; i < GR_TEXT_CACHE_RUNS; i++) {
+            run = &gr_text_runs[i];
+            if (!run->used) {
+                if (gr_text_bytes + size <= GR_TEXT_CACHE_BYTES) break;
+                continue;
+            }
+            if (victim == NULL || run->used < victim->used) victim = run;
+        }
+        if (i < GR_TEXT_CACHE_RUNS) break;
+        text_run_free(victim);
+    }
+
+    run->text = strdup(s);
+    run->bits = calloc(size, 1);
+    if (run->text == NULL || run->bits == NULL) {
+        free(run->text);
+        free(run->bits);
+        run->text = NULL;
+        run->bits = NULL;
+        return NULL;
+    }
+    run->font = font;
+    run->hash = hash;
+    run->used = gr_text_clock;
+    run->stride = stride;
+    run->width = len * font->cwidth;
+    run->height = font->cheight;
+    gr_text_bytes += size;
+
+    for (p = s, i = 0; *p; i++) {
+        const unsigned char *bits;
+        int sstride, sx, dx = i * font->cwidth;
+        unsigned x;
+        if (font_glyph(font, gr_utf8_next(&p), 1, &bits, &sstride, &sx) < 0)
+            continue;
+        for (row = 0; row < run->height; row++) {
+            const unsigned char *src = bits + row * sstride;
+            unsigned char *dst = run->bits + row * stride;
+            for (x = 0; x < font->cwidth; x++) {
+                if (gr_bit(src, sx + x))
+                    dst[(dx + x) >> 3] |= 0x80 >> ((dx + x) & 7);
+            }
+        }
+    }
+    return run;
+}
+
+/* Pixelflinger only draws text from an A_8 texture; expand the bits
+ * into one the first time a format without kernels needs it. */
+static int font_texture(GRFont *font)
+{
+    GGLSurface *ftex = &font->texture;
+    unsigned char *p;
+    unsigned x, y;
+
+    if (ftex->data != NULL) return 0;
+    p = malloc(font->width * font->height);
+    if (p == NULL) return -1;
+
+    ftex->version = sizeof(*ftex);
+    ftex->width = font->width;
+    ftex->height = font->height;
+    ftex->stride = font->width;
+    ftex->data = p;
+    ftex->format = GGL_PIXEL_FORMAT_A_8;
+
+    for (y = 0; y < font->height; y++) {
+        const unsigned char *row = font->bits + y * font->stride;
+        for (x = 0; x < font->width; x++) {
+            *p++ = gr_bit(row, x) ? 255 : 0;
+        }
+    }
+    return 0;
+}
+
+/* the same for a single glyph of the atlas, into font->glyph */
+static int glyph_texture(GRFont *font, const unsigned char *bits,
+                         int stride, int bx)
+{
+    GGLSurface *gtex = &font->glyph;
+    unsigned char *p = gtex->data;
+    unsigned x, y;
+
+    if (p == NULL) {
+        p = malloc(font->cwidth * font->cheight);
+        if (p == NULL) return -1;
+        gtex->version = sizeof(*gtex);
+        gtex->width = font->cwidth;
+        gtex->height = font->cheight;
+        gtex->stride = font->cwidth;
+        gtex->data = p;
+        gtex->format = GGL_PIXEL_FORMAT_A_8;
+    }
+
+    for (y = 0; y < font->cheight; y++) {
+        const unsigned char *row = bits + y * stride;
+        for (x = 0; x < font->cwidth; x++) {
+            *p++ = gr_bit(row, bx + x) ? 255 : 0;
+        }
+    }
+    return 0;
+}
+
+/* The native halves of the primitives.  They draw into gr_draw within
+ * clip only and change no other state, so the band workers can run them
+ * side by side.  y is the top of the text, not its baseline; run may be
+ * NULL to draw glyph by glyph, and then load says whether glyphs missing
+ * from the atlas may be added to it. */
+static void native_text(const GRRect *clip, const GRColor *c,
+                        const GRTextRun *run, int load, int x, int y,
+                        const char *s)
+{
+    const GRKernels *k = gr_kernels;
+    GRFont *font = gr_font;
+
+    if (run != NULL) {
+        int sx = 0, sy = 0, w = run->width, h = run->height;
+        if (clip_copy(clip, run->width, run->height, &sx, &sy, &w, &h,
+                      &x, &y)) {
+            k->blend_a1(draw_pixels(x, y), draw_stride(),
+                        run->bits + sy * run->stride, run->stride, sx,
+                        w, h, c);
+        }
+        return;
+    }
+
+    while (*s) {
+        const unsigned char *bits;
+        int stride, sx, sy = 0, w = font->cwidth, h = font->cheight;
+        int dx = x, dy = y;
+        x += font->cwidth;
+        if (font_glyph(font, gr_utf8_next(&s), load, &bits, &stride, &sx) < 0)
+            continue;
+        if (!clip_copy(clip, sx + font->cwidth, font->cheight, &sx, &sy,
+                       &w, &h, &dx, &dy)) {
+            continue;
+        }
+        k->blend_a1(draw_pixels(dx, dy), draw_stride(),
+                    bits + sy * stride, stride, sx, w, h, c);
+    }
+}
+
+/* like recti(), w and h are the right and bottom edges */
+static void native_fill(const GRRect *clip, const GRColor *c,
+                        int x, int y, int w, int h)
+{
+    const GRKernels *k = gr_kernels;
+
+    if (x < clip->x0) x = clip->x0;
+    if (y < clip->y0) y = clip->y0;
+    if (w > clip->x1) w = clip->x1;
+    if (h > clip->y1) h = clip->y1;
+    if (x >= w || y >= h || c->a == 0) return;
+
+    if (c->a == 255) {
+        k->fill(draw_pixels(x, y), draw_stride(), w - x, h - y,
+                gr_pack_pixel(gr_draw->format, c));
+    } else if (c->r == 0 && c->g == 0 && c->b == 0) {
+        /* translucent black only scales dst; no source term */
+        k->dim(draw_pixels(x, y), draw_stride(), w - x, h - y,
+               255 - c->a);
+    } else {
+        k->fill_blend(draw_pixels(x, y), draw_stride(), w - x, h - y, c);
+    }
+}
+
+/* draws w x h pixels of a blit_supported() format at dst */
+static void blit_pixels(unsigned char *dst, const unsigned char *src,
+                        int format, int sstride, int w, int h)
+{
+    const GRKernels *k = gr_kernels;
+
+    if (format == gr_draw->format) {
+        /* already in the native format: a row copy */
+        int len = w * gr_bytes_per_pixel(format);
+        for (; h > 0; h--, dst += draw_stride(), src += sstride) {
+            memcpy(dst, src, len);
+        }
+    } else if (format == GGL_PIXEL_FORMAT_RGBX_8888) {
+        k->copy_rgbx(dst, draw_stride(), src, sstride, w, h);
+    } else if (format == GGL_PIXEL_FORMAT_RGBA_8888) {
+        k->blend_rgba(dst, draw_stride(), src, sstride, w, h);
+    } else {
+        k->blend_pre(dst, draw_stride(), src, sstride, w, h);
+    }
+}
+
+static void native_blit(const GRRect *clip, const GGLSurface *surface,
+                        int sx, int sy, int w, int h, int dx, int dy)
+{
+    int sstride = surface->stride * gr_bytes_per_pixel(surface->format);
+
+    if (!clip_copy(clip, surface->width, surface->height, &sx, &sy, &w, &h,
+                   &dx, &dy)) {
+        return;
+    }
+    blit_pixels(draw_pixels(dx, dy),
+                surface->data + sy * sstride +
+                        sx * gr_bytes_per_pixel(surface->format),
+                surface->format, sstride, w, h);
+}
+
+/* Scaled blits go a row at a time.  Each dst pixel samples the source at
+ * its centre, stepping in 16.16 fixed point.  Bilinear rows are mixed
+ * down from the two source rows around that point, each resampled across
+ * once into a buffer slot chosen by its parity, so neighbours never
+ * evict each other and every source row is filtered only once. */
+typedef struct {
+    const GRKernels *k;
+    int format;                 /* of the rows scaler_row() returns */
+    int bilinear;
+    const unsigned char *src;   /* top left of the area scaled */
+    int sstride, sw, sh;
+    int x, xstep, y, ystep;     /* source position of the first pixel */
+    int w;                      /* pixels per row */
+    unsigned char *buf[3];      /* resampled source rows, and the result */
+    int have[2];                /* source row in buf[0], buf[1], or -1 */
+} GRScaler;
+
+/* Sets s up for the w pixels wide part of a dw x dh scaled copy of the
+ * sw x sh area at (sx, sy) of surface, starting at (x0, y0) of it. */
+static int scaler_init(GRScaler *s, const GGLSurface *surface, int sx,
+                       int sy, int sw, int sh, int dw, int dh, int filter,
+                       int x0, int y0, int w)
+{
+    int bpp = gr_bytes_per_pixel(surface->format);
+    int centre;
+
+    /* the resamplers care only about the pixel size, but for RGB_565 */
+    s->k = gr_get_kernels(surface->format == GGL_PIXEL_FORMAT_RGB_565 ?
+                          surface->format : GGL_PIXEL_FORMAT_RGBX_8888);
+    s->bilinear = (filter == GR_FILTER_BILINEAR);
+    s->format = surface->format;
+    if (s->bilinear && bpp == 2) s->format = GGL_PIXEL_FORMAT_RGBX_8888;
+    s->sstride = surface->stride * bpp;
+    s->src = surface->data + sy * s->sstride + sx * bpp;
+    s->sw = sw;
+    s->sh = sh;
+    centre = s->bilinear ? 0x8000 : 0;
+    s->xstep = ((long long) sw << 16) / dw;
+    s->ystep = ((long long) sh << 16) / dh;
+    s->x = s->xstep / 2 - centre + x0 * s->xstep;
+    s->y = s->ystep / 2 - centre + y0 * s->ystep;
+    s->w = w;
+    s->have[0] = s->have[1] = -1;
+    s->buf[0] = malloc(w * 4 * 3);
+    s->buf[1] = s->buf[0] + w * 4;
+    s->buf[2] = s->buf[1] + w * 4;
+    return s->buf[0] != NULL ? 0 : -1;
+}
+
+static const unsigned char *scaler_source(GRScaler *s, int n)
+{
+    unsigned char *row = s->buf[n & 1];
+
+    if (s->have[n & 1] != n) {
+        s->k->lerp_x(row, s->src + n * s->sstride, s->sw, s->x, s->xstep,
+                     s->w);
+        s->have[n & 1] = n;
+    }
+    return row;
+}
+
+/* row j of the scaled pixels */
+static const unsigned char *scaler_row(GRScaler *s, int j)
+{
+    unsigned f;
+    int n = gr_scale_pos(s->y + j * s->ystep, s->sh, &f);
+
+    if (!s->bilinear) {
+        s->k->scale_nearest(s->buf[2], s->src + n * s->sstride, s->sw,
+                            s->x, s->xstep, s->w);
+        return s->buf[2];
+    }
+    if (f == 0) return scaler_source(s, n);
+    s->k->lerp_y(s->buf[2], scaler_source(s, n), scaler_source(s, n + 1),
+                 s->w * 4, f);
+    return s->buf[2];
+}
+
+static void native_scale(const GRRect *clip, const GGLSurface *surface,
+                         int sx, int sy, int sw, int sh, int dx, int dy,
+                         int dw, int dh, int filter)
+{
+    GRScaler s;
+    GRRect r;
+    int j;
+
+    r.x0 = dx; r.y0 = dy; r.x1 = dx + dw; r.y1 = dy + dh;
+    if (!rect_intersect(&r, clip)) return;
+
+    if (scaler_init(&s, surface, sx, sy, sw, sh, dw, dh, filter,
+                    r.x0 - dx, r.y0 - dy, r.x1 - r.x0) < 0) {
+        perror("scaled blit");
+        return;
+    }
+    for (j = r.y0; j < r.y1; j++) {
+        blit_pixels(draw_pixels(r.x0, j), scaler_row(&s, j - r.y0),
+                    s.format, 0, r.x1 - r.x0, 1);
+    }
+    free(s.buf[0]);
+}
+
+GGLSurface *gr_scaled_surface(const GGLSurface *surface, int w, int h)
+{
+    GRScaler s;
+    GGLSurface *out;
+    const GRKernels *k = gr_get_kernels(surface->format);
+    int bpp = gr_bytes_per_pixel(surface->format);
+    int j;
+
+    if (w <= 0 || h <= 0) return NULL;
+    out = malloc(sizeof(*out) + (size_t) w * h * bpp);
+    if (out == NULL) return NULL;
+    if (scaler_init(&s, surface, 0, 0, surface->width, surface->height,
+                    w, h, GR_FILTER_BILINEAR, 0, 0, w) < 0) {
+        free(out);
+        return NULL;
+    }
+    *out = *surface;
+    out->width = w;
+    out->height = h;
+    out->stride = w;
+    out->data = (unsigned char *) (out + 1);
+    for (j = 0; j < h; j++) {
+        const unsigned char *row = scaler_row(&s, j);
+        unsigned char *dst = out->data + j * w * bpp;
+        if (s.format == surface->format) {
+            memcpy(dst, row, w * bpp);
+        } else {
+            /* RGB_565 was filtered as RGBX_8888 */
+            k->copy_rgbx(dst, 0, row, 0, w, 1);
+        }
+    }
+    free(s.buf[0]);
+    return out;
+}
+
+static int draw_text(int x, int y, const char *s)
 {
     GGLContext *gl = gr_context;
     GRFont *font = gr_font;
-    unsigned off;
+    const GRKernels *k = gr_kernels;
+    unsigned cp;
+    int x0;
 
     y -= font->ascent;
+    x0 = x;
+
+    if (k != NULL && k->blend_a1 != NULL) {
+        native_text(&gr_clip, &gr_current_color, text_run_get(font, s), 1,
+                    x, y, s);
+        x += font->cwidth * gr_utf8_length(s);
+        gr_damage_rect(x0, y, x, y + font->cheight);
+        return x;
+    }
+
+    if (font_texture(font) < 0) return x;
 
-    gl->bindTexture(gl, &font->texture);
     gl->texEnvi(gl, GGL_TEXTURE_ENV, GGL_TEXTURE_ENV_MODE, GGL_REPLACE);
     gl->texGeni(gl, GGL_S, GGL_TEXTURE_GEN_MODE, GGL_ONE_TO_ONE);
     gl->texGeni(gl, GGL_T, GGL_TEXTURE_GEN_MODE, GGL_ONE_TO_ONE);
     gl->enable(gl, GGL_TEXTURE_2D);
 
-    while((off = *s++)) {
-        off -= 32;
-        if (off < 96) {
-            gl->texCoord2i(gl, (off * font->cwidth) - x, 0 - y);
+    while ((cp = gr_utf8_next(&s))) {
+        if (cp >= 32 && cp < 128) {
+            gl->bindTexture(gl, &font->texture);
+            gl->texCoord2i(gl, ((cp - 32) * font->cwidth) - x, 0 - y);
             gl->recti(gl, x, y, x + font->cwidth, y + font->cheight);
+        } else if (cp >= 128) {
+            GRGlyph g;
+            gr_glyph_get(cp, &g);
+            if (glyph_texture(font, g.bits, g.stride, g.bx) == 0) {
+                gl->bindTexture(gl, &font->glyph);
+                gl->texCoord2i(gl, 0 - x, 0 - y);
+                gl->recti(gl, x, y, x + font->cwidth, y + font->cheight);
+            }
         }
         x += font->cwidth;
     }
+    gr_damage_rect(x0, y, x, y + font->cheight);
 
     return x;
 }
 
-void gr_fill(int x, int y, int w, int h)
+static void draw_fill(int x, int y, int w, int h)
 {
     GGLContext *gl = gr_context;
+
+    gr_damage_rect(x, y, w, h);
+
+    if (gr_kernels != NULL) {
+        native_fill(&gr_clip, &gr_current_color, x, y, w, h);
+        return;
+    }
+
     gl->disable(gl, GGL_TEXTURE_2D);
     gl->recti(gl, x, y, w, h);
 }
 
-void gr_blit(gr_surface source, int sx, int sy, int w, int h, int dx, int dy) {
-    if (gr_context == NULL) {
+void gr_dim(int x, int y, int w, int h, unsigned char alpha)
+{
+    GRColor saved = gr_current_color;
+
+    gr_color(0, 0, 0, alpha);
+    gr_fill(x, y, w, h);
+    gr_color(saved.r, saved.g, saved.b, saved.a);
+}
+
+static void draw_blit(gr_surface source, int sx, int sy, int w, int h,
+                      int dx, int dy)
+{
+    GGLContext *gl = gr_context;
+    GGLSurface *surface = (GGLSurface*) source;
+
+    gr_damage_rect(dx, dy, dx + w, dy + h);
+
+    if (gr_kernels != NULL && surface != NULL &&
+        blit_supported(surface->format)) {
+        native_blit(&gr_clip, surface, sx, sy, w, h, dx, dy);
         return;
     }
-    GGLContext *gl = gr_context;
 
-    gl->bindTexture(gl, (GGLSurface*) source);
+    gl->bindTexture(gl, surface);
     gl->texEnvi(gl, GGL_TEXTURE_ENV, GGL_TEXTURE_ENV_MODE, GGL_REPLACE);
     gl->texGeni(gl, GGL_S, GGL_TEXTURE_GEN_MODE, GGL_ONE_TO_ONE);
     gl->texGeni(gl, GGL_T, GGL_TEXTURE_GEN_MODE, GGL_ONE_TO_ONE);
@@ -256,6 +1163,619 @@ void gr_blit(gr_surface source, int sx, int sy, int w, int h, int dx, int dy) {
     gl->recti(gl, dx, dy, dx + w, dy + h);
 }
 
+/* clip is in addition to gr_clip */
+static void draw_scaled(gr_surface source, int sx, int sy, int sw, int sh,
+                        int dx, int dy, int dw, int dh, int filter,
+                        const GRRect *clip)
+{
+    GGLSurface *surface = (GGLSurface*) source;
+    GRRect r = *clip;
+
+    /* clip lies within the scaled copy */
+    gr_damage_rect(r.x0, r.y0, r.x1, r.y1);
+    if (!rect_intersect(&r, &gr_clip)) return;
+
+    /* pixelflinger is only ever set up for one-to-one blits */
+    if (gr_kernels != NULL && surface != NULL &&
+        blit_supported(surface->format)) {
+        native_scale(&r, surface, sx, sy, sw, sh, dx, dy, dw, dh, filter);
+    }
+}
+
+static GRCommand *list_add(int type, int x0, int y0, int x1, int y1)
+{
+    GRList *l = gr_list_new;
+    GRCommand *c;
+
+    if (l->count == l->size) {
+        unsigned size = l->size ? l->size * 2 : 64;
+        GRCommand *cmd = realloc(l->cmd, size * sizeof(*cmd));
+        if (cmd == NULL) return NULL;
+        l->cmd = cmd;
+        l->size = size;
+    }
+    c = &l->cmd[l->count++];
+    memset(c, 0, sizeof(*c));
+    c->type = type;
+    c->bounds.x0 = x0;
+    c->bounds.y0 = y0;
+    c->bounds.x1 = x1;
+    c->bounds.y1 = y1;
+    return c;
+}
+
+static unsigned cmd_hash(const GRCommand *c)
+{
+    unsigned h = 5381;
+    const char *p;
+
+    h = h * 33 + c->type;
+    h = h * 33 + (c->color.r | c->color.g << 8 | c->color.b << 16 |
+                  (unsigned) c->color.a << 24);
+    h = h * 33 + (unsigned) (size_t) c->source;
+    h = h * 33 + c->sx; h = h * 33 + c->sy;
+    h = h * 33 + c->w;  h = h * 33 + c->h;
+    h = h * 33 + c->x;  h = h * 33 + c->y;
+    h = h * 33 + c->dw; h = h * 33 + c->dh; h = h * 33 + c->filter;
+    for (p = c->text; p != NULL && *p; p++) h = h * 33 + (unsigned char) *p;
+    return h;
+}
+
+static int cmd_equal(const GRCommand *a, const GRCommand *b)
+{
+    return a->hash == b->hash && a->type == b->type &&
+           !memcmp(&a->color, &b->color, sizeof(a->color)) &&
+           a->source == b->source && a->sx == b->sx && a->sy == b->sy &&
+           a->w == b->w && a->h == b->h && a->x == b->x && a->y == b->y &&
+           a->dw == b->dw && a->dh == b->dh && a->filter == b->filter &&
+           !memcmp(&a->bounds, &b->bounds, sizeof(a->bounds)) &&
+           (a->text == NULL || !strcmp(a->text, b->text));
+}
+
+/* Out of memory while recording: draw what was recorded, and the rest
+ * of the frame straight away; the next list is drawn in full. */
+static void list_failed(void)
+{
+    gr_list_end();
+    gr_list_valid = 0;
+}
+
+int gr_text(int x, int y, const char *s)
+{
+    if (gr_recording) {
+        int x1 = x + gr_font->cwidth * gr_utf8_length(s);
+        int y0 = y - gr_font->ascent;
+        GRCommand *c = list_add(GR_CMD_TEXT, x, y0, x1, y0 + gr_font->cheight);
+        if (c != NULL && (c->text = strdup(s)) != NULL) {
+            c->color = gr_current_color;
+            c->x = x;
+            c->y = y;
+            c->hash = cmd_hash(c);
+            return x1;
+        }
+        if (c != NULL) gr_list_new->count--;
+        list_failed();
+    }
+    gr_list_valid = 0;
+    return draw_text(x, y, s);
+}
+
+void gr_fill(int x, int y, int w, int h)
+{
+    if (gr_recording) {
+        GRCommand *c = list_add(GR_CMD_FILL, x, y, w, h);
+        if (c != NULL) {
+            c->color = gr_current_color;
+            c->x = x;
+            c->y = y;
+            c->w = w;
+            c->h = h;
+            c->hash = cmd_hash(c);
+            return;
+        }
+        list_failed();
+    }
+    gr_list_valid = 0;
+    draw_fill(x, y, w, h);
+}
+
+void gr_blit(gr_surface source, int sx, int sy, int w, int h, int dx, int dy) {
+    if (gr_context == NULL) {
+        return;
+    }
+    if (gr_recording) {
+        GRCommand *c = list_add(GR_CMD_BLIT, dx, dy, dx + w, dy + h);
+        if (c != NULL) {
+            c->source = source;
+            c->sx = sx;
+            c->sy = sy;
+            c->w = w;
+            c->h = h;
+            c->x = dx;
+            c->y = dy;
+            c->hash = cmd_hash(c);
+            return;
+        }
+        list_failed();
+    }
+    gr_list_valid = 0;
+    draw_blit(source, sx, sy, w, h, dx, dy);
+}
+
+void gr_blit_scaled(gr_surface source, int sx, int sy, int sw, int sh,
+                    int dx, int dy, int dw, int dh, const gr_rect *clip,
+                    int filter)
+{
+    GGLSurface *surface = (GGLSurface*) source;
+    GRRect r;
+
+    if (gr_context == NULL || surface == NULL || sw <= 0 || sh <= 0 ||
+        dw <= 0 || dh <= 0 || sx < 0 || sy < 0 ||
+        sx + sw > (int) surface->width || sy + sh > (int) surface->height) {
+        return;
+    }
+    r.x0 = dx; r.y0 = dy; r.x1 = dx + dw; r.y1 = dy + dh;
+    if (clip != NULL) {
+        GRRect o = { clip->x0, clip->y0, clip->x1, clip->y1 };
+        if (!rect_intersect(&r, &o)) return;
+    }
+
+    if (gr_recording) {
+        GRCommand *c = list_add(GR_CMD_SCALE, r.x0, r.y0, r.x1, r.y1);
+        if (c != NULL) {
+            c->source = source;
+            c->sx = sx;
+            c->sy = sy;
+            c->w = sw;
+            c->h = sh;
+            c->x = dx;
+            c->y = dy;
+            c->dw = dw;
+            c->dh = dh;
+            c->filter = filter;
+            c->hash = cmd_hash(c);
+            return;
+        }
+        list_failed();
+    }
+    gr_list_valid = 0;
+    draw_scaled(source, sx, sy, sw, sh, dx, dy, dw, dh, filter, &r);
+}
+
+static void list_clear(GRList *l)
+{
+    unsigned i;
+    for (i = 0; i < l->count; i++) {
+        free(l->cmd[i].text);
+    }
+    l->count = 0;
+}
+
+static void list_free(GRList *l)
+{
+    list_clear(l);
+    free(l->cmd);
+    l->cmd = NULL;
+    l->size = 0;
+}
+
+static inline int rect_overlap(const GRRect *a, const GRRect *b)
+{
+    return a->x0 < b->x1 && b->x0 < a->x1 && a->y0 < b->y1 && b->y0 < a->y1;
+}
+
+/* Merges overlapping rectangles of d, so that no pixel is redrawn
+ * twice; translucent commands would otherwise be applied again.  A
+ * merged rectangle may reach ones already passed, so the scan repeats
+ * until nothing merges. */
+static void damage_disjoint(GRDamage *d)
+{
+    unsigned i, j;
+    int merged;
+
+    do {
+        merged = 0;
+        for (i = 0; i < d->count; i++) {
+            for (j = i + 1; j < d->count; ) {
+                if (rect_overlap(&d->rect[i], &d->rect[j])) {
+                    rect_union(&d->rect[i], &d->rect[j]);
+                    d->rect[j] = d->rect[--d->count];
+                    merged = 1;
+                } else {
+                    j++;
+                }
+            }
+        }
+    } while (merged);
+}
+
+static inline void damage_add_rect(GRDamage *d, const GRRect *r)
+{
+    damage_add(d, r->x0, r->y0, r->x1, r->y1);
+}
+
+/* Adds to dirty the bounds of every command of o and n outside their
+ * longest common subsequence.  Returns -1 if the lists are too long to
+ * compare. */
+static int list_diff(const GRList *o, const GRList *n, GRDamage *dirty)
+{
+    const GRCommand *a = o->cmd, *b = n->cmd;
+    unsigned na = o->count, nb = n->count, i, j, w;
+    unsigned short *len;
+
+    /* most updates change a few commands in the middle */
+    while (na > 0 && nb > 0 && cmd_equal(a, b)) {
+        a++; b++; na--; nb--;
+    }
+    while (na > 0 && nb > 0 && cmd_equal(&a[na - 1], &b[nb - 1])) {
+        na--; nb--;
+    }
+    if (na == 0 || nb == 0) {
+        for (i = 0; i < na; i++) damage_add_rect(dirty, &a[i].bounds);
+        for (j = 0; j < nb; j++) damage_add_rect(dirty, &b[j].bounds);
+        return 0;
+    }
+    if (na > GR_LIST_DIFF_MAX || nb > GR_LIST_DIFF_MAX) return -1;
+
+    /* len[i * w + j] is the length of the LCS of a[i..] and b[j..] */
+    w = nb + 1;
+    len = calloc((na + 1) * w, sizeof(*len));
+    if (len == NULL) return -1;
+    for (i = na; i-- > 0;) {
+        for (j = nb; j-- > 0;) {
+            unsigned short down = len[(i + 1) * w + j];
+            unsigned short right = len[i * w + j + 1];
+            if (cmd_equal(&a[i], &b[j])) {
+                len[i * w + j] = len[(i + 1) * w + j + 1] + 1;
+            } else {
+                len[i * w + j] = down > right ? down : right;
+            }
+        }
+    }
+
+    i = j = 0;
+    while (i < na || j < nb) {
+        if (i < na && j < nb && cmd_equal(&a[i], &b[j])) {
+            i++; j++;
+        } else if (j == nb ||
+                   (i < na && len[(i + 1) * w + j] >= len[i * w + j + 1])) {
+            damage_add_rect(dirty, &a[i++].bounds);
+        } else {
+            damage_add_rect(dirty, &b[j++].bounds);
+        }
+    }
+    free(len);
+    return 0;
+}
+
+static void draw_command(const GRCommand *c)
+{
+    switch (c->type) {
+    case GR_CMD_FILL:
+        gr_color(c->color.r, c->color.g, c->color.b, c->color.a);
+        draw_fill(c->x, c->y, c->w, c->h);
+        break;
+    case GR_CMD_BLIT:
+        draw_blit(c->source, c->sx, c->sy, c->w, c->h, c->x, c->y);
+        break;
+    case GR_CMD_TEXT:
+        gr_color(c->color.r, c->color.g, c->color.b, c->color.a);
+        draw_text(c->x, c->y, c->text);
+        break;
+    case GR_CMD_SCALE:
+        draw_scaled(c->source, c->sx, c->sy, c->w, c->h, c->x, c->y,
+                    c->dw, c->dh, c->filter, &c->bounds);
+        break;
+    }
+}
+
+/* whether c leaves no pixel of its bounds showing what was below */
+static int cmd_opaque(const GRCommand *c)
+{
+    const GGLSurface *s = c->source;
+
+    switch (c->type) {
+    case GR_CMD_FILL:
+        return c->color.a == 255;
+    case GR_CMD_BLIT:
+        return s != NULL && c->sx >= 0 && c->sy >= 0 &&
+               c->sx + c->w <= (int) s->width &&
+               c->sy + c->h <= (int) s->height &&
+               (s->format == gr_draw->format ||
+                s->format == GGL_PIXEL_FORMAT_RGBX_8888);
+    }
+    return 0;
+}
+
+/* The last command of l to cover r with opaque pixels hides all before
+ * it, so drawing r can start there. */
+static unsigned first_visible(const GRList *l, const GRRect *r)
+{
+    unsigned j = l->count;
+
+    while (j-- > 0) {
+        const GRCommand *c = &l->cmd[j];
+        if (c->bounds.x0 <= r->x0 && c->bounds.y0 <= r->y0 &&
+            c->bounds.x1 >= r->x1 && c->bounds.y1 >= r->y1 && cmd_opaque(c))
+            return j;
+    }
+    return 0;
+}
+
+static int overlaps_dirty(const GRCommand *c, const GRDamage *dirty)
+{
+    unsigned i;
+    for (i = 0; i < dirty->count; i++) {
+        if (rect_overlap(&c->bounds, &dirty->rect[i])) return 1;
+    }
+    return 0;
+}
+
+/* The list may be split only if every command to redraw has a native
+ * path, and the redraw is big enough to pay for waking the workers.
+ * The workers only read the text run cache, so the runs are made here;
+ * if they do not all fit, the list is drawn serially. */
+static int bands_usable(const GRList *l, const GRDamage *dirty)
+{
+    unsigned i, j;
+    int area = 0;
+
+    if (gr_bands < 2 || gr_kernels == NULL || gr_kernels->blend_a1 == NULL)
+        return 0;
+    for (i = 0; i < dirty->count; i++) area += rect_area(&dirty->rect[i]);
+    if (area < GR_BAND_MIN_PIXELS) return 0;
+
+    for (j = 0; j < l->count; j++) {
+        const GGLSurface *surface = l->cmd[j].source;
+        if ((l->cmd[j].type == GR_CMD_BLIT ||
+             l->cmd[j].type == GR_CMD_SCALE) &&
+            (surface == NULL || !blit_supported(surface->format)))
+            return 0;
+    }
+
+    for (j = 0; j < l->count; j++) {
+        const GRCommand *c = &l->cmd[j];
+        if (c->type == GR_CMD_TEXT && overlaps_dirty(c, dirty))
+            text_run_get(gr_font, c->text);
+    }
+    for (j = 0; j < l->count; j++) {
+        const GRCommand *c = &l->cmd[j];
+        if (c->type == GR_CMD_TEXT && overlaps_dirty(c, dirty) &&
+            text_run_find(gr_font, c->text, text_hash(c->text)) == NULL)
+            return 0;
+    }
+    return 1;
+}
+
+static void native_command(const GRRect *clip, const GRCommand *c)
+{
+    switch (c->type) {
+    case GR_CMD_FILL:
+        native_fill(clip, &c->color, c->x, c->y, c->w, c->h);
+        break;
+    case GR_CMD_BLIT:
+        native_blit(clip, c->source, c->sx, c->sy, c->w, c->h, c->x, c->y);
+        break;
+    case GR_CMD_TEXT:
+        native_text(clip, &c->color,
+                    text_run_find(gr_font, c->text, text_hash(c->text)), 0,
+                    c->x, c->y - gr_font->ascent, c->text);
+        break;
+    case GR_CMD_SCALE: {
+        GRRect r = *clip;
+        if (rect_intersect(&r, &c->bounds)) {
+            native_scale(&r, c->source, c->sx, c->sy, c->w, c->h, c->x, c->y,
+                         c->dw, c->dh, c->filter);
+        }
+        break;
+    }
+    }
+}
+
+static void band_draw(int band)
+{
+    const GRList *l = gr_band_list;
+    const GRDamage *d = gr_band_dirty;
+    unsigned i, j;
+
+    for (i = 0; i < d->count; i++) {
+        GRRect clip = d->rect[i];
+        int h = clip.y1 - clip.y0;
+        clip.y0 = d->rect[i].y0 + h * band / gr_bands;
+        clip.y1 = d->rect[i].y0 + h * (band + 1) / gr_bands;
+        if (clip.y0 >= clip.y1) continue;
+        for (j = first_visible(l, &clip); j < l->count; j++) {
+            if (rect_overlap(&l->cmd[j].bounds, &clip))
+                native_command(&clip, &l->cmd[j]);
+        }
+    }
+}
+
+static void *band_thread(void *arg)
+{
+    int band = (int) (size_t) arg;
+    unsigned job = 0;
+
+    pthread_mutex_lock(&gr_band_lock);
+    for (;;) {
+        while (gr_band_job == job && !gr_band_stop) {
+            pthread_cond_wait(&gr_band_start, &gr_band_lock);
+        }
+        if (gr_band_stop) break;
+        job = gr_band_job;
+        pthread_mutex_unlock(&gr_band_lock);
+
+        band_draw(band);
+
+        pthread_mutex_lock(&gr_band_lock);
+        if (--gr_band_busy == 0) pthread_cond_signal(&gr_band_done);
+    }
+    pthread_mutex_unlock(&gr_band_lock);
+    return NULL;
+}
+
+static void bands_draw(const GRList *l, const GRDamage *dirty)
+{
+    unsigned i, j;
+
+    /* the workers leave the damage to us */
+    for (i = 0; i < dirty->count; i++) {
+        const GRRect *r = &dirty->rect[i];
+        for (j = 0; j < l->count; j++) {
+            GRRect u = l->cmd[j].bounds;
+            if (!rect_overlap(&u, r)) continue;
+            if (u.x0 < r->x0) u.x0 = r->x0;
+            if (u.y0 < r->y0) u.y0 = r->y0;
+            if (u.x1 > r->x1) u.x1 = r->x1;
+            if (u.y1 > r->y1) u.y1 = r->y1;
+            gr_damage_rect(u.x0, u.y0, u.x1, u.y1);
+        }
+    }
+
+    pthread_mutex_lock(&gr_band_lock);
+    gr_band_list = l;
+    gr_band_dirty = dirty;
+    gr_band_busy = gr_bands - 1;
+    gr_band_job++;
+    pthread_cond_broadcast(&gr_band_start);
+    pthread_mutex_unlock(&gr_band_lock);
+
+    band_draw(0);
+
+    /* all bands have to be finished before the page can be flipped */
+    pthread_mutex_lock(&gr_band_lock);
+    while (gr_band_busy > 0) {
+        pthread_cond_wait(&gr_band_done, &gr_band_lock);
+    }
+    pthread_mutex_unlock(&gr_band_lock);
+}
+
+static void bands_start(void)
+{
+    int n;
+
+    gr_band_stop = 0;
+    gr_band_job = 0;
+    for (n = 1; n < gr_bands_wanted; n++) {
+        if (pthread_create(&gr_band_threads[n], NULL, band_thread,
+                           (void *) (size_t) n) != 0)
+            break;
+    }
+    gr_bands = n;
+}
+
+static void bands_stop(void)
+{
+    int n;
+
+    pthread_mutex_lock(&gr_band_lock);
+    gr_band_stop = 1;
+    pthread_cond_broadcast(&gr_band_start);
+    pthread_mutex_unlock(&gr_band_lock);
+    for (n = 1; n < gr_bands; n++) {
+        pthread_join(gr_band_threads[n], NULL);
+    }
+    gr_bands = 1;
+}
+
+void gr_list_begin(void)
+{
+    list_clear(gr_list_new);
+    gr_recording = 1;
+}
+
+void gr_list_end(void)
+{
+    GRList *l = gr_list_new;
+    GRColor saved = gr_current_color;
+    GRDamage dirty;
+    unsigned i, j;
+
+    if (!gr_recording) return;
+    gr_recording = 0;
+
+    dirty.count = 0;
+    if (!gr_list_valid || list_diff(gr_list_old, l, &dirty) < 0) {
+        dirty.count = 0;
+        damage_add(&dirty, 0, 0, gr_draw->width, gr_draw->height);
+    }
+    damage_disjoint(&dirty);
+
+    if (bands_usable(l, &dirty)) {
+        bands_draw(l, &dirty);
+    } else {
+        for (i = 0; i < dirty.count; i++) {
+            GRRect *r = &dirty.rect[i];
+            set_clip(r->x0, r->y0, r->x1, r->y1);
+            for (j = first_visible(l, r); j < l->count; j++) {
+                if (rect_overlap(&l->cmd[j].bounds, r))
+                    draw_command(&l->cmd[j]);
+            }
+        }
+        set_clip(0, 0, gr_draw->width, gr_draw->height);
+        gr_color(saved.r, saved.g, saved.b, saved.a);
+    }
+
+    gr_list_new = gr_list_old;
+    gr_list_old = l;
+    gr_list_valid = 1;
+}
+
+/* surface is about to be drawn into: blits of it in the last list stop
+ * matching, so wherever the next list shows it is redrawn */
+static void list_forget(const GGLSurface *surface)
+{
+    GRList *l = gr_list_old;
+    unsigned i;
+
+    for (i = 0; i < l->count; i++) {
+        if (l->cmd[i].source == surface) l->cmd[i].type = GR_CMD_STALE;
+    }
+}
+
+gr_surface gr_create_surface(int width, int height)
+{
+    GGLSurface *s;
+    int format, bpp;
+
+    if (gr_draw == NULL || width <= 0 || height <= 0) return NULL;
+    format = gr_draw->format;
+    bpp = gr_bytes_per_pixel(format);
+
+    s = malloc(sizeof(*s) + (size_t) width * height * bpp);
+    if (s == NULL) return NULL;
+    s->version = sizeof(*s);
+    s->width = width;
+    s->height = height;
+    s->stride = width;
+    s->data = (unsigned char *) (s + 1);
+    s->format = format;
+    return s;
+}
+
+void gr_draw_to(gr_surface surface)
+{
+    GGLSurface *s = (GGLSurface*) surface;
+
+    if (gr_draw == NULL) return;
+    if (s == NULL) {
+        if (gr_screen == NULL) return;
+        set_draw_surface(gr_screen);
+        gr_screen = NULL;
+        gr_recording = gr_screen_recording;
+        gr_list_valid = gr_screen_list_valid;
+        return;
+    }
+    if (gr_screen == NULL) {
+        gr_screen = gr_draw;
+        gr_screen_recording = gr_recording;
+        gr_screen_list_valid = gr_list_valid;
+        gr_recording = 0;
+    }
+    list_forget(s);
+    set_draw_surface(s);
+}
+
 unsigned int gr_get_width(gr_surface surface) {
     if (surface == NULL) {
         return 0;
@@ -272,33 +1792,30 @@ unsigned int gr_get_height(gr_surface surface) {
 
 static void gr_init_font(void)
 {
-    GGLSurface *ftex;
-    unsigned char *bits, *rle;
-    unsigned char *in, data;
-
     gr_font = calloc(sizeof(*gr_font), 1);
-    ftex = &gr_font->texture;
 
-    bits = malloc(font.width * font.height);
-
-    ftex->version = sizeof(*ftex);
-    ftex->width = font.width;
-    ftex->height = font.height;
-    ftex->stride = font.width;
-    ftex->data = (void*) bits;
-    ftex->format = GGL_PIXEL_FORMAT_A_8;
-
-    in = font.rundata;
-    while((data = *in++)) {
-        memset(bits, (data & 0x80) ? 255 : 0, data & 0x7f);
-        bits += (data & 0x7f);
-    }
+    /* the kernels draw straight from the packed bits */
+    gr_font->bits = font.bits;
+    gr_font->stride = font.stride;
+    gr_font->width = font.width;
+    gr_font->height = font.height;
 
     gr_font->cwidth = font.cwidth;
     gr_font->cheight = font.cheight;
     gr_font->ascent = font.cheight - 2;
 }
 
+/* MINUI_BACKEND=virtual runs without a display, e.g. on a build host */
+static minui_backend *gr_open_backend(void)
+{
+    const char *name = getenv("MINUI_BACKEND");
+
+    if (name != NULL && strcmp(name, "virtual") == 0) {
+        return open_virtual();
+    }
+    return open_fbdev();
+}
+
 int gr_init(void)
 {
     gglInit(&gr_context);
@@ -306,66 +1823,308 @@ int gr_init(void)
 
     gr_init_font();
 
-    gr_fb_fd = get_framebuffer(gr_framebuffer);
-    if (gr_fb_fd < 0) {
-        gr_exit();
-        return -1;
+    /* already open if a snapshot is on screen */
+    if (gr_backend == NULL) {
+        gr_backend = gr_open_backend();
+        if (gr_backend->init(gr_backend, gr_framebuffer) < 0) {
+            gr_backend = NULL;
+            gr_exit();
+            return -1;
+        }
     }
 
-    get_memory_surface(&gr_mem_surface);
-
         /* start with 0 as front (displayed) and 1 as back (drawing) */
     gr_active_fb = 0;
-    set_active_framebuffer(0);
-    gl->colorBuffer(gl, &gr_mem_surface);
+    gr_rotation = gr_rotation_wanted;
+    if (gr_rotation && gr_get_kernels(gr_framebuffer[0].format) == NULL) {
+        fprintf(stderr, "cannot rotate pixel format %d\n",
+                gr_framebuffer[0].format);
+        gr_rotation = 0;
+    }
+    /* a turned frame has to be copied into the page anyway */
+    gr_direct = (gr_rotation == 0 &&
+                 gr_backend->init_direct(gr_backend) == 0);
+    if (gr_direct && gr_triple_wanted &&
+        gr_backend->init_triple(gr_backend, &gr_framebuffer[2]) == 0) {
+        gr_vsync_stop = 0;
+        gr_page_pending = gr_page_showing = -1;
+        gr_triple = (pthread_create(&gr_vsync_thread, NULL, vsync_thread,
+                                    NULL) == 0);
+    }
+    if (gr_direct) {
+        /* all pages start out the same: cleared, or the snapshot */
+        gr_page_frame[0] = gr_page_frame[1] = gr_frame - 1;
+        gr_page_frame[2] = gr_frame - 1;
+        gr_page_back = 1;
+        set_draw_surface(&gr_framebuffer[1]);
+    } else {
+        get_memory_surface(&gr_mem_surface);
+        gr_backend->show(gr_backend, 0);
+        set_draw_surface(&gr_mem_surface);
+    }
+
+    bands_start();
+
+    if (gr_stream_address[0] != '\0') {
+        gr_stream_todo.count = 0;
+        damage_add(&gr_stream_todo, 0, 0, gr_fb_width(), gr_fb_height());
+        gr_streaming = (gr_stream_open(gr_stream_address, gr_fb_width(),
+                                       gr_fb_height(), gr_draw->format) == 0);
+    }
 
     gl->activeTexture(gl, 0);
     gl->enable(gl, GGL_BLEND);
     gl->blendFunc(gl, GGL_SRC_ALPHA, GGL_ONE_MINUS_SRC_ALPHA);
 
-    gr_fb_blank(true);
-    gr_fb_blank(false);
+    /* the panel was already woken up to show the snapshot */
+    if (!gr_snapshot_shown) {
+        gr_fb_blank(true);
+        gr_fb_blank(false);
+    }
 
     return 0;
 }
 
 void gr_exit(void)
 {
+    if (gr_triple) {
+        pthread_mutex_lock(&gr_lock);
+        gr_vsync_stop = 1;
+        pthread_mutex_unlock(&gr_lock);
+        pthread_join(gr_vsync_thread, NULL);
+        gr_triple = 0;
+        fprintf(stderr, "vsync: %u frames shown, %u vsyncs missed, "
+                "%u frames dropped\n", gr_vsync_shown, gr_vsync_missed,
+                gr_vsync_dropped);
+    }
 
+    bands_stop();
+    gr_screenshot_finish();
+
+    if (gr_streaming) {
+        gr_stream_close();
+        gr_streaming = 0;
+    }
+
+    gr_draw_to(NULL);
     free(gr_mem_surface.data);
-    free(gr_font_texture.data);
+    if (gr_font != NULL) {
+        free(gr_font->texture.data);
+        free(gr_font->glyph.data);
+    }
+    text_cache_clear();
+    gr_glyph_cache_clear();
+    list_free(&gr_lists[0]);
+    list_free(&gr_lists[1]);
+    gr_recording = 0;
+    gr_list_valid = 0;
 
 	GGLContext *gl = gr_context;
 	gglUninit(gl);
 
-    close(gr_fb_fd);
-    gr_fb_fd = -1;
+    if (gr_backend != NULL) {
+        gr_backend->exit(gr_backend);
+        gr_backend = NULL;
+    }
+    gr_snapshot_shown = 0;
+}
 
-    ioctl(gr_vt_fd, KDSETMODE, (void*) KD_TEXT);
-    close(gr_vt_fd);
-    gr_vt_fd = -1;
+static int read_full(int fd, void *buf, size_t len)
+{
+    unsigned char *p = buf;
+    ssize_t n;
+
+    while (len > 0) {
+        n = read(fd, p, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+int gr_snapshot_show(const char *path, unsigned key)
+{
+    GRSnapshotHeader h;
+    GGLSurface *fb = &gr_framebuffer[0];
+    struct stat st;
+    size_t line;
+    unsigned y;
+    int fd;
+
+    if (gr_backend != NULL) return -1;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    if (read_full(fd, &h, sizeof(h)) < 0 || memcmp(h.magic, "GRSN", 4) ||
+        h.key != key || fstat(fd, &st) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    /* the display is opened here, once, and gr_init() takes it over */
+    gr_backend = gr_open_backend();
+    if (gr_backend->init(gr_backend, gr_framebuffer) < 0) {
+        gr_backend = NULL;
+        close(fd);
+        return -1;
+    }
+
+    line = fb->width * gr_bytes_per_pixel(fb->format);
+    if (h.width != fb->width || h.height != fb->height ||
+        h.format != (unsigned) fb->format ||
+        st.st_size != (off_t) (sizeof(h) + line * h.height)) {
+        fprintf(stderr, "snapshot %s is for another display\n", path);
+        close(fd);
+        return -1;
+    }
+
+    /* straight into the page; both pages hold the same frame, so
+     * probing the pan later shows nothing else */
+    for (y = 0; y < fb->height; y++) {
+        unsigned char *row = fb->data +
+                y * fb->stride * gr_bytes_per_pixel(fb->format);
+        if (read_full(fd, row, line) < 0) {
+            fprintf(stderr, "short snapshot %s\n", path);
+            close(fd);
+            memset(fb->data, 0, fb->stride * fb->height *
+                   gr_bytes_per_pixel(fb->format));
+            return -1;
+        }
+    }
+    close(fd);
+    memcpy(gr_framebuffer[1].data, fb->data,
+           fb->stride * fb->height * gr_bytes_per_pixel(fb->format));
+
+    gr_backend->show(gr_backend, 0);
+    gr_fb_blank(true);
+    gr_fb_blank(false);
+    gr_snapshot_shown = 1;
+    return 0;
+}
+
+int gr_snapshot_save(const char *path, unsigned key)
+{
+    GRSnapshotHeader h;
+    const GGLSurface *fb;
+    char tmp[PATH_MAX];
+    size_t line;
+    unsigned y;
+    FILE *f;
+
+    if (gr_backend == NULL) return -1;
+
+    /* The page on screen, unless the display thread has yet to show the
+     * last one posted; the page we draw into has been caught up with
+     * that, and between frames nothing is drawn into it. */
+    if (gr_triple) fb = &gr_framebuffer[gr_page_back];
+    else fb = &gr_framebuffer[gr_active_fb];
+
+    memcpy(h.magic, "GRSN", 4);
+    h.key = key;
+    h.width = fb->width;
+    h.height = fb->height;
+    h.format = fb->format;
+    line = fb->width * gr_bytes_per_pixel(fb->format);
+
+    /* written aside and renamed, so a crash leaves no torn snapshot */
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    f = fopen(tmp, "wb");
+    if (f == NULL) {
+        perror("cannot create snapshot");
+        return -1;
+    }
+    fwrite(&h, sizeof(h), 1, f);
+    for (y = 0; y < fb->height; y++) {
+        fwrite(fb->data + y * fb->stride * gr_bytes_per_pixel(fb->format),
+               line, 1, f);
+    }
+    if (ferror(f) | fclose(f) || rename(tmp, path) < 0) {
+        perror("cannot write snapshot");
+        unlink(tmp);
+        return -1;
+    }
+    return 0;
+}
+
+void gr_set_triple_buffer(bool enable)
+{
+    gr_triple_wanted = enable;
+}
+
+void gr_set_stream(const char *address)
+{
+    strncpy(gr_stream_address, address, sizeof(gr_stream_address) - 1);
+}
+
+void gr_set_rotation(int degrees)
+{
+    degrees %= 360;
+    if (degrees < 0) degrees += 360;
+    gr_rotation_wanted = degrees - degrees % 90;
+}
+
+void gr_set_render_threads(int threads)
+{
+    if (threads < 1) threads = 1;
+    if (threads > GR_MAX_BANDS) threads = GR_MAX_BANDS;
+    gr_bands_wanted = threads;
+}
+
+void gr_vsync_stats(unsigned *shown, unsigned *missed, unsigned *dropped)
+{
+    pthread_mutex_lock(&gr_lock);
+    *shown = gr_vsync_shown;
+    *missed = gr_vsync_missed;
+    *dropped = gr_vsync_dropped;
+    pthread_mutex_unlock(&gr_lock);
 }
 
 int gr_fb_width(void)
 {
+    if (gr_rotation % 180) return gr_framebuffer[0].height;
     return gr_framebuffer[0].width;
 }
 
 int gr_fb_height(void)
 {
+    if (gr_rotation % 180) return gr_framebuffer[0].width;
     return gr_framebuffer[0].height;
 }
 
+void gr_fb_map_point(int *x, int *y)
+{
+    int px = *x, py = *y;
+
+    switch (gr_rotation) {
+    case 90:
+        *x = py;
+        *y = gr_framebuffer[0].width - 1 - px;
+        break;
+    case 180:
+        *x = gr_framebuffer[0].width - 1 - px;
+        *y = gr_framebuffer[0].height - 1 - py;
+        break;
+    case 270:
+        *x = gr_framebuffer[0].height - 1 - py;
+        *y = px;
+        break;
+    }
+}
+
 gr_pixel *gr_fb_data(void)
 {
+    /* the caller may draw into it behind our back */
+    gr_list_valid = 0;
+    if (gr_direct) {
+        GGLSurface *page = gr_screen != NULL ? gr_screen : gr_draw;
+        return (unsigned short *) page->data;
+    }
     return (unsigned short *) gr_mem_surface.data;
 }
 
 void gr_fb_blank(bool blank)
 {
-    int ret;
-
-    ret = ioctl(gr_fb_fd, FBIOBLANK, blank ? FB_BLANK_POWERDOWN : FB_BLANK_UNBLANK);
-    if (ret < 0)
-        perror("ioctl(): blank");
+    gr_backend->blank(gr_backend, blank);
 }
@@ -0,0 +1,437 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _MINUI_GRAPHICS_H_
+#define _MINUI_GRAPHICS_H_
+
+// Internal interfaces of libminui_bm; not for use outside minui/.
+
+#include <stdbool.h>
+
+#include <pixelflinger/pixelflinger.h>
+
+#include "themepack.h"
+
+#define GR_ALWAYS_INLINE inline __attribute__((always_inline))
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define GR_HAVE_NEON 1
+#elif defined(__SSE2__)
+#define GR_HAVE_SSE2 1
+#endif
+
+typedef struct {
+    unsigned char r, g, b, a;
+} GRColor;
+
+// Right and bottom edges are exclusive.
+typedef struct {
+    int x0, y0, x1, y1;
+} GRRect;
+
+// Premultiplied-alpha layouts res_create_surface() produces for images
+// with an alpha channel.  Pixelflinger has no equivalent, so these are
+// only ever drawn by the native kernels.
+#define GR_PIXEL_FORMAT_RGBA_8888_PRE  0x40     // bytes R, G, B, A
+#define GR_PIXEL_FORMAT_BGRA_8888_PRE  0x41     // bytes B, G, R, A
+
+// Framebuffer layout pixelflinger cannot draw; the native kernels cover
+// every primitive for it.
+#define GR_PIXEL_FORMAT_ARGB_8888      0x42     // bytes A, R, G, B
+
+// A display the two framebuffer pages are shown on.  graphics_fbdev.c
+// drives /dev/graphics/fb0; graphics_virtual.c keeps the pages in memory
+// so the UI can run headless.  gr_init() picks one.
+#define GR_MAX_PAGES 3
+
+typedef struct minui_backend minui_backend;
+struct minui_backend {
+    const char *name;
+    // Refresh period in microseconds, set by init(); 0 if unknown.
+    unsigned frame_usec;
+    // Maps the display and fills in both pages, cleared; returns 0, or
+    // a negative value if the display is not available.
+    int (*init)(minui_backend *backend, GGLSurface pages[2]);
+    // Returns 0 if show() switches pages without copying, so we can draw
+    // straight into the hidden one.  Otherwise we draw into memory and
+    // copy into the page about to be shown.
+    int (*init_direct)(minui_backend *backend);
+    // After init_direct() succeeded: sets up a third page to show() as
+    // page 2, holding a copy of page 0, and returns 0, or a negative
+    // value if there is no room.
+    int (*init_triple)(minui_backend *backend, GGLSurface *page);
+    // Blocks until the next vsync; returns a negative value if the
+    // display cannot report it.
+    int (*wait_vsync)(minui_backend *backend);
+    // Puts page n on screen.
+    void (*show)(minui_backend *backend, unsigned n);
+    void (*blank)(minui_backend *backend, bool blank);
+    void (*exit)(minui_backend *backend);
+};
+
+minui_backend *open_fbdev(void);
+minui_backend *open_virtual(void);
+
+// 4x4 ordered dither thresholds for RGB_565, one row of four RGBX pixels
+// per line of the pattern: added to a pixel with saturation before it is
+// truncated, they spread the dropped bits of each channel over the block.
+extern const unsigned char gr_dither_rgbx[4][16];
+
+// Native rasterizer kernels for one destination pixel format.  All of
+// them work on a w x h rectangle that has already been clipped; strides
+// are in bytes.  Any entry may be NULL, in which case the caller falls
+// back to pixelflinger.
+typedef struct {
+    // opaque fill with a pixel already packed by gr_pack_pixel()
+    void (*fill)(unsigned char *dst, int dstride, int w, int h,
+                 unsigned pixel);
+    // blend c over dst using c->a
+    void (*fill_blend)(unsigned char *dst, int dstride, int w, int h,
+                       const GRColor *c);
+    // scale every channel of dst by scale / 255; the same result as
+    // fill_blend with black at alpha 255 - scale
+    void (*dim)(unsigned char *dst, int dstride, int w, int h,
+                unsigned scale);
+    // GGL_PIXEL_FORMAT_RGBX_8888 source, copied as opaque
+    void (*copy_rgbx)(unsigned char *dst, int dstride,
+                      const unsigned char *src, int sstride, int w, int h);
+    // copy_rgbx with an ordered dither, anchored at the top left of the
+    // block, for formats with fewer than 8 bits per channel; the same as
+    // copy_rgbx for the others
+    void (*dither_rgbx)(unsigned char *dst, int dstride,
+                        const unsigned char *src, int sstride, int w, int h);
+    // GGL_PIXEL_FORMAT_RGBA_8888 source, blended over dst
+    void (*blend_rgba)(unsigned char *dst, int dstride,
+                       const unsigned char *src, int sstride, int w, int h);
+    // gr_premultiplied_format() source, blended over dst
+    void (*blend_pre)(unsigned char *dst, int dstride,
+                      const unsigned char *src, int sstride, int w, int h);
+    // GGL_PIXEL_FORMAT_A_8 coverage, blended over dst in color c
+    void (*blend_a8)(unsigned char *dst, int dstride,
+                     const unsigned char *mask, int mstride, int w, int h,
+                     const GRColor *c);
+    // 1-bpp coverage, most significant bit first, starting at bit bx of
+    // each row: set bits are drawn in color c.  Like blend_a8, which
+    // takes alpha from the coverage, this ignores c->a.
+    void (*blend_a1)(unsigned char *dst, int dstride,
+                     const unsigned char *bits, int bstride, int bx,
+                     int w, int h, const GRColor *c);
+    // a w x h block of src in the same format, turned clockwise by
+    // rotation (90, 180 or 270) degrees; dst is the top left corner of
+    // the turned block
+    void (*rotate)(unsigned char *dst, int dstride,
+                   const unsigned char *src, int sstride, int w, int h,
+                   int rotation);
+    // Resamplers for scaled blits.  src is a row of sw pixels in this
+    // format, and x the 16.16 fixed-point position in it of the first of
+    // w dst pixels, advancing by step; positions off the row are clamped
+    // to its ends.  scale_nearest copies the pixel at x >> 16.
+    void (*scale_nearest)(unsigned char *dst, const unsigned char *src,
+                          int sw, int x, int step, int w);
+    // Mixes the pixel at x >> 16 with the next by the fraction in bits
+    // 8-15 of x, one byte at a time; dst gets 4-byte pixels, which are
+    // RGBX_8888 for an RGB_565 row.
+    void (*lerp_x)(unsigned char *dst, const unsigned char *src, int sw,
+                   int x, int step, int w);
+    // n bytes of a and b mixed by f / 256
+    void (*lerp_y)(unsigned char *dst, const unsigned char *a,
+                   const unsigned char *b, int n, unsigned f);
+} GRKernels;
+
+// Returns the kernels for a GGL_PIXEL_FORMAT_* destination, or NULL if
+// that format has none.
+const GRKernels *gr_get_kernels(int format);
+// The same kernels without the SIMD replacements (kernbench.c).
+const GRKernels *gr_get_scalar_kernels(int format);
+unsigned gr_pack_pixel(int format, const GRColor *c);
+
+// Pixel format of the surface primitives currently draw into, or -1
+// before gr_init().
+int gr_draw_format(void);
+
+// The frame last passed to gr_flip(), as drawn; only valid between
+// frames, since the next one is drawn over it.  NULL before gr_init().
+const GGLSurface *gr_last_frame(void);
+// Waits until the screenshots already taken are written (screenshot.c).
+void gr_screenshot_finish(void);
+
+// A bilinear w x h copy of surface, allocated with the pixels after the
+// header the way res_create_surface() does; NULL if out of memory.
+GGLSurface *gr_scaled_surface(const GGLSurface *surface, int w, int h);
+
+// Theme packs (pack.c).  res_pack_find() returns the entry for an image,
+// or NULL if there is no pack or the image is not in it.
+// res_pack_load() returns its pixels in a new surface laid out the way
+// res_create_surface() does, or NULL if out of memory or damaged.
+const ThemePackEntry *res_pack_find(const char *name);
+GGLSurface *res_pack_load(const ThemePackEntry *e);
+
+// Replaces entries of k with the SIMD versions built for this CPU
+// (blend_neon.c, blend_sse2.c); a no-op when there are none.
+void gr_kernels_simd(GRKernels *k, int format);
+
+// A glyph outside the ASCII strip of the built-in font, in the same cell
+// size: row y of its 1-bpp coverage starts at bit bx of bits + y * stride.
+typedef struct {
+    const unsigned char *bits;
+    int stride;
+    int bx;
+} GRGlyph;
+
+// Returns the glyph for cp, unpacking it into the atlas and evicting the
+// least recently used glyph if need be; code points the font lacks get a
+// placeholder.  g stays valid until the next call.
+void gr_glyph_get(unsigned cp, GRGlyph *g);
+// Like gr_glyph_get(), but only for a glyph already in the atlas, and
+// without changing it; returns -1 if cp is not there.
+int gr_glyph_find(unsigned cp, GRGlyph *g);
+void gr_glyph_cache_clear(void);
+
+// Frame streaming (stream.c).  gr_stream_open() starts listening on
+// address, "unix:PATH" or "tcp:PORT", for frames of the given size and
+// format; returns 0, or a negative value.  gr_stream_update() copies the
+// rectangles of frame that changed since the last update that returned
+// 0; it returns -1 without waiting if the sender is busy.
+int gr_stream_open(const char *address, int width, int height, int format);
+int gr_stream_update(const GGLSurface *frame, const GRRect *rects,
+                     unsigned count);
+void gr_stream_close(void);
+
+// Per-pixel helpers shared by the scalar and SIMD kernels.
+
+// round(t / 255) for t <= 255 * 255, the same rounding as NEON's
+// vraddhn_u16(t, vrshrq_n_u16(t, 8)).
+static GR_ALWAYS_INLINE unsigned gr_div255(unsigned t)
+{
+    t += 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+static GR_ALWAYS_INLINE unsigned gr_blend8(unsigned s, unsigned d, unsigned a)
+{
+    return gr_div255(s * a + d * (255 - a));
+}
+
+// a * (256 - f) + b * f, over 256 and rounded
+static GR_ALWAYS_INLINE unsigned gr_lerp8(unsigned a, unsigned b, unsigned f)
+{
+    return (a * (256 - f) + b * f + 128) >> 8;
+}
+
+static GR_ALWAYS_INLINE void gr_load(int format, const unsigned char *p,
+                                     unsigned *r, unsigned *g, unsigned *b)
+{
+    unsigned v;
+    switch (format) {
+    case GGL_PIXEL_FORMAT_RGB_565:
+        v = *(const unsigned short *) p;
+        *r = (v >> 11) & 0x1f; *r = (*r << 3) | (*r >> 2);
+        *g = (v >> 5) & 0x3f;  *g = (*g << 2) | (*g >> 4);
+        *b = v & 0x1f;         *b = (*b << 3) | (*b >> 2);
+        break;
+    case GGL_PIXEL_FORMAT_BGRA_8888:
+        *r = p[2]; *g = p[1]; *b = p[0];
+        break;
+    case GR_PIXEL_FORMAT_ARGB_8888:
+        *r = p[1]; *g = p[2]; *b = p[3];
+        break;
+    default:
+        *r = p[0]; *g = p[1]; *b = p[2];
+        break;
+    }
+}
+
+static GR_ALWAYS_INLINE void gr_store(int format, unsigned char *p,
+                                      unsigned r, unsigned g, unsigned b)
+{
+    switch (format) {
+    case GGL_PIXEL_FORMAT_RGB_565:
+        *(unsigned short *) p = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+        break;
+    case GGL_PIXEL_FORMAT_BGRA_8888:
+        p[0] = b; p[1] = g; p[2] = r; p[3] = 0xff;
+        break;
+    case GR_PIXEL_FORMAT_ARGB_8888:
+        p[0] = 0xff; p[1] = r; p[2] = g; p[3] = b;
+        break;
+    default:
+        p[0] = r; p[1] = g; p[2] = b; p[3] = 0xff;
+        break;
+    }
+}
+
+// Stores the RGBX_8888 pixel s as the RGB_565 pixel p, dithered as the
+// pixel at x, y of a block.
+static GR_ALWAYS_INLINE void gr_store_dither(unsigned char *p,
+        const unsigned char *s, int x, int y)
+{
+    const unsigned char *d = gr_dither_rgbx[y & 3] + (x & 3) * 4;
+    unsigned r = s[0] + d[0], g = s[1] + d[1], b = s[2] + d[2];
+
+    gr_store(GGL_PIXEL_FORMAT_RGB_565, p, r > 255 ? 255 : r,
+             g > 255 ? 255 : g, b > 255 ? 255 : b);
+}
+
+// Blends r, g, b with alpha a over the pixel at p.
+static GR_ALWAYS_INLINE void gr_blend_pixel(int format, unsigned char *p,
+        unsigned r, unsigned g, unsigned b, unsigned a)
+{
+    unsigned dr, dg, db;
+
+    if (a == 0) return;
+    if (a == 255) {
+        gr_store(format, p, r, g, b);
+        return;
+    }
+    gr_load(format, p, &dr, &dg, &db);
+    gr_store(format, p, gr_blend8(r, dr, a), gr_blend8(g, dg, a),
+             gr_blend8(b, db, a));
+}
+
+// The premultiplied layout whose blend kernel exists for destination
+// format; it keeps the channel order of 32-bit destinations.
+static GR_ALWAYS_INLINE int gr_premultiplied_format(int format)
+{
+    return format == GGL_PIXEL_FORMAT_BGRA_8888 ?
+            GR_PIXEL_FORMAT_BGRA_8888_PRE : GR_PIXEL_FORMAT_RGBA_8888_PRE;
+}
+
+static GR_ALWAYS_INLINE void gr_load_pre(int format, const unsigned char *p,
+        unsigned *r, unsigned *g, unsigned *b, unsigned *a)
+{
+    if (gr_premultiplied_format(format) == GR_PIXEL_FORMAT_BGRA_8888_PRE) {
+        *r = p[2]; *g = p[1]; *b = p[0];
+    } else {
+        *r = p[0]; *g = p[1]; *b = p[2];
+    }
+    *a = p[3];
+}
+
+// Composites premultiplied r, g, b with alpha a over the pixel at p.
+static GR_ALWAYS_INLINE void gr_blend_pre_pixel(int format, unsigned char *p,
+        unsigned r, unsigned g, unsigned b, unsigned a)
+{
+    unsigned dr, dg, db;
+
+    if (a == 0) return;
+    if (a == 255) {
+        gr_store(format, p, r, g, b);
+        return;
+    }
+    gr_load(format, p, &dr, &dg, &db);
+    gr_store(format, p, r + gr_div255(dr * (255 - a)),
+             g + gr_div255(dg * (255 - a)), b + gr_div255(db * (255 - a)));
+}
+
+// Bit x of a 1-bpp row, and the eight bits starting there with bit x
+// in the most significant place.
+static GR_ALWAYS_INLINE unsigned gr_bit(const unsigned char *row, int x)
+{
+    return (row[x >> 3] >> (7 - (x & 7))) & 1;
+}
+
+static GR_ALWAYS_INLINE unsigned gr_bits8(const unsigned char *row, int x)
+{
+    const unsigned char *p = row + (x >> 3);
+    unsigned s = x & 7;
+    return s ? ((p[0] << s) | (p[1] >> (8 - s))) & 0xff : p[0];
+}
+
+static GR_ALWAYS_INLINE int gr_bytes_per_pixel(int format)
+{
+    return format == GGL_PIXEL_FORMAT_RGB_565 ? 2 : 4;
+}
+
+// For the resamplers: the pixel at 16.16 position x of a row of sw, and
+// in *f the fraction of the way to the next one, clamped to the row.
+static GR_ALWAYS_INLINE int gr_scale_pos(int x, int sw, unsigned *f)
+{
+    int n = x >> 16;
+
+    *f = (x >> 8) & 0xff;
+    if (x < 0) {
+        n = 0;
+        *f = 0;
+    } else if (n >= sw - 1) {
+        n = sw - 1;
+        *f = 0;
+    }
+    return n;
+}
+
+// One pixel of lerp_x.
+static GR_ALWAYS_INLINE void gr_lerp_pixel(int format, unsigned char *dst,
+        const unsigned char *src, int sw, int x)
+{
+    unsigned f, r0, g0, b0, r1, g1, b1, c;
+    int n = gr_scale_pos(x, sw, &f);
+
+    if (format == GGL_PIXEL_FORMAT_RGB_565) {
+        const unsigned char *p = src + n * 2;
+        gr_load(format, p, &r0, &g0, &b0);
+        gr_load(format, p + (f ? 2 : 0), &r1, &g1, &b1);
+        dst[0] = gr_lerp8(r0, r1, f);
+        dst[1] = gr_lerp8(g0, g1, f);
+        dst[2] = gr_lerp8(b0, b1, f);
+        dst[3] = 0xff;
+    } else {
+        const unsigned char *p = src + n * 4, *q = p + (f ? 4 : 0);
+        for (c = 0; c < 4; c++) dst[c] = gr_lerp8(p[c], q[c], f);
+    }
+}
+
+// For the rotate kernels: pixel (x, y) of a w x h source block lands at
+// the returned pointer + x * *xs + y * *ys.
+static GR_ALWAYS_INLINE unsigned char *gr_rotate_origin(int bpp,
+        unsigned char *dst, int dstride, int w, int h, int rotation,
+        int *xs, int *ys)
+{
+    switch (rotation) {
+    case 90:
+        *xs = dstride;
+        *ys = -bpp;
+        return dst + (h - 1) * bpp;
+    case 180:
+        *xs = -bpp;
+        *ys = -dstride;
+        return dst + (h - 1) * dstride + (w - 1) * bpp;
+    default:
+        *xs = -dstride;
+        *ys = bpp;
+        return dst + (w - 1) * dstride;
+    }
+}
+
+// Moves a block one pixel at a time, d being where its pixel (0, 0)
+// lands; the rotate kernels use it for edges too narrow for a tile.
+static GR_ALWAYS_INLINE void gr_rotate_pixels(int bpp, unsigned char *d,
+        int xs, int ys, const unsigned char *src, int sstride, int w, int h)
+{
+    int x;
+
+    for (; h > 0; h--, d += ys, src += sstride) {
+        unsigned char *p = d;
+        if (bpp == 2) {
+            const unsigned short *s = (const unsigned short *) src;
+            for (x = 0; x < w; x++, p += xs) *(unsigned short *) p = s[x];
+        } else {
+            const unsigned *s = (const unsigned *) src;
+            for (x = 0; x < w; x++, p += xs) *(unsigned *) p = s[x];
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <fcntl.h>
+#include <stdio.h>
+
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+
+#include <linux/fb.h>
+#include <linux/kd.h>
+
+#include <pixelflinger/pixelflinger.h>
+
+#include "graphics.h"
+
+/* Layout asked of drivers whose own layout has no kernels. */
+#if defined(RECOVERY_BGRA)
+#define PIXEL_FORMAT GGL_PIXEL_FORMAT_BGRA_8888
+#elif defined(RECOVERY_RGBX)
+#define PIXEL_FORMAT GGL_PIXEL_FORMAT_RGBX_8888
+#else
+#define PIXEL_FORMAT GGL_PIXEL_FORMAT_RGB_565
+#endif
+
+/* format of the framebuffer pages, detected by fbdev_init() */
+static int fb_format = PIXEL_FORMAT;
+static int fb_fd = -1;
+static int vt_fd = -1;
+
+/* Set once the driver is known to pan between the two pages. */
+static int fb_direct = 0;
+
+static void *fb_bits = MAP_FAILED;
+
+static struct fb_var_screeninfo vi;
+static struct fb_fix_screeninfo fi;
+
+#ifndef FBIO_WAITFORVSYNC
+#define FBIO_WAITFORVSYNC _IOW('F', 0x20, __u32)
+#endif
+
+static void set_bitfield(struct fb_bitfield *f, int offset, int length)
+{
+    f->offset = offset;
+    f->length = length;
+    f->msb_right = 0;
+}
+
+/* Maps the channel layout in v to a pixel format, with the offsets
+ * counted from the low end of a little-endian pixel.  Returns -1 for
+ * layouts the kernels do not cover. */
+static int fb_pixel_format(const struct fb_var_screeninfo *v)
+{
+    if (v->bits_per_pixel == 16) {
+        if (v->red.offset == 11 && v->red.length == 5 &&
+            v->green.offset == 5 && v->green.length == 6 &&
+            v->blue.offset == 0 && v->blue.length == 5)
+            return GGL_PIXEL_FORMAT_RGB_565;
+        return -1;
+    }
+    if (v->bits_per_pixel != 32 || v->red.length != 8 ||
+        v->green.length != 8 || v->blue.length != 8)
+        return -1;
+
+    if (v->red.offset == 0 && v->green.offset == 8 && v->blue.offset == 16)
+        return GGL_PIXEL_FORMAT_RGBX_8888;
+    if (v->red.offset == 16 && v->green.offset == 8 && v->blue.offset == 0)
+        return GGL_PIXEL_FORMAT_BGRA_8888;
+    if (v->red.offset == 8 && v->green.offset == 16 && v->blue.offset == 24)
+        return GR_PIXEL_FORMAT_ARGB_8888;
+    return -1;
+}
+
+static void set_pixel_format(struct fb_var_screeninfo *v, int format)
+{
+    if (format == GGL_PIXEL_FORMAT_RGB_565) {
+        v->bits_per_pixel = 16;
+        set_bitfield(&v->red, 11, 5);
+        set_bitfield(&v->green, 5, 6);
+        set_bitfield(&v->blue, 0, 5);
+        set_bitfield(&v->transp, 0, 0);
+        return;
+    }
+    v->bits_per_pixel = 32;
+    set_bitfield(&v->green, 8, 8);
+    set_bitfield(&v->transp, 24, 8);
+    if (format == GGL_PIXEL_FORMAT_BGRA_8888) {
+        set_bitfield(&v->red, 16, 8);
+        set_bitfield(&v->blue, 0, 8);
+    } else {
+        set_bitfield(&v->red, 0, 8);
+        set_bitfield(&v->blue, 16, 8);
+    }
+}
+
+static int fbdev_init(minui_backend *backend, GGLSurface *fb)
+{
+    int fd;
+    void *bits;
+    int bpp;
+
+    fd = open("/dev/graphics/fb0", O_RDWR);
+    if (fd < 0) {
+        perror("cannot open fb0");
+        return -1;
+    }
+
+    if (ioctl(fd, FBIOGET_VSCREENINFO, &vi) < 0) {
+        perror("failed to get fb0 info");
+        close(fd);
+        return -1;
+    }
+
+    /* Draw in whatever layout the driver already uses.  Only when there
+     * are no kernels for it ask for the build's preferred one. */
+    fb_format = fb_pixel_format(&vi);
+    if (fb_format < 0) {
+        set_pixel_format(&vi, PIXEL_FORMAT);
+        if (ioctl(fd, FBIOPUT_VSCREENINFO, &vi) < 0) {
+            perror("failed to put fb0 info");
+            close(fd);
+            return -1;
+        }
+        fb_format = fb_pixel_format(&vi);
+        if (fb_format < 0) {
+            fprintf(stderr, "unknown fb0 layout, assuming format %d\n",
+                    PIXEL_FORMAT);
+            fb_format = PIXEL_FORMAT;
+        }
+    }
+    bpp = gr_bytes_per_pixel(fb_format);
+
+    if (ioctl(fd, FBIOGET_FSCREENINFO, &fi) < 0) {
+        perror("failed to get fb0 info");
+        close(fd);
+        return -1;
+    }
+
+    bits = mmap(0, fi.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (bits == MAP_FAILED) {
+        perror("failed to mmap framebuffer");
+        close(fd);
+        return -1;
+    }
+
+    fb->version = sizeof(*fb);
+    fb->width = vi.xres;
+    fb->height = vi.yres;
+    fb->stride = fi.line_length/bpp;
+    fb->data = bits;
+    fb->format = fb_format;
+    memset(fb->data, 0, vi.yres * fi.line_length);
+
+    fb++;
+
+    fb->version = sizeof(*fb);
+    fb->width = vi.xres;
+    fb->height = vi.yres;
+    fb->stride = fi.line_length/bpp;
+    fb->data = (unsigned char *) bits + vi.yres * fi.line_length;
+    fb->format = fb_format;
+    memset(fb->data, 0, vi.yres * fi.line_length);
+
+    /* refresh period from the mode timings, when the driver has them */
+    backend->frame_usec = 0;
+    if (vi.pixclock != 0) {
+        unsigned long long frame = (unsigned long long) vi.pixclock *
+                (vi.xres + vi.left_margin + vi.right_margin + vi.hsync_len) *
+                (vi.yres + vi.upper_margin + vi.lower_margin + vi.vsync_len);
+        backend->frame_usec = frame / 1000000;  /* pixclock is in ps */
+    }
+
+    fb_bits = bits;
+    fb_fd = fd;
+    return 0;
+}
+
+static int pan_framebuffer(unsigned n)
+{
+    if (n >= GR_MAX_PAGES) return -1;
+    vi.yoffset = n * vi.yres;
+    return ioctl(fb_fd, FBIOPAN_DISPLAY, &vi);
+}
+
+/* Panning needs a virtual screen two pages tall; ask for one if the
+ * driver did not set it up, and probe that the pan really works. */
+static int fbdev_init_direct(minui_backend *backend)
+{
+    if (fi.smem_len < 2 * vi.yres * fi.line_length)
+        return -1;
+
+    if (vi.yres_virtual < 2 * vi.yres) {
+        vi.yres_virtual = 2 * vi.yres;
+        if (ioctl(fb_fd, FBIOPUT_VSCREENINFO, &vi) < 0 ||
+            vi.yres_virtual < 2 * vi.yres)
+            return -1;
+    }
+
+    if (pan_framebuffer(0) < 0 || pan_framebuffer(1) < 0 ||
+        pan_framebuffer(0) < 0) {
+        return -1;
+    }
+    fb_direct = 1;
+    return 0;
+}
+
+/* The third page goes right below the other two in the virtual screen.
+ * It starts as a copy of page 0, which may already hold a snapshot, so
+ * the probe pan to it does not flash. */
+static int fbdev_init_triple(minui_backend *backend, GGLSurface *fb)
+{
+    if (fi.smem_len < 3 * vi.yres * fi.line_length)
+        return -1;
+
+    if (vi.yres_virtual < 3 * vi.yres) {
+        vi.yres_virtual = 3 * vi.yres;
+        if (ioctl(fb_fd, FBIOPUT_VSCREENINFO, &vi) < 0 ||
+            vi.yres_virtual < 3 * vi.yres)
+            return -1;
+    }
+    if (pan_framebuffer(2) < 0 || pan_framebuffer(0) < 0)
+        return -1;
+
+    fb->version = sizeof(*fb);
+    fb->width = vi.xres;
+    fb->height = vi.yres;
+    fb->stride = fi.line_length / gr_bytes_per_pixel(fb_format);
+    fb->data = (unsigned char *) fb_bits + 2 * vi.yres * fi.line_length;
+    fb->format = fb_format;
+    memcpy(fb->data, fb_bits, vi.yres * fi.line_length);
+    return 0;
+}
+
+static int fbdev_wait_vsync(minui_backend *backend)
+{
+    __u32 crtc = 0;
+    return ioctl(fb_fd, FBIO_WAITFORVSYNC, &crtc);
+}
+
+static void set_active_framebuffer(unsigned n)
+{
+    if (n > 1) return;
+    vi.yres_virtual = vi.yres * gr_bytes_per_pixel(fb_format);
+    vi.yoffset = n * vi.yres;
+    vi.bits_per_pixel = gr_bytes_per_pixel(fb_format) * 8;
+    if (ioctl(fb_fd, FBIOPUT_VSCREENINFO, &vi) < 0) {
+        perror("active fb swap failed");
+    }
+}
+
+static void fbdev_show(minui_backend *backend, unsigned n)
+{
+    if (!fb_direct) {
+        set_active_framebuffer(n);
+    } else if (pan_framebuffer(n) < 0) {
+        perror("active fb pan failed");
+    }
+}
+
+static void fbdev_blank(minui_backend *backend, bool blank)
+{
+    int ret;
+
+    ret = ioctl(fb_fd, FBIOBLANK, blank ? FB_BLANK_POWERDOWN : FB_BLANK_UNBLANK);
+    if (ret < 0)
+        perror("ioctl(): blank");
+}
+
+static void fbdev_exit(minui_backend *backend)
+{
+    close(fb_fd);
+    fb_fd = -1;
+    fb_direct = 0;
+
+    ioctl(vt_fd, KDSETMODE, (void*) KD_TEXT);
+    close(vt_fd);
+    vt_fd = -1;
+}
+
+static minui_backend fbdev_backend = {
+    .name = "fbdev",
+    .init = fbdev_init,
+    .init_direct = fbdev_init_direct,
+    .init_triple = fbdev_init_triple,
+    .wait_vsync = fbdev_wait_vsync,
+    .show = fbdev_show,
+    .blank = fbdev_blank,
+    .exit = fbdev_exit,
+};
+
+minui_backend *open_fbdev(void)
+{
+    return &fbdev_backend;
+}
@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Display backend without a display.  The two pages live in a memfd, or
+ * in a file another process can map to look at them, and every flip is
+ * logged with a timestamp.  There is no vsync, so triple buffering paces
+ * itself with a timer at MINUI_VIRTUAL_HZ, default 60.  This lets
+ * ui_init(), draw_screen_locked() and gr_flip() run unchanged on a build
+ * host.  Set MINUI_BACKEND=virtual to select it; it is configured
+ * through the environment:
+ *
+ *   MINUI_VIRTUAL_SIZE    WIDTHxHEIGHT, default 480x854
+ *   MINUI_VIRTUAL_STRIDE  row length in pixels, default the width
+ *   MINUI_VIRTUAL_FORMAT  rgb565 (default), rgbx8888, bgra8888, argb8888
+ *   MINUI_VIRTUAL_FILE    keep the pages in this file instead of a memfd
+ *   MINUI_VIRTUAL_FLIPS   append "flip page usec" lines to this file
+ *   MINUI_VIRTUAL_HZ      refresh rate, default 60
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+
+#include <pixelflinger/pixelflinger.h>
+
+#include "graphics.h"
+
+static int v_fd = -1;
+static void *v_bits = MAP_FAILED;
+static size_t v_size = 0;
+static size_t v_page = 0;
+static GGLSurface v_pages[GR_MAX_PAGES];
+static FILE *v_flips = NULL;
+static unsigned v_flip_count = 0;
+static long long v_first_flip = 0;
+static long long v_last_flip = 0;
+
+static long long now_usec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int env_format(void)
+{
+    const char *s = getenv("MINUI_VIRTUAL_FORMAT");
+
+    if (s == NULL || strcmp(s, "rgb565") == 0)
+        return GGL_PIXEL_FORMAT_RGB_565;
+    if (strcmp(s, "rgbx8888") == 0)
+        return GGL_PIXEL_FORMAT_RGBX_8888;
+    if (strcmp(s, "bgra8888") == 0)
+        return GGL_PIXEL_FORMAT_BGRA_8888;
+    if (strcmp(s, "argb8888") == 0)
+        return GR_PIXEL_FORMAT_ARGB_8888;
+    return -1;
+}
+
+static int open_pages(size_t size)
+{
+    const char *path = getenv("MINUI_VIRTUAL_FILE");
+    int fd = -1;
+
+    if (path != NULL) {
+        fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            perror("cannot open virtual framebuffer file");
+            return -1;
+        }
+    } else {
+#if defined(__NR_memfd_create)
+        fd = syscall(__NR_memfd_create, "minui", 0);
+#endif
+        if (fd < 0) {
+            /* no memfd: plain anonymous memory will do */
+            return -2;
+        }
+    }
+
+    if (ftruncate(fd, size) < 0) {
+        perror("cannot size virtual framebuffer");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int virtual_init(minui_backend *backend, GGLSurface *fb)
+{
+    unsigned width = 480, height = 854, stride;
+    const char *s;
+    int format, bpp, i;
+
+    s = getenv("MINUI_VIRTUAL_SIZE");
+    if (s != NULL && (sscanf(s, "%ux%u", &width, &height) != 2 ||
+                      width == 0 || height == 0)) {
+        fprintf(stderr, "bad MINUI_VIRTUAL_SIZE \"%s\"\n", s);
+        return -1;
+    }
+    stride = width;
+    s = getenv("MINUI_VIRTUAL_STRIDE");
+    if (s != NULL) stride = strtoul(s, NULL, 0);
+    if (stride < width) {
+        fprintf(stderr, "bad MINUI_VIRTUAL_STRIDE \"%s\"\n", s);
+        return -1;
+    }
+    format = env_format();
+    if (format < 0) {
+        fprintf(stderr, "bad MINUI_VIRTUAL_FORMAT \"%s\"\n",
+                getenv("MINUI_VIRTUAL_FORMAT"));
+        return -1;
+    }
+    bpp = gr_bytes_per_pixel(format);
+
+    /* room for a third page in case triple buffering is enabled */
+    v_page = (size_t) stride * height * bpp;
+    v_size = GR_MAX_PAGES * v_page;
+    v_fd = open_pages(v_size);
+    if (v_fd == -1) return -1;
+    if (v_fd >= 0) {
+        v_bits = mmap(0, v_size, PROT_READ | PROT_WRITE, MAP_SHARED, v_fd, 0);
+    } else {
+        v_fd = -1;
+        v_bits = mmap(0, v_size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+    if (v_bits == MAP_FAILED) {
+        perror("failed to mmap virtual framebuffer");
+        if (v_fd >= 0) close(v_fd);
+        v_fd = -1;
+        return -1;
+    }
+    memset(v_bits, 0, v_size);
+
+    for (i = 0; i < GR_MAX_PAGES; i++) {
+        v_pages[i].version = sizeof(v_pages[i]);
+        v_pages[i].width = width;
+        v_pages[i].height = height;
+        v_pages[i].stride = stride;
+        v_pages[i].data = (unsigned char *) v_bits + i * v_page;
+        v_pages[i].format = format;
+    }
+    fb[0] = v_pages[0];
+    fb[1] = v_pages[1];
+
+    s = getenv("MINUI_VIRTUAL_FLIPS");
+    if (s != NULL) {
+        v_flips = fopen(s, "a");
+        if (v_flips == NULL) perror("cannot open flip log");
+    }
+    v_flip_count = 0;
+
+    s = getenv("MINUI_VIRTUAL_HZ");
+    backend->frame_usec = 1000000 / (s != NULL && atoi(s) > 0 ? atoi(s) : 60);
+    return 0;
+}
+
+static int virtual_init_direct(minui_backend *backend)
+{
+    /* nothing scans the pages out, so "showing" one is free */
+    return 0;
+}
+
+static int virtual_init_triple(minui_backend *backend, GGLSurface *fb)
+{
+    *fb = v_pages[2];
+    memcpy(v_pages[2].data, v_pages[0].data, v_page);
+    return 0;
+}
+
+static int virtual_wait_vsync(minui_backend *backend)
+{
+    return -1;
+}
+
+static void virtual_show(minui_backend *backend, unsigned n)
+{
+    long long t = now_usec();
+
+    if (v_flip_count++ == 0) v_first_flip = t;
+    v_last_flip = t;
+    if (v_flips != NULL) {
+        fprintf(v_flips, "%u %u %lld\n", v_flip_count, n, t);
+    }
+}
+
+static void virtual_blank(minui_backend *backend, bool blank)
+{
+}
+
+static void virtual_exit(minui_backend *backend)
+{
+    if (v_flip_count > 1) {
+        fprintf(stderr, "virtual fb: %u flips, %lld us apart on average\n",
+                v_flip_count,
+                (v_last_flip - v_first_flip) / (v_flip_count - 1));
+    }
+    if (v_flips != NULL) {
+        fclose(v_flips);
+        v_flips = NULL;
+    }
+    if (v_bits != MAP_FAILED) {
+        munmap(v_bits, v_size);
+        v_bits = MAP_FAILED;
+    }
+    if (v_fd >= 0) {
+        close(v_fd);
+        v_fd = -1;
+    }
+}
+
+static minui_backend virtual_backend = {
+    .name = "virtual",
+    .init = virtual_init,
+    .init_direct = virtual_init_direct,
+    .init_triple = virtual_init_triple,
+    .wait_vsync = virtual_wait_vsync,
+    .show = virtual_show,
+    .blank = virtual_blank,
+    .exit = virtual_exit,
+};
+
+minui_backend *open_virtual(void)
+{
+    return &virtual_backend;
+}
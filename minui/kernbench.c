@@ -0,0 +1,295 @@
+/*
+ * Times every rasterizer kernel (graphics.h) for each destination
+ * format, the scalar table against the one gr_get_kernels() returns,
+ * and checks that the two give the same pixels.  Kernels with no SIMD
+ * version on this CPU show as "scalar".  Last, dim is timed against
+ * the translucent black fill_blend that gr_dim() replaced, in both
+ * tables.
+ *
+ *   kernbench [-s WIDTHxHEIGHT] [-t SECONDS]
+ *
+ * Each kernel covers a WIDTHxHEIGHT block (default 540x960) as often as
+ * fits in SECONDS (default 0.2) per table, and the fastest pass counts.
+ * Exits with 1 if any kernel differs from its scalar version, or dim
+ * from the fill.  Build it on an x86 Linux host with
+ * system/core/include for pixelflinger.h:
+ *   cc -O2 -I. -I$ANDROID_BUILD_TOP/system/core/include \
+ *       kernbench.c blend.c blend_sse2.c -o kernbench
+ * or for an ARM device with blend_neon.c and -mfpu=neon instead.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "graphics.h"
+
+static const struct { const char *name; int format; } formats[] = {
+    { "rgb565",   GGL_PIXEL_FORMAT_RGB_565 },
+    { "rgbx8888", GGL_PIXEL_FORMAT_RGBX_8888 },
+    { "bgra8888", GGL_PIXEL_FORMAT_BGRA_8888 },
+    { "argb8888", GR_PIXEL_FORMAT_ARGB_8888 },
+};
+
+enum {
+    FILL, FILL_BLEND, DIM, COPY_RGBX, DITHER_RGBX, BLEND_RGBA, BLEND_PRE,
+    BLEND_A8, BLEND_A1, ROTATE, SCALE_NEAREST, LERP_X, LERP_Y, KERNELS,
+    BLACK_FILL      /* what dim replaced: fill_blend in black */
+};
+
+#define KERNEL(name) { #name, offsetof(GRKernels, name) }
+
+static const struct { const char *name; size_t offset; } kernels[KERNELS] = {
+    KERNEL(fill), KERNEL(fill_blend), KERNEL(dim), KERNEL(copy_rgbx),
+    KERNEL(dither_rgbx), KERNEL(blend_rgba), KERNEL(blend_pre),
+    KERNEL(blend_a8), KERNEL(blend_a1), KERNEL(rotate),
+    KERNEL(scale_nearest), KERNEL(lerp_x), KERNEL(lerp_y),
+};
+
+/* Whether k still has the scalar version of kernel n. */
+static int unreplaced(const GRKernels *scalar, const GRKernels *k, int n)
+{
+    return memcmp((const char *) scalar + kernels[n].offset,
+                  (const char *) k + kernels[n].offset,
+                  sizeof(void (*)(void))) == 0;
+}
+
+static int width = 540, height = 960;
+static double seconds = 0.2;
+
+/* inputs, each large enough for a 4-byte pixel per position */
+static unsigned char *rgbx, *rgba, *pre, *same, *mask, *bits;
+static int bits_stride;
+/* the block drawn into, its starting contents and a second copy */
+static unsigned char *dst, *start, *scalar_dst;
+static size_t dst_size;
+
+static const GRColor color = { 40, 160, 220, 160 };
+
+static unsigned seed = 1;
+
+static unsigned char next_byte(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 16;
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Runs kernel n of k once over the whole block. */
+static void run(const GRKernels *k, int n, int format)
+{
+    int bpp = gr_bytes_per_pixel(format);
+    int stride = width * bpp;
+    int half = width / 2, step = (half << 16) / width;
+    int y;
+
+    switch (n) {
+    case FILL:
+        k->fill(dst, stride, width, height, gr_pack_pixel(format, &color));
+        break;
+    case FILL_BLEND:
+        k->fill_blend(dst, stride, width, height, &color);
+        break;
+    case DIM:
+        k->dim(dst, stride, width, height, 255 - color.a);
+        break;
+    case BLACK_FILL: {
+        GRColor black = { 0, 0, 0, color.a };
+        k->fill_blend(dst, stride, width, height, &black);
+        break;
+    }
+    case COPY_RGBX:
+        k->copy_rgbx(dst, stride, rgbx, width * 4, width, height);
+        break;
+    case DITHER_RGBX:
+        k->dither_rgbx(dst, stride, rgbx, width * 4, width, height);
+        break;
+    case BLEND_RGBA:
+        k->blend_rgba(dst, stride, rgba, width * 4, width, height);
+        break;
+    case BLEND_PRE:
+        k->blend_pre(dst, stride, pre, width * 4, width, height);
+        break;
+    case BLEND_A8:
+        k->blend_a8(dst, stride, mask, width, width, height, &color);
+        break;
+    case BLEND_A1:
+        k->blend_a1(dst, stride, bits, bits_stride, 3, width, height, &color);
+        break;
+    case ROTATE:
+        /* the block turned a quarter is height wide */
+        k->rotate(dst, height * bpp, same, stride, width, height, 90);
+        break;
+    case SCALE_NEAREST:
+        /* rows of half the width, stretched to the whole of it */
+        for (y = 0; y < height; y++) {
+            k->scale_nearest(dst + y * stride, same + y * half * bpp, half,
+                             step / 2, step, width);
+        }
+        break;
+    case LERP_X:
+        for (y = 0; y < height; y++) {
+            k->lerp_x(dst + y * width * 4, same + y * half * bpp, half,
+                      step / 2, step, width);
+        }
+        break;
+    case LERP_Y:
+        for (y = 0; y + 1 < height; y++) {
+            k->lerp_y(dst + y * width * 4, rgbx + y * width * 4,
+                      rgbx + (y + 1) * width * 4, width * 4, 96);
+        }
+        break;
+    }
+}
+
+/* Returns the fastest time of a pass of kernel n of k, in seconds. */
+static double time_kernel(const GRKernels *k, int n, int format)
+{
+    double best = 1e9, end = now() + seconds;
+
+    memcpy(dst, start, dst_size);
+    do {
+        double t = now();
+        run(k, n, format);
+        t = now() - t;
+        if (t < best) best = t;
+    } while (now() < end);
+    return best;
+}
+
+/* Whether kernel na of a and kernel nb of b give the same pixels. */
+static int same_result(const GRKernels *a, int na, const GRKernels *b, int nb,
+                       int format)
+{
+    memcpy(dst, start, dst_size);
+    run(a, na, format);
+    memcpy(scalar_dst, dst, dst_size);
+    memcpy(dst, start, dst_size);
+    run(b, nb, format);
+    return memcmp(dst, scalar_dst, dst_size) == 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: kernbench [-s WIDTHxHEIGHT] [-t SECONDS]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    size_t pixels, i;
+    unsigned f;
+    int n, opt, failed = 0;
+
+    while ((opt = getopt(argc, argv, "s:t:")) != -1) {
+        switch (opt) {
+        case 's':
+            if (sscanf(optarg, "%dx%d", &width, &height) != 2 ||
+                width < 2 || height < 2) usage();
+            break;
+        case 't':
+            seconds = atof(optarg);
+            break;
+        default: usage();
+        }
+    }
+
+    pixels = (size_t) width * height;
+    bits_stride = (width + 3 + 7) / 8;
+    dst_size = pixels * 4;
+    rgbx = malloc(dst_size);
+    rgba = malloc(dst_size);
+    pre = malloc(dst_size);
+    same = malloc(dst_size);
+    mask = malloc(pixels);
+    bits = malloc(bits_stride * height);
+    dst = malloc(dst_size);
+    start = malloc(dst_size);
+    scalar_dst = malloc(dst_size);
+    if (!rgbx || !rgba || !pre || !same || !mask || !bits || !dst ||
+        !start || !scalar_dst) {
+        fprintf(stderr, "kernbench: out of memory\n");
+        return 2;
+    }
+
+    for (i = 0; i < dst_size; i++) {
+        rgbx[i] = next_byte();
+        rgba[i] = next_byte();
+        same[i] = next_byte();
+        start[i] = next_byte();
+    }
+    /* alpha like a theme image's: mostly clear or opaque, some edges */
+    for (i = 0; i < pixels; i++) {
+        unsigned char a = next_byte();
+        a = a < 96 ? 0 : a > 160 ? 255 : a;
+        rgba[i * 4 + 3] = a;
+        pre[i * 4] = rgba[i * 4] * a / 255;
+        pre[i * 4 + 1] = rgba[i * 4 + 1] * a / 255;
+        pre[i * 4 + 2] = rgba[i * 4 + 2] * a / 255;
+        pre[i * 4 + 3] = a;
+        mask[i] = a;
+    }
+    for (i = 0; i < (size_t) bits_stride * height; i++) bits[i] = next_byte();
+
+    printf("%dx%d block\n", width, height);
+    printf("%-9s %-14s %12s %12s %8s\n", "format", "kernel",
+           "scalar Mpx/s", "active Mpx/s", "speedup");
+    for (f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+        int format = formats[f].format;
+        const GRKernels *scalar = gr_get_scalar_kernels(format);
+        const GRKernels *k = gr_get_kernels(format);
+
+        for (n = 0; n < KERNELS; n++) {
+            double ts = time_kernel(scalar, n, format), tk;
+            int ok;
+
+            if (unreplaced(scalar, k, n)) {
+                printf("%-9s %-14s %12.1f %12s %8s\n", formats[f].name,
+                       kernels[n].name, pixels / ts / 1e6, "", "scalar");
+                continue;
+            }
+            tk = time_kernel(k, n, format);
+            ok = same_result(scalar, n, k, n, format);
+            printf("%-9s %-14s %12.1f %12.1f %7.2fx%s\n", formats[f].name,
+                   kernels[n].name, pixels / ts / 1e6, pixels / tk / 1e6,
+                   ts / tk, ok ? "" : "  DIFFERS");
+            if (!ok) failed = 1;
+        }
+    }
+
+    printf("\n%-9s %-14s %12s %12s %8s\n", "format", "dim, table",
+           "fill Mpx/s", "dim Mpx/s", "speedup");
+    for (f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+        int format = formats[f].format;
+        const GRKernels *tables[2] = {
+            gr_get_scalar_kernels(format), gr_get_kernels(format)
+        };
+
+        for (n = 0; n < 2; n++) {
+            const GRKernels *k = tables[n];
+            double tf, td;
+            int ok;
+
+            /* without SIMD kernels the active row repeats the scalar one */
+            if (n == 1 && unreplaced(tables[0], k, FILL_BLEND) &&
+                unreplaced(tables[0], k, DIM)) continue;
+            tf = time_kernel(k, BLACK_FILL, format);
+            td = time_kernel(k, DIM, format);
+            ok = same_result(k, BLACK_FILL, k, DIM, format);
+            printf("%-9s %-14s %12.1f %12.1f %7.2fx%s\n", formats[f].name,
+                   n == 0 ? "scalar" : "active", pixels / tf / 1e6,
+                   pixels / td / 1e6, tf / td, ok ? "" : "  DIFFERS");
+            if (!ok) failed = 1;
+        }
+    }
+    return failed;
+}
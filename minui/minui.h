@@ -23,22 +23,93 @@ char RES_LOC[255];
 typedef void* gr_surface;
 typedef unsigned short gr_pixel;
 
+// Right and bottom edges are exclusive.
+typedef struct {
+    int x0, y0, x1, y1;
+} gr_rect;
+
 int gr_init(void);
 void gr_exit(void);
 
+// The size we draw at, which is the panel's turned by gr_set_rotation().
 int gr_fb_width(void);
 int gr_fb_height(void);
+// Turns a point in panel coordinates, such as a touch, into the
+// coordinates we draw at.
+void gr_fb_map_point(int *x, int *y);
 gr_pixel *gr_fb_data(void);
 void gr_flip(void);
 void gr_fb_blank(bool blank);
+// Saves the frame last passed to gr_flip() to path as a PNG; call it
+// between frames.  Only the copy of the frame is made here, the encoding
+// is done on another thread, so a burst of calls records an animation.
+// Returns 0, or a negative value if too many are still being encoded.
+int gr_screenshot(const char *path);
+
+// Call before gr_init() to post frames to a vsync-paced display thread
+// with three pages, where the display supports it.
+void gr_set_triple_buffer(bool enable);
+// Call before gr_init() to let gr_list_end() split large redraws into
+// horizontal bands drawn by this many threads, the caller included.
+void gr_set_render_threads(int threads);
+// Call before gr_init() to stream every flipped frame to a client on
+// address, "unix:PATH" or "tcp:PORT" on the loopback interface; see
+// stream.c for the protocol and streamcat.c for a client.
+void gr_set_stream(const char *address);
+// Call before gr_init() to draw turned clockwise by 90, 180 or 270
+// degrees from the panel's own orientation.
+void gr_set_rotation(int degrees);
+// Call before gr_init(), as early as possible: puts the frame saved by
+// gr_snapshot_save() with the same key on screen straight from the file,
+// and gr_init() then keeps it there until the first gr_flip().  Returns
+// 0, or a negative value if there is no such snapshot for this display.
+int gr_snapshot_show(const char *path, unsigned key);
+// Saves the frame last passed to gr_flip(), as the panel shows it; the
+// key should change whenever that frame would.  Returns 0 on success.
+int gr_snapshot_save(const char *path, unsigned key);
+// Frames put on screen, vsyncs the display thread woke up too late for,
+// and frames replaced by a newer one before they were shown.
+void gr_vsync_stats(unsigned *shown, unsigned *missed, unsigned *dropped);
 
 void gr_color(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
 void gr_fill(int x, int y, int w, int h);
+// Darkens the rectangle as if covered by black at the given alpha, like
+// gr_fill(); the current color is left as it was.
+void gr_dim(int x, int y, int w, int h, unsigned char alpha);
 int gr_text(int x, int y, const char *s);
 int gr_measure(const char *s);
+// UTF-8 text.  gr_utf8_next() returns the code point at *s and moves
+// past it, U+FFFD for a malformed sequence, or 0 at the end.
+unsigned gr_utf8_next(const char **s);
+unsigned gr_utf8_length(const char *s);
 void gr_font_size(int *x, int *y);
 
 void gr_blit(gr_surface source, int sx, int sy, int w, int h, int dx, int dy);
+
+#define GR_FILTER_NEAREST   0
+#define GR_FILTER_BILINEAR  1
+// Draws the sw x sh area at (sx, sy) of source, which must lie within
+// it, stretched to dw x dh at (dx, dy).  Nothing outside clip is drawn
+// unless clip is NULL.
+void gr_blit_scaled(gr_surface source, int sx, int sy, int sw, int sh,
+                    int dx, int dy, int dw, int dh, const gr_rect *clip,
+                    int filter);
+
+// Between these two calls gr_fill(), gr_blit() and gr_text() are only
+// recorded.  gr_list_end() compares the recording with the previous one
+// and draws just the parts of the screen where they differ, so the list
+// should describe the whole screen, starting with an opaque background.
+void gr_list_begin(void);
+void gr_list_end(void);
+
+// An offscreen surface in the pixel format of the screen, for layers
+// that are drawn once and blitted often; its pixels start undefined.
+// NULL if out of memory; free it with res_free_surface().
+gr_surface gr_create_surface(int width, int height);
+// Draws into surface instead of the screen until called with NULL.
+// Drawing into it is immediate, even while a list is being recorded,
+// and the next list redraws wherever it blits the surface.
+void gr_draw_to(gr_surface surface);
 unsigned int gr_get_width(gr_surface surface);
 unsigned int gr_get_height(gr_surface surface);
 
@@ -69,5 +140,28 @@ void ev_dispatch(void);
 // Returns 0 if no error, else negative.
 int res_create_surface(const char* name, gr_surface* pSurface);
 void res_free_surface(gr_surface surface);
+// Loads count images at once, decoding them on up to one thread per
+// CPU: surfaces[i] and results[i] get what res_create_surface() gives
+// for names[i].  Returns 0 if every image loaded, else -1.
+int res_create_surfaces(const char* const* names, gr_surface* surfaces,
+                        int* results, int count);
+// Images made for a screen this many pixels wide are scaled to
+// gr_fb_width() as they load, so they draw at the right size with no
+// scaling per frame.  0 loads them as they are.
+void res_set_theme_width(int width);
+// Scales a length in theme pixels the same way.
+int res_scaled(int length);
+// With a nonzero value, images load for an RGB_565 screen with an
+// ordered dither instead of truncated channels, which keeps gradients
+// from banding; 0, the default, truncates.
+void res_set_dither(int dither);
+// Keeps a decoded copy of each image in dir, used instead of the PNG
+// while the PNG and the screen stay the same; NULL, the default, always
+// decodes.  Cached images are mapped rather than read, so they must not
+// be drawn into.
+void res_set_cache_dir(const char* dir);
+// Images are taken from the theme pack at path (see themepack.h) when
+// it has them, and from the PNGs otherwise; NULL uses the PNGs only.
+void res_set_theme_pack(const char* path);
 
 #endif
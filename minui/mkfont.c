@@ -3,42 +3,36 @@
 
 int main(int argc, char *argv)
 {
-    unsigned n;
-    unsigned char *x;
+    unsigned x, y, stride;
+    unsigned char *p;
     unsigned m;
-    unsigned run_val;
-    unsigned run_count;
- 
-    n = gimp_image.width * gimp_image.height;
+
+    stride = (gimp_image.width + 7) / 8;
     m = 0;
-    x = gimp_image.pixel_data;
 
-    printf("struct {\n");
+    printf("const struct {\n");
     printf("  unsigned width;\n");
     printf("  unsigned height;\n");
     printf("  unsigned cwidth;\n");
     printf("  unsigned cheight;\n");
-    printf("  unsigned char rundata[];\n");
+    printf("  unsigned stride;\n");
+    printf("  unsigned char bits[];\n");
     printf("} font = {\n");
     printf("  .width = %d,\n  .height = %d,\n  .cwidth = %d,\n  .cheight = %d,\n", gimp_image.width, gimp_image.height,
            gimp_image.width / 96, gimp_image.height);
-    printf("  .rundata = {\n");
-   
-    run_val = (*x ? 0 : 255);
-    run_count = 1;
-    n--;
-    x+=3;
+    printf("  .stride = %d,\n", stride);
+    printf("  .bits = {\n");
 
-    while(n-- > 0) {
-        unsigned val = (*x ? 0 : 255);
-        x+=3;
-        if((val == run_val) && (run_count < 127)) {
-            run_count++;
-        } else {
-eject:
-            printf("0x%02x,",run_count | (run_val ? 0x80 : 0x00));
-            run_val = val;
-            run_count = 1;
+    /* one bit per pixel, most significant bit first; rows are padded
+     * to whole bytes */
+    for (y = 0; y < gimp_image.height; y++) {
+        p = gimp_image.pixel_data + y * gimp_image.width * 3;
+        for (x = 0; x < stride * 8; x += 8) {
+            unsigned bits = 0, i;
+            for (i = 0; i < 8 && x + i < gimp_image.width; i++) {
+                if (!p[(x + i) * 3]) bits |= 0x80 >> i;
+            }
+            printf("0x%02x,", bits);
             m += 5;
             if(m >= 75) {
                 printf("\n");
@@ -46,9 +40,7 @@ eject:
             }
         }
     }
-    printf("0x%02x,",run_count | (run_val ? 0x80 : 0x00));
-    printf("\n0x00,");
-    printf("\n");
+    if (m) printf("\n");
     printf("  }\n};\n");
     return 0;
 }
@@ -0,0 +1,141 @@
+/*
+ * Builds the extra glyph table for glyphs.c.
+ *
+ *   mkglyphs CODEPOINTS < STRIP.pbm > sourcecodepro_15x24.h
+ *
+ * STRIP.pbm is a raw (P4) bitmap of equal cells side by side, one per
+ * line of CODEPOINTS, which holds hexadecimal code points below 0x10000
+ * in the same order.  The last line is the glyph drawn for code points
+ * the table does not have.  Each glyph is stored as the rows between its
+ * first and last inked row, so blank rows cost nothing.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_GLYPHS 4096
+#define NONE 0xffff
+
+static unsigned cps[MAX_GLYPHS];
+static unsigned offset[MAX_GLYPHS];
+static unsigned short page[256];
+
+int main(int argc, char **argv)
+{
+    FILE *f;
+    unsigned width, height, cwidth, stride, cstride, count = 0;
+    unsigned n, x, y, size = 0, pages = 0, m = 0;
+    unsigned char *strip, *data;
+    char line[64];
+
+    if (argc != 2 || (f = fopen(argv[1], "r")) == NULL) {
+        fprintf(stderr, "usage: mkglyphs CODEPOINTS < STRIP.pbm\n");
+        return 1;
+    }
+    while (count < MAX_GLYPHS && fgets(line, sizeof(line), f) != NULL) {
+        if (line[0] != '\n') cps[count++] = strtoul(line, NULL, 16);
+    }
+    fclose(f);
+
+    if (scanf("P4 %u %u", &width, &height) != 2 || getchar() == EOF ||
+        count == 0 || width % count != 0) {
+        fprintf(stderr, "mkglyphs: bad bitmap\n");
+        return 1;
+    }
+    stride = (width + 7) / 8;
+    cwidth = width / count;
+    cstride = (cwidth + 7) / 8;
+    strip = malloc(stride * height);
+    data = malloc(count * (2 + cstride * height));
+    if (strip == NULL || data == NULL ||
+        fread(strip, stride, height, stdin) != height) {
+        fprintf(stderr, "mkglyphs: short bitmap\n");
+        return 1;
+    }
+
+    for (n = 0; n < count; n++) {
+        unsigned top = height, bottom = 0;
+        for (y = 0; y < height; y++) {
+            for (x = n * cwidth; x < (n + 1) * cwidth; x++) {
+                if (strip[y * stride + x / 8] & (0x80 >> (x & 7))) {
+                    if (y < top) top = y;
+                    bottom = y + 1;
+                }
+            }
+        }
+        if (top > bottom) top = bottom = 0;
+
+        offset[n] = size;
+        data[size++] = top;
+        data[size++] = bottom - top;
+        for (y = top; y < bottom; y++) {
+            unsigned char *row = data + size;
+            memset(row, 0, cstride);
+            for (x = 0; x < cwidth; x++) {
+                unsigned sx = n * cwidth + x;
+                if (strip[y * stride + sx / 8] & (0x80 >> (sx & 7)))
+                    row[x / 8] |= 0x80 >> (x & 7);
+            }
+            size += cstride;
+        }
+    }
+    if (size > NONE) {
+        fprintf(stderr, "mkglyphs: %u bytes of glyphs do not fit\n", size);
+        return 1;
+    }
+
+    memset(page, 0xff, sizeof(page));
+    for (n = 0; n + 1 < count; n++) {
+        page[cps[n] >> 8] = 0;
+    }
+    for (y = 0; y < 256; y++) {
+        if (page[y] != NONE) page[y] = pages++;
+    }
+
+    printf("/* Generated by mkglyphs; do not edit. */\n\n");
+    printf("#define GLYPHS_CWIDTH   %u\n", cwidth);
+    printf("#define GLYPHS_CHEIGHT  %u\n", height);
+    printf("#define GLYPHS_STRIDE   %u\n", cstride);
+    printf("#define GLYPHS_NONE     0x%x\n", NONE);
+    printf("#define GLYPHS_MISSING  %u\n\n", offset[count - 1]);
+
+    printf("/* block of glyphs_index for each 256 code points */\n");
+    printf("static const unsigned short glyphs_page[256] = {\n");
+    for (n = 0; n < 256; n++) {
+        printf("%s0x%04x,%s", n % 8 ? " " : "  ", page[n],
+               n % 8 == 7 ? "\n" : "");
+    }
+    printf("};\n\n");
+
+    printf("/* offset of each glyph in glyphs_data */\n");
+    printf("static const unsigned short glyphs_index[%u * 256] = {\n", pages);
+    for (y = 0; y < 256; y++) {
+        if (page[y] == NONE) continue;
+        printf("  /* U+%02Xxx */\n", y);
+        for (x = 0; x < 256; x++) {
+            unsigned o = NONE;
+            for (n = 0; n + 1 < count; n++) {
+                if (cps[n] == (y << 8 | x)) o = offset[n];
+            }
+            printf("%s0x%04x,%s", x % 8 ? " " : "  ", o,
+                   x % 8 == 7 ? "\n" : "");
+        }
+    }
+    printf("};\n\n");
+
+    printf("/* per glyph: first row, row count, then the rows, %u bytes "
+           "each */\n", cstride);
+    printf("static const unsigned char glyphs_data[%u] = {\n", size);
+    for (n = 0; n < size; n++) {
+        printf("0x%02x,", data[n]);
+        m += 5;
+        if (m >= 75) {
+            printf("\n");
+            m = 0;
+        }
+    }
+    if (m) printf("\n");
+    printf("};\n");
+    return 0;
+}
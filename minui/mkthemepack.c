@@ -0,0 +1,368 @@
+/*
+ * Packs the PNGs of a theme directory into one theme pack (themepack.h).
+ *
+ *   mkthemepack [-f rgb565|rgbx8888|bgra8888|argb8888] [-d] [-u] THEME_DIR OUT.pack
+ *
+ * Without -f the images are stored with 8 bits a channel and converted
+ * for the screen as they load, the way PNGs are.  With -f they are
+ * stored the way a screen of that format draws them: opaque images in
+ * the format itself, the others premultiplied, so loading them is just
+ * decompressing; a screen of another format falls back to the PNGs.
+ * -d dithers opaque images for rgb565, like dither=1; a theme that the
+ * device scales (theme_width) dithers better without -f.  -u stores the
+ * pixels uncompressed.  Each image is otherwise one LZ4 block.
+ * Build it on the host with the device's byte order:
+ *   cc -I. mkthemepack.c -lpng
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <png.h>
+
+#include "themepack.h"
+
+typedef struct {
+    char name[THEME_PACK_NAME];
+    unsigned width, height;
+    unsigned char *rgba;        /* straight alpha */
+    int alpha;                  /* the PNG has an alpha channel */
+} Image;
+
+static unsigned div255(unsigned t)
+{
+    t += 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+/* the device's ordered dither for RGB_565 (blend.c) */
+static const unsigned char dither_rgbx[4][16] = {
+    { 0, 0, 0, 0,  4, 2, 4, 0,  1, 0, 1, 0,  5, 2, 5, 0 },
+    { 6, 3, 6, 0,  2, 1, 2, 0,  7, 3, 7, 0,  3, 1, 3, 0 },
+    { 1, 0, 1, 0,  5, 2, 5, 0,  0, 0, 0, 0,  4, 2, 4, 0 },
+    { 7, 3, 7, 0,  3, 1, 3, 0,  6, 3, 6, 0,  2, 1, 2, 0 },
+};
+
+static int read_png(const char *path, Image *image)
+{
+    png_structp png_ptr;
+    png_infop info_ptr;
+    png_bytep *rows = NULL;
+    unsigned y;
+    int type;
+    FILE *fp = fopen(path, "rb");
+
+    if (fp == NULL) return -1;
+    png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    info_ptr = png_ptr ? png_create_info_struct(png_ptr) : NULL;
+    if (info_ptr == NULL || setjmp(png_jmpbuf(png_ptr))) {
+        png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
+        free(rows);
+        fclose(fp);
+        return -1;
+    }
+    png_init_io(png_ptr, fp);
+    png_read_info(png_ptr, info_ptr);
+    image->width = png_get_image_width(png_ptr, info_ptr);
+    image->height = png_get_image_height(png_ptr, info_ptr);
+    type = png_get_color_type(png_ptr, info_ptr);
+    image->alpha = (type & PNG_COLOR_MASK_ALPHA) ||
+            png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS);
+
+    png_set_expand(png_ptr);
+    png_set_strip_16(png_ptr);
+    png_set_gray_to_rgb(png_ptr);
+    png_set_filler(png_ptr, 0xff, PNG_FILLER_AFTER);
+    png_read_update_info(png_ptr, info_ptr);
+
+    image->rgba = malloc((size_t) image->width * image->height * 4);
+    rows = malloc(image->height * sizeof(*rows));
+    if (image->rgba == NULL || rows == NULL) png_error(png_ptr, "no memory");
+    for (y = 0; y < image->height; y++) {
+        rows[y] = image->rgba + (size_t) y * image->width * 4;
+    }
+    png_read_image(png_ptr, rows);
+    png_read_end(png_ptr, NULL);
+
+    png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
+    free(rows);
+    fclose(fp);
+    return 0;
+}
+
+/* The pixels of image in its pack format, which goes to *format. */
+static unsigned char *convert(const Image *image, int target, int dither,
+                              unsigned *format, size_t *size)
+{
+    size_t count = (size_t) image->width * image->height, i;
+    const unsigned char *s = image->rgba;
+    int opaque = 1, bpp;
+    unsigned char *out;
+
+    for (i = 0; i < count && image->alpha; i++) {
+        if (s[i * 4 + 3] != 0xff) opaque = 0;
+    }
+    if (target < 0) {
+        /* generic: converted on the device like a decoded PNG */
+        *format = image->alpha ? THEME_PACK_RGBA_8888 : THEME_PACK_RGBX_8888;
+    } else if (opaque) {
+        *format = target;
+    } else {
+        *format = target == THEME_PACK_BGRA_8888 ?
+                THEME_PACK_BGRA_8888_PRE : THEME_PACK_RGBA_8888_PRE;
+    }
+    bpp = *format == THEME_PACK_RGB_565 ? 2 : 4;
+    *size = count * bpp;
+    out = malloc(*size);
+    if (out == NULL) return NULL;
+
+    for (i = 0; i < count; i++, s += 4) {
+        unsigned x = i % image->width, y = i / image->width;
+        unsigned char *p = out + i * bpp;
+        unsigned r = s[0], g = s[1], b = s[2], a = s[3];
+        switch (*format) {
+        case THEME_PACK_RGBA_8888:
+            p[0] = r; p[1] = g; p[2] = b; p[3] = a;
+            break;
+        case THEME_PACK_RGBX_8888:
+            p[0] = r; p[1] = g; p[2] = b; p[3] = 0xff;
+            break;
+        case THEME_PACK_BGRA_8888:
+            p[0] = b; p[1] = g; p[2] = r; p[3] = 0xff;
+            break;
+        case THEME_PACK_ARGB_8888:
+            p[0] = 0xff; p[1] = r; p[2] = g; p[3] = b;
+            break;
+        case THEME_PACK_RGB_565: {
+            unsigned v;
+            if (dither) {
+                const unsigned char *d = dither_rgbx[y & 3] + (x & 3) * 4;
+                r = r + d[0] > 255 ? 255 : r + d[0];
+                g = g + d[1] > 255 ? 255 : g + d[1];
+                b = b + d[2] > 255 ? 255 : b + d[2];
+            }
+            v = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+            p[0] = v;
+            p[1] = v >> 8;
+            break;
+        }
+        case THEME_PACK_RGBA_8888_PRE:
+            p[0] = div255(r * a); p[1] = div255(g * a);
+            p[2] = div255(b * a); p[3] = a;
+            break;
+        case THEME_PACK_BGRA_8888_PRE:
+            p[0] = div255(b * a); p[1] = div255(g * a);
+            p[2] = div255(r * a); p[3] = a;
+            break;
+        }
+    }
+    return out;
+}
+
+/* Greedy LZ4 block compression with a 4-byte hash; returns the size of
+ * dst, which must hold lz4_bound(n) bytes. */
+#define LZ4_HASH_BITS 14
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5         /* a block ends with this many literals */
+#define LZ4_MATCH_LIMIT 12          /* no match starts closer to the end */
+
+static size_t lz4_bound(size_t n)
+{
+    return n + n / 255 + 16;
+}
+
+static unsigned lz4_read32(const unsigned char *p)
+{
+    return p[0] | p[1] << 8 | p[2] << 16 | (unsigned) p[3] << 24;
+}
+
+static unsigned char *lz4_length(unsigned char *d, size_t len)
+{
+    for (; len >= 255; len -= 255) *d++ = 255;
+    *d++ = len;
+    return d;
+}
+
+static unsigned char *lz4_sequence(unsigned char *d, const unsigned char *lit,
+                                   size_t nlit, size_t offset, size_t match)
+{
+    unsigned char *token = d++;
+
+    *token = (nlit < 15 ? nlit : 15) << 4;
+    if (nlit >= 15) d = lz4_length(d, nlit - 15);
+    memcpy(d, lit, nlit);
+    d += nlit;
+    if (match == 0) return d;
+    *d++ = offset;
+    *d++ = offset >> 8;
+    match -= LZ4_MIN_MATCH;
+    *token |= match < 15 ? match : 15;
+    if (match >= 15) d = lz4_length(d, match - 15);
+    return d;
+}
+
+static size_t lz4_compress(unsigned char *dst, const unsigned char *src,
+                           size_t n)
+{
+    static size_t table[1 << LZ4_HASH_BITS];
+    const unsigned char *anchor = src, *p = src;
+    const unsigned char *limit = src + n - LZ4_MATCH_LIMIT;
+    const unsigned char *end = src + n - LZ4_LAST_LITERALS;
+    unsigned char *d = dst;
+
+    memset(table, 0xff, sizeof(table));
+    while (n > LZ4_MATCH_LIMIT && p < limit) {
+        unsigned v = lz4_read32(p);
+        unsigned h = (v * 2654435761u) >> (32 - LZ4_HASH_BITS);
+        size_t prev = table[h];
+        const unsigned char *m;
+        size_t len;
+
+        table[h] = p - src;
+        if (prev == (size_t) -1 || p - (src + prev) > 0xffff ||
+            lz4_read32(src + prev) != v) {
+            p++;
+            continue;
+        }
+        m = src + prev;
+        len = LZ4_MIN_MATCH;
+        while (p + len < end && p[len] == m[len]) len++;
+        d = lz4_sequence(d, anchor, p - anchor, p - m, len);
+        p += len;
+        anchor = p;
+    }
+    d = lz4_sequence(d, anchor, src + n - anchor, 0, 0);
+    return d - dst;
+}
+
+static int compare_image(const void *a, const void *b)
+{
+    return strcmp(((const Image *) a)->name, ((const Image *) b)->name);
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mkthemepack [-f rgb565|rgbx8888|bgra8888|argb8888]"
+            " [-d] [-u] THEME_DIR OUT.pack\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    int target = -1, dither = 0, raw = 0, c;
+    unsigned count = 0, i;
+    size_t offset, total_raw = 0, total = 0;
+    Image *images = NULL;
+    ThemePackHeader header;
+    ThemePackEntry *index;
+    struct dirent *de;
+    DIR *dir;
+    FILE *out;
+
+    while ((c = getopt(argc, argv, "f:du")) != -1) {
+        switch (c) {
+        case 'f':
+            if (!strcmp(optarg, "rgb565")) target = THEME_PACK_RGB_565;
+            else if (!strcmp(optarg, "rgbx8888")) target = THEME_PACK_RGBX_8888;
+            else if (!strcmp(optarg, "bgra8888")) target = THEME_PACK_BGRA_8888;
+            else if (!strcmp(optarg, "argb8888")) target = THEME_PACK_ARGB_8888;
+            else usage();
+            break;
+        case 'd': dither = 1; break;
+        case 'u': raw = 1; break;
+        default: usage();
+        }
+    }
+    if (argc - optind != 2) usage();
+    if (dither && target != THEME_PACK_RGB_565) {
+        fprintf(stderr, "mkthemepack: -d needs -f rgb565\n");
+        return 1;
+    }
+
+    dir = opendir(argv[optind]);
+    if (dir == NULL) {
+        perror(argv[optind]);
+        return 1;
+    }
+    while ((de = readdir(dir)) != NULL) {
+        size_t len = strlen(de->d_name);
+        char path[4096];
+        if (len < 5 || strcmp(de->d_name + len - 4, ".png") != 0) continue;
+        if (len - 4 >= THEME_PACK_NAME) {
+            fprintf(stderr, "mkthemepack: skipping %s: name too long\n",
+                    de->d_name);
+            continue;
+        }
+        images = realloc(images, (count + 1) * sizeof(*images));
+        memset(&images[count], 0, sizeof(*images));
+        memcpy(images[count].name, de->d_name, len - 4);
+        snprintf(path, sizeof(path), "%s/%s", argv[optind], de->d_name);
+        if (read_png(path, &images[count]) < 0) {
+            fprintf(stderr, "mkthemepack: skipping %s: cannot decode\n", path);
+            continue;
+        }
+        count++;
+    }
+    closedir(dir);
+    qsort(images, count, sizeof(*images), compare_image);
+
+    out = fopen(argv[optind + 1], "wb");
+    if (out == NULL) {
+        perror(argv[optind + 1]);
+        return 1;
+    }
+    index = calloc(count, sizeof(*index));
+    memcpy(header.magic, THEME_PACK_MAGIC, 4);
+    header.version = THEME_PACK_VERSION;
+    header.count = count;
+    offset = sizeof(header) + count * sizeof(*index);
+    fseek(out, offset, SEEK_SET);
+
+    for (i = 0; i < count; i++) {
+        ThemePackEntry *e = &index[i];
+        size_t size, packed;
+        unsigned char *pixels = convert(&images[i], target, dither,
+                                        &e->format, &size);
+        unsigned char *lz = raw ? NULL : malloc(lz4_bound(size));
+
+        if (pixels == NULL) {
+            fprintf(stderr, "mkthemepack: out of memory\n");
+            return 1;
+        }
+        memcpy(e->name, images[i].name, THEME_PACK_NAME);
+        e->width = images[i].width;
+        e->height = images[i].height;
+        e->offset = offset;
+        e->compression = THEME_PACK_RAW;
+        e->size = size;
+        if (lz != NULL) {
+            packed = lz4_compress(lz, pixels, size);
+            if (packed < size) {
+                e->compression = THEME_PACK_LZ4;
+                e->size = packed;
+            }
+        }
+        fwrite(e->compression == THEME_PACK_LZ4 ? lz : pixels, 1, e->size,
+               out);
+        offset += e->size;
+        total_raw += size;
+        total += e->size;
+        free(lz);
+        free(pixels);
+        free(images[i].rgba);
+    }
+
+    fseek(out, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(index, sizeof(*index), count, out);
+    if (fclose(out) != 0) {
+        perror(argv[optind + 1]);
+        return 1;
+    }
+    printf("%u images, %zu bytes of pixels stored in %zu\n",
+           count, total_raw, total);
+    return 0;
+}
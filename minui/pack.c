@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Theme packs (see themepack.h).  The pack is mapped once, the first
+ * time an image is looked up, and stays mapped; each image is
+ * decompressed from the mapping straight into its surface. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <pixelflinger/pixelflinger.h>
+
+#include "minui.h"
+#include "graphics.h"
+#include "themepack.h"
+
+static pthread_mutex_t pack_lock = PTHREAD_MUTEX_INITIALIZER;
+static char pack_path[PATH_MAX];
+static int pack_opened = 0;         /* tried since the path was set */
+static unsigned char *pack_map = NULL;
+static size_t pack_size = 0;
+static const ThemePackEntry *pack_index = NULL;
+static unsigned pack_count = 0;
+
+void res_set_theme_pack(const char *path)
+{
+    pthread_mutex_lock(&pack_lock);
+    if (pack_map != NULL) munmap(pack_map, pack_size);
+    pack_map = NULL;
+    pack_index = NULL;
+    pack_count = 0;
+    pack_opened = 0;
+    pack_path[0] = '\0';
+    if (path != NULL) strncpy(pack_path, path, sizeof(pack_path) - 1);
+    pthread_mutex_unlock(&pack_lock);
+}
+
+static int valid_format(unsigned format)
+{
+    switch (format) {
+    case THEME_PACK_RGBA_8888:
+    case THEME_PACK_RGBX_8888:
+    case THEME_PACK_RGB_565:
+    case THEME_PACK_BGRA_8888:
+    case THEME_PACK_RGBA_8888_PRE:
+    case THEME_PACK_BGRA_8888_PRE:
+    case THEME_PACK_ARGB_8888:
+        return 1;
+    }
+    return 0;
+}
+
+/* Checks everything the lookups rely on, so a damaged pack is ignored
+ * as a whole rather than read out of bounds. */
+static int valid_pack(const unsigned char *map, size_t size)
+{
+    const ThemePackHeader *h = (const ThemePackHeader *) map;
+    const ThemePackEntry *e = (const ThemePackEntry *) (h + 1);
+    unsigned i;
+
+    if (size < sizeof(*h) || memcmp(h->magic, THEME_PACK_MAGIC, 4) != 0 ||
+        h->version != THEME_PACK_VERSION ||
+        h->count > (size - sizeof(*h)) / sizeof(*e)) {
+        return 0;
+    }
+    for (i = 0; i < h->count; i++, e++) {
+        if (e->name[THEME_PACK_NAME - 1] != '\0' ||
+            (i > 0 && strcmp(e[-1].name, e->name) >= 0) ||
+            !valid_format(e->format) ||
+            e->compression > THEME_PACK_LZ4 ||
+            e->width == 0 || e->height == 0 ||
+            e->width > 0x4000 || e->height > 0x4000 ||
+            e->offset > size || e->size > size - e->offset) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void pack_open_locked(void)
+{
+    struct stat st;
+    void *map;
+    int fd;
+
+    pack_opened = 1;
+    if (pack_path[0] == '\0') return;
+    fd = open(pack_path, O_RDONLY);
+    if (fd < 0) return;
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+        close(fd);
+        return;
+    }
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror(pack_path);
+        return;
+    }
+    if (!valid_pack(map, st.st_size)) {
+        fprintf(stderr, "%s: not a theme pack\n", pack_path);
+        munmap(map, st.st_size);
+        return;
+    }
+    pack_map = map;
+    pack_size = st.st_size;
+    pack_index = (const ThemePackEntry *) ((const ThemePackHeader *) map + 1);
+    pack_count = ((const ThemePackHeader *) map)->count;
+}
+
+static int compare_entry(const void *name, const void *entry)
+{
+    return strcmp(name, ((const ThemePackEntry *) entry)->name);
+}
+
+const ThemePackEntry *res_pack_find(const char *name)
+{
+    pthread_mutex_lock(&pack_lock);
+    if (!pack_opened) pack_open_locked();
+    pthread_mutex_unlock(&pack_lock);
+
+    if (pack_map == NULL) return NULL;
+    return bsearch(name, pack_index, pack_count, sizeof(*pack_index),
+                   compare_entry);
+}
+
+/* Decodes the LZ4 block src into exactly size bytes at dst; -1 if it is
+ * malformed or decodes to any other size. */
+static int lz4_decode(unsigned char *dst, size_t size,
+                      const unsigned char *src, size_t src_size)
+{
+    const unsigned char *s = src, *s_end = src + src_size;
+    unsigned char *d = dst, *d_end = dst + size;
+
+    while (s < s_end) {
+        unsigned token = *s++;
+        size_t len = token >> 4, offset;
+        const unsigned char *m;
+
+        if (len == 15) {
+            unsigned b;
+            do {
+                if (s == s_end) return -1;
+                b = *s++;
+                len += b;
+            } while (b == 255);
+        }
+        if (len > (size_t) (s_end - s) || len > (size_t) (d_end - d))
+            return -1;
+        memcpy(d, s, len);
+        d += len;
+        s += len;
+        /* the last sequence has literals only */
+        if (s == s_end) break;
+
+        if (s_end - s < 2) return -1;
+        offset = s[0] | s[1] << 8;
+        s += 2;
+        if (offset == 0 || offset > (size_t) (d - dst)) return -1;
+        len = token & 15;
+        if (len == 15) {
+            unsigned b;
+            do {
+                if (s == s_end) return -1;
+                b = *s++;
+                len += b;
+            } while (b == 255);
+        }
+        len += 4;
+        if (len > (size_t) (d_end - d)) return -1;
+        /* byte by byte: the match may overlap what it produces */
+        for (m = d - offset; len > 0; len--) *d++ = *m++;
+    }
+    return d == d_end ? 0 : -1;
+}
+
+GGLSurface *res_pack_load(const ThemePackEntry *e)
+{
+    size_t size = (size_t) e->width * e->height * gr_bytes_per_pixel(e->format);
+    const unsigned char *src = pack_map + e->offset;
+    GGLSurface *surface = malloc(sizeof(*surface) + size);
+
+    if (surface == NULL) return NULL;
+    surface->version = sizeof(*surface);
+    surface->width = e->width;
+    surface->height = e->height;
+    surface->stride = e->width;
+    surface->data = (unsigned char *) (surface + 1);
+    surface->format = e->format;
+
+    if (e->compression == THEME_PACK_LZ4 ?
+            lz4_decode(surface->data, size, src, e->size) < 0 :
+            e->size != size) {
+        fprintf(stderr, "%s: image %s is damaged\n", pack_path, e->name);
+        free(surface);
+        return NULL;
+    }
+    if (e->compression == THEME_PACK_RAW) memcpy(surface->data, src, size);
+    return surface;
+}
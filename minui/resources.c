@@ -14,14 +14,19 @@
  * limitations under the License.
  */
 
+#include <limits.h>
+#include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
 #include <fcntl.h>
+#include <pthread.h>
 #include <stdio.h>
 
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 
 #include <linux/fb.h>
@@ -32,6 +37,7 @@
 #include <png.h>
 
 #include "minui.h"
+#include "graphics.h"
 
 // libpng gives "undefined reference to 'pow'" errors, and I have no
 // idea how to convince the build system to link with -lm.  We don't
@@ -41,54 +47,269 @@ double pow(double x, double y) {
     return x;
 }
 
-int res_create_surface(const char* name, gr_surface* pSurface) {
-    char resPath[256];
-    GGLSurface* surface = NULL;
-    int result = 0;
-    unsigned char header[8];
-    png_structp png_ptr = NULL;
-    png_infop info_ptr = NULL;
+static int res_theme_width = 0;
 
-    *pSurface = NULL;
+void res_set_theme_width(int width) {
+    res_theme_width = width;
+}
 
-    snprintf(resPath, sizeof(resPath)-1, RES_LOC, name);
-    resPath[sizeof(resPath)-1] = '\0';
-    FILE* fp = fopen(resPath, "rb");
-    if (fp == NULL) {
-        result = -1;
-        goto exit;
+static int res_dither = 0;
+
+void res_set_dither(int dither) {
+    res_dither = dither;
+}
+
+static const char* res_cache_dir = NULL;
+
+void res_set_cache_dir(const char* dir) {
+    res_cache_dir = dir;
+}
+
+int res_scaled(int length) {
+    if (res_theme_width <= 0 || gr_fb_width() <= 0) {
+        return length;
     }
+    return (length * gr_fb_width() + res_theme_width / 2) / res_theme_width;
+}
 
-    size_t bytesRead = fread(header, 1, sizeof(header), fp);
-    if (bytesRead != sizeof(header)) {
-        result = -2;
-        goto exit;
+// Converts an opaque 8888 surface to format, in place or, for a smaller
+// format, into a new surface, freeing the old one.  Returns NULL if out
+// of memory, leaving the surface as it was.
+static GGLSurface* native_surface(GGLSurface* surface, int format,
+                                  const GRKernels* k) {
+    size_t width = surface->width;
+    size_t height = surface->height;
+    size_t bpp = gr_bytes_per_pixel(format);
+    GGLSurface* out = surface;
+
+    if (bpp != 4) {
+        out = malloc(sizeof(GGLSurface) + bpp * width * height);
+        if (out == NULL) return NULL;
+        *out = *surface;
+        out->data = (unsigned char*) (out + 1);
     }
+    k->copy_rgbx(out->data, width * bpp, surface->data, width * 4,
+                 width, height);
+    out->format = format;
+    if (out != surface) free(surface);
+    return out;
+}
 
-    if (png_sig_cmp(header, 0, sizeof(header))) {
-        result = -3;
-        goto exit;
+// Turns a freshly decoded RGBA_8888 surface into the premultiplied
+// layout the kernels for format composite, in place.  If every pixel
+// turns out to be opaque it is converted to format itself instead, so it
+// blits as a plain copy, or with dither just marked RGBX_8888 for
+// dithered_surface().  Returns the surface to keep.
+static GGLSurface* native_alpha_surface(GGLSurface* surface, int format,
+                                        const GRKernels* k, int dither) {
+    size_t width = surface->width;
+    size_t height = surface->height;
+    size_t count = width * height;
+    unsigned char* p = surface->data;
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        if (p[i * 4 + 3] != 0xff) break;
     }
 
-    png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-    if (!png_ptr) {
-        result = -4;
-        goto exit;
+    if (i == count && dither) {
+        surface->format = GGL_PIXEL_FORMAT_RGBX_8888;
+        return surface;
+    }
+    if (i == count) {
+        GGLSurface* out = native_surface(surface, format, k);
+        if (out != NULL) return out;
     }
 
-    info_ptr = png_create_info_struct(png_ptr);
-    if (!info_ptr) {
-        result = -5;
-        goto exit;
+    surface->format = gr_premultiplied_format(format);
+    for (i = 0; i < count; ++i, p += 4) {
+        unsigned a = p[3];
+        unsigned r = gr_div255(p[0] * a);
+        unsigned g = gr_div255(p[1] * a);
+        unsigned b = gr_div255(p[2] * a);
+        if (surface->format == GR_PIXEL_FORMAT_BGRA_8888_PRE) {
+            unsigned t = r; r = b; b = t;
+        }
+        p[0] = r;
+        p[1] = g;
+        p[2] = b;
+    }
+    return surface;
+}
+
+// Converts an RGBX_8888 surface to the RGB_565 format with the dither
+// kernel, freeing it; on failure it is kept as it is.
+static GGLSurface* dithered_surface(GGLSurface* surface, int format,
+                                    const GRKernels* k) {
+    size_t count = surface->width * surface->height;
+    GGLSurface* out = malloc(sizeof(GGLSurface) + 2 * count);
+
+    if (out == NULL) return surface;
+    *out = *surface;
+    out->stride = surface->width;
+    out->data = (unsigned char*) (out + 1);
+    out->format = format;
+    k->dither_rgbx(out->data, surface->width * 2, surface->data,
+                   surface->stride * 4, surface->width, surface->height);
+    free(surface);
+    return out;
+}
+
+// A cached surface is this header followed by its pixels, packed.  It
+// is used only if everything it was made from still matches.
+typedef struct {
+    char magic[4];              // "GRSC"
+    // the PNG
+    char path[256];
+    unsigned size;
+    unsigned mtime;
+    // how it was converted
+    int draw_format;
+    int fb_width;
+    int theme_width;
+    int dither;
+    // the surface
+    unsigned width;
+    unsigned height;
+    int format;
+} SurfaceCacheHeader;
+
+static void cache_header(SurfaceCacheHeader* h, const char* path,
+                         const struct stat* st) {
+    memset(h, 0, sizeof(*h));
+    memcpy(h->magic, "GRSC", 4);
+    strncpy(h->path, path, sizeof(h->path) - 1);
+    h->size = st->st_size;
+    h->mtime = st->st_mtime;
+    h->draw_format = gr_draw_format();
+    h->fb_width = gr_fb_width();
+    h->theme_width = res_theme_width;
+    h->dither = res_dither;
+}
+
+static size_t cache_pixel_size(const SurfaceCacheHeader* h) {
+    return (size_t) h->width * h->height * gr_bytes_per_pixel(h->format);
+}
+
+// Maps the cached copy of the image at path read-only as the pixels of
+// a new surface; NULL if there is none or it is stale.
+static GGLSurface* cache_load(const char* cachePath, const char* path,
+                              const struct stat* st) {
+    SurfaceCacheHeader want;
+    const SurfaceCacheHeader* h;
+    GGLSurface* surface;
+    struct stat cst;
+    void* map;
+    int fd;
+
+    fd = open(cachePath, O_RDONLY);
+    if (fd < 0) return NULL;
+    if (fstat(fd, &cst) < 0 || cst.st_size < (off_t) sizeof(want)) {
+        close(fd);
+        return NULL;
     }
+    map = mmap(NULL, cst.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return NULL;
 
+    h = map;
+    cache_header(&want, path, st);
+    if (memcmp(h, &want, offsetof(SurfaceCacheHeader, width)) != 0 ||
+        sizeof(*h) + cache_pixel_size(h) != (size_t) cst.st_size ||
+        (surface = malloc(sizeof(GGLSurface))) == NULL) {
+        munmap(map, cst.st_size);
+        return NULL;
+    }
+    surface->version = sizeof(GGLSurface);
+    surface->width = h->width;
+    surface->height = h->height;
+    surface->stride = h->width;
+    surface->data = (unsigned char*) (h + 1);
+    surface->format = h->format;
+    return surface;
+}
+
+// Writes surface to the cache, replacing what was there in one rename.
+static void cache_store(const char* cachePath, const char* path,
+                        const struct stat* st, const GGLSurface* surface) {
+    char tmpPath[PATH_MAX];
+    SurfaceCacheHeader h;
+    size_t size;
+    int fd, ok;
+
+    cache_header(&h, path, st);
+    h.width = surface->width;
+    h.height = surface->height;
+    h.format = surface->format;
+    size = cache_pixel_size(&h);
+
+    mkdir(res_cache_dir, 0755);
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", cachePath);
+    fd = open(tmpPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return;
+    ok = write(fd, &h, sizeof(h)) == (ssize_t) sizeof(h) &&
+         write(fd, surface->data, size) == (ssize_t) size;
+    if (close(fd) < 0) ok = 0;
+    if (!ok || rename(tmpPath, cachePath) < 0) {
+        fprintf(stderr, "cannot cache %s in %s\n", path, cachePath);
+        unlink(tmpPath);
+    }
+}
+
+// Brings a decoded surface to the form it is drawn in: the screen's own
+// format or its premultiplied layout, scaled for the screen, and
+// dithered if asked.  Returns the surface to keep.
+static GGLSurface* finish_surface(GGLSurface* surface, int format,
+                                  const GRKernels* k, int dither) {
+    int width = surface->width, height = surface->height;
+
+    if (k != NULL && surface->format == GGL_PIXEL_FORMAT_RGBA_8888) {
+        surface = native_alpha_surface(surface, format, k, dither);
+    } else if (k != NULL && surface->format == GGL_PIXEL_FORMAT_RGBX_8888 &&
+               format != GGL_PIXEL_FORMAT_RGBX_8888 && !dither) {
+        GGLSurface* out = native_surface(surface, format, k);
+        if (out != NULL) surface = out;
+    }
+
+    // Scale once here rather than on every blit.
+    if (res_scaled(width) != width) {
+        int w = res_scaled(width), h = res_scaled(height);
+        GGLSurface* scaled = gr_scaled_surface(surface, w > 0 ? w : 1,
+                                               h > 0 ? h : 1);
+        if (scaled != NULL) {
+            free(surface);
+            surface = scaled;
+        }
+    }
+    if (dither && surface->format == GGL_PIXEL_FORMAT_RGBX_8888) {
+        surface = dithered_surface(surface, format, k);
+    }
+    return surface;
+}
+
+// Whether a theme pack entry in packFormat can be drawn after
+// finish_surface(): generic 8888 always, native layouts only if they
+// are this screen's.
+static int pack_usable(int packFormat, int format, const GRKernels* k) {
+    if (packFormat == GGL_PIXEL_FORMAT_RGBX_8888 ||
+        packFormat == GGL_PIXEL_FORMAT_RGBA_8888) {
+        return 1;
+    }
+    return k != NULL && (packFormat == format ||
+                         packFormat == gr_premultiplied_format(format));
+}
+
+// Decodes the image after its signature into *pSurface, converting
+// opaque rows to format through the scratch row *pRow.  Whatever it
+// allocates is left in *pSurface and *pRow for the caller to free, so
+// nothing here has to survive a longjmp from libpng.
+static int read_png(png_structp png_ptr, png_infop info_ptr, int format,
+                    const GRKernels* k, int dither,
+                    GGLSurface** pSurface, unsigned char** pRow) {
     if (setjmp(png_jmpbuf(png_ptr))) {
-        result = -6;
-        goto exit;
+        return -6;
     }
 
-    png_init_io(png_ptr, fp);
-    png_set_sig_bytes(png_ptr, sizeof(header));
     png_read_info(png_ptr, info_ptr);
 
     size_t width = info_ptr->width;
@@ -104,13 +325,36 @@ int res_create_surface(const char* name, gr_surface* pSurface) {
            (channels == 4 && color_type == PNG_COLOR_TYPE_RGBA) ||
            (channels == 1 && color_type == PNG_COLOR_TYPE_PALETTE)))) {
         return -7;
-        goto exit;
     }
 
-    surface = malloc(sizeof(GGLSurface) + pixelSize);
+    int alpha = 0;
+    if (color_type == PNG_COLOR_TYPE_PALETTE) {
+        png_set_palette_to_rgb(png_ptr);
+    }
+    if (png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS)) {
+        png_set_tRNS_to_alpha(png_ptr);
+        alpha = 1;
+    }
+    int opaque = (channels == 3 || (channels == 1 && !alpha));
+
+    // Opaque images drop their alpha channel: RGB_565 targets store
+    // them at two bytes per pixel.  Dithered ones are kept at 8 bits a
+    // channel until they are scaled, so the pattern lands on screen
+    // pixels and the filter does not smear it.
+    unsigned char* row = NULL;
+    size_t bpp = 4;
+    if (k != NULL && opaque && !dither) {
+        bpp = gr_bytes_per_pixel(format);
+        pixelSize = bpp * width * height;
+        row = *pRow = malloc(stride);
+        if (row == NULL) {
+            return -8;
+        }
+    }
+
+    GGLSurface* surface = *pSurface = malloc(sizeof(GGLSurface) + pixelSize);
     if (surface == NULL) {
-        result = -8;
-        goto exit;
+        return -8;
     }
     unsigned char* pData = (unsigned char*) (surface + 1);
     surface->version = sizeof(GGLSurface);
@@ -121,19 +365,10 @@ int res_create_surface(const char* name, gr_surface* pSurface) {
     surface->format = (channels == 3) ?
             GGL_PIXEL_FORMAT_RGBX_8888 : GGL_PIXEL_FORMAT_RGBA_8888;
 
-    int alpha = 0;
-    if (color_type == PNG_COLOR_TYPE_PALETTE) {
-        png_set_palette_to_rgb(png_ptr);
-    }
-    if (png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS)) {
-        png_set_tRNS_to_alpha(png_ptr);
-        alpha = 1;
-    }
-
     int y;
-    if (channels == 3 || (channels == 1 && !alpha)) {
+    if (opaque) {
         for (y = 0; y < height; ++y) {
-            unsigned char* pRow = pData + y * stride;
+            unsigned char* pRow = row ? row : pData + y * stride;
             png_read_row(png_ptr, pRow, NULL);
 
             int x;
@@ -149,6 +384,14 @@ int res_create_surface(const char* name, gr_surface* pSurface) {
                 pRow[dx + 2] = b; // b
                 pRow[dx + 3] = a;
             }
+            if (row) {
+                k->copy_rgbx(pData + y * width * bpp, 0, row, 0, width, 1);
+            }
+        }
+        if (row) {
+            surface->format = format;
+        } else if (dither) {
+            surface->format = GGL_PIXEL_FORMAT_RGBX_8888;
         }
     } else {
         for (y = 0; y < height; ++y) {
@@ -156,11 +399,102 @@ int res_create_surface(const char* name, gr_surface* pSurface) {
             png_read_row(png_ptr, pRow, NULL);
         }
     }
+    return 0;
+}
+
+int res_create_surface(const char* name, gr_surface* pSurface) {
+    char resPath[256];
+    GGLSurface* surface = NULL;
+    int result = 0;
+    unsigned char header[8];
+    png_structp png_ptr = NULL;
+    png_infop info_ptr = NULL;
+    unsigned char* row = NULL;
+
+    *pSurface = NULL;
+
+    snprintf(resPath, sizeof(resPath)-1, RES_LOC, name);
+    resPath[sizeof(resPath)-1] = '\0';
+
+    // Convert to the framebuffer's own format at load time when the
+    // native kernels can draw it, so blits need no conversion.
+    int format = gr_draw_format();
+    const GRKernels* k = format < 0 ? NULL : gr_get_kernels(format);
+    int dither = res_dither && k != NULL && gr_bytes_per_pixel(format) == 2;
+
+    // A theme pack has the image decoded already.
+    const ThemePackEntry* entry = res_pack_find(name);
+    if (entry != NULL && pack_usable(entry->format, format, k)) {
+        surface = res_pack_load(entry);
+        if (surface != NULL) {
+            *pSurface = (gr_surface) finish_surface(surface, format, k,
+                                                    dither);
+            return 0;
+        }
+    }
+
+    // A hit in the cache costs no decoding, and its pixels are only
+    // read in as they are drawn.
+    char cachePath[PATH_MAX];
+    struct stat st;
+    int cached = res_cache_dir != NULL && format >= 0 &&
+            stat(resPath, &st) == 0;
+    if (cached) {
+        snprintf(cachePath, sizeof(cachePath), "%s/%s.surface",
+                 res_cache_dir, name);
+        surface = cache_load(cachePath, resPath, &st);
+        if (surface != NULL) {
+            *pSurface = (gr_surface) surface;
+            return 0;
+        }
+    }
+
+    FILE* fp = fopen(resPath, "rb");
+    if (fp == NULL) {
+        result = -1;
+        goto exit;
+    }
+
+    size_t bytesRead = fread(header, 1, sizeof(header), fp);
+    if (bytesRead != sizeof(header)) {
+        result = -2;
+        goto exit;
+    }
+
+    if (png_sig_cmp(header, 0, sizeof(header))) {
+        result = -3;
+        goto exit;
+    }
+
+    png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if (!png_ptr) {
+        result = -4;
+        goto exit;
+    }
+
+    info_ptr = png_create_info_struct(png_ptr);
+    if (!info_ptr) {
+        result = -5;
+        goto exit;
+    }
+
+    png_init_io(png_ptr, fp);
+    png_set_sig_bytes(png_ptr, sizeof(header));
+    result = read_png(png_ptr, info_ptr, format, k, dither, &surface, &row);
+    if (result < 0) {
+        goto exit;
+    }
+    surface = finish_surface(surface, format, k, dither);
+
+    if (cached) {
+        cache_store(cachePath, resPath, &st, surface);
+    }
 
     *pSurface = (gr_surface) surface;
 
 exit:
     png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
+    free(row);
 
     if (fp != NULL) {
         fclose(fp);
@@ -173,9 +507,76 @@ exit:
     return result;
 }
 
+// At most this many threads decode at once, the caller's included.
+#define RES_MAX_THREADS 4
+
+typedef struct {
+    const char* const* names;
+    gr_surface* surfaces;
+    int* results;
+    int count;
+    int next;               // the first image no thread has taken
+    pthread_mutex_t lock;
+} ResBatch;
+
+static void* batch_thread(void* cookie) {
+    ResBatch* batch = cookie;
+    int i;
+
+    for (;;) {
+        pthread_mutex_lock(&batch->lock);
+        i = batch->next++;
+        pthread_mutex_unlock(&batch->lock);
+        if (i >= batch->count) break;
+        batch->results[i] = res_create_surface(batch->names[i],
+                                               &batch->surfaces[i]);
+    }
+    return NULL;
+}
+
+int res_create_surfaces(const char* const* names, gr_surface* surfaces,
+                        int* results, int count) {
+    ResBatch batch = { names, surfaces, results, count, 0,
+                       PTHREAD_MUTEX_INITIALIZER };
+    pthread_t threads[RES_MAX_THREADS - 1];
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int format = gr_draw_format();
+    int started, i, result = 0;
+
+    // The kernel tables are filled in on first use; do that before the
+    // threads share them.
+    if (format >= 0) {
+        gr_get_kernels(format);
+        gr_get_kernels(GGL_PIXEL_FORMAT_RGBX_8888);
+    }
+
+    if (cpus > RES_MAX_THREADS) cpus = RES_MAX_THREADS;
+    if (cpus > count) cpus = count;
+    for (started = 0; started < cpus - 1; started++) {
+        if (pthread_create(&threads[started], NULL, batch_thread,
+                           &batch) != 0) {
+            break;
+        }
+    }
+    batch_thread(&batch);
+    for (i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (i = 0; i < count; i++) {
+        if (results[i] < 0) result = -1;
+    }
+    return result;
+}
+
 void res_free_surface(gr_surface surface) {
     GGLSurface* pSurface = (GGLSurface*) surface;
     if (pSurface) {
+        if (pSurface->data != (unsigned char*) (pSurface + 1)) {
+            // mapped by cache_load(), just after the header
+            SurfaceCacheHeader* h = (SurfaceCacheHeader*) pSurface->data - 1;
+            munmap(h, sizeof(*h) + cache_pixel_size(h));
+        }
         free(pSurface);
     }
 }
@@ -1,281 +1,304 @@
-struct {
+const struct {
   unsigned width;
   unsigned height;
   unsigned cwidth;
   unsigned cheight;
-  unsigned char rundata[];
+  unsigned stride;
+  unsigned char bits[];
 } font = {
   .width = 1440,
   .height = 24,
   .cwidth = 15,
   .cheight = 24,
-  .rundata = {
-0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x6e,0x81,0x3e,0x81,
-0x07,0x81,0x7f,0x7f,0x7f,0x7f,0x7f,0x76,0x84,0x17,0x84,0x7f,0x7f,0x7f,0x7f,
-0x4c,0x81,0x3d,0x82,0x07,0x82,0x5f,0x81,0x7f,0x7f,0x7f,0x7f,0x7f,0x15,0x84,
-0x07,0x82,0x0e,0x84,0x45,0x82,0x24,0x82,0x1a,0x83,0x16,0x82,0x10,0x82,0x0e,
-0x82,0x0a,0x82,0x0d,0x84,0x7f,0x62,0x82,0x0b,0x82,0x0b,0x82,0x3b,0x82,0x0c,
-0x82,0x02,0x82,0x0a,0x82,0x03,0x81,0x0a,0x84,0x08,0x83,0x0e,0x84,0x0b,0x82,
-0x10,0x82,0x09,0x82,0x5e,0x81,0x09,0x84,0x0b,0x84,0x0b,0x84,0x0b,0x84,0x0e,
-0x83,0x08,0x88,0x09,0x84,0x07,0x8a,0x08,0x84,0x0b,0x84,0x56,0x84,0x1c,0x82,
-0x08,0x87,0x0b,0x85,0x07,0x87,0x09,0x89,0x06,0x8a,0x07,0x85,0x06,0x82,0x08,
-0x82,0x06,0x86,0x0f,0x82,0x06,0x82,0x07,0x82,0x04,0x82,0x0a,0x83,0x09,0x82,
-0x03,0x82,0x08,0x82,0x06,0x85,0x07,0x87,0x0b,0x85,0x07,0x87,0x0c,0x84,0x06,
-0x8d,0x03,0x82,0x07,0x82,0x02,0x83,0x08,0x83,0x01,0x82,0x0a,0x82,0x02,0x82,
-0x08,0x82,0x03,0x82,0x08,0x82,0x04,0x8b,0x09,0x82,0x09,0x82,0x10,0x82,0x0d,
-0x81,0x1d,0x82,0x18,0x82,0x24,0x82,0x19,0x84,0x16,0x82,0x10,0x82,0x0e,0x82,
-0x0a,0x82,0x0d,0x84,0x7f,0x61,0x82,0x0c,0x82,0x0c,0x82,0x3a,0x82,0x0c,0x82,
-0x02,0x82,0x0a,0x82,0x03,0x81,0x08,0x87,0x06,0x82,0x01,0x82,0x0c,0x86,0x0a,
-0x82,0x0f,0x82,0x0b,0x82,0x5c,0x82,0x08,0x87,0x07,0x86,0x0a,0x87,0x08,0x87,
-0x0c,0x83,0x08,0x88,0x07,0x87,0x06,0x8a,0x07,0x87,0x07,0x87,0x54,0x87,0x08,
-0x86,0x0c,0x82,0x08,0x89,0x07,0x88,0x06,0x89,0x07,0x89,0x06,0x8a,0x05,0x88,
-0x05,0x82,0x08,0x82,0x06,0x86,0x0f,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x0a,
-0x83,0x08,0x83,0x03,0x83,0x07,0x82,0x04,0x88,0x06,0x89,0x07,0x88,0x06,0x89,
-0x08,0x88,0x04,0x8d,0x03,0x82,0x07,0x82,0x03,0x82,0x08,0x82,0x02,0x82,0x04,
-0x81,0x05,0x82,0x03,0x82,0x06,0x82,0x04,0x82,0x07,0x83,0x04,0x8b,0x09,0x82,
-0x0a,0x82,0x0f,0x82,0x0c,0x83,0x1d,0x82,0x17,0x82,0x24,0x82,0x18,0x83,0x18,
-0x82,0x2c,0x82,0x0f,0x82,0x7f,0x60,0x83,0x0c,0x82,0x0d,0x82,0x39,0x82,0x0c,
-0x82,0x02,0x82,0x0a,0x82,0x02,0x82,0x07,0x83,0x03,0x83,0x04,0x82,0x03,0x81,
-0x04,0x81,0x06,0x83,0x03,0x82,0x09,0x82,0x0f,0x82,0x0b,0x82,0x5c,0x82,0x07,
-0x82,0x04,0x82,0x0a,0x83,0x09,0x82,0x04,0x83,0x06,0x82,0x04,0x83,0x0a,0x84,
-0x08,0x82,0x0d,0x82,0x13,0x82,0x06,0x82,0x04,0x83,0x06,0x82,0x04,0x82,0x52,
-0x82,0x04,0x82,0x07,0x82,0x05,0x82,0x09,0x84,0x07,0x82,0x05,0x83,0x06,0x82,
-0x05,0x82,0x05,0x82,0x05,0x83,0x06,0x82,0x0d,0x82,0x0d,0x82,0x05,0x82,0x04,
-0x82,0x08,0x82,0x08,0x82,0x11,0x82,0x06,0x82,0x05,0x82,0x06,0x82,0x0a,0x83,
-0x08,0x83,0x03,0x83,0x07,0x82,0x04,0x82,0x05,0x82,0x05,0x82,0x06,0x82,0x06,
-0x82,0x05,0x82,0x05,0x82,0x05,0x83,0x06,0x83,0x04,0x83,0x08,0x83,0x08,0x82,
-0x07,0x82,0x03,0x82,0x08,0x82,0x02,0x82,0x03,0x83,0x04,0x82,0x03,0x83,0x04,
-0x83,0x05,0x82,0x06,0x82,0x0d,0x82,0x0a,0x82,0x0a,0x82,0x0f,0x82,0x0c,0x83,
-0x1e,0x81,0x17,0x82,0x24,0x82,0x18,0x82,0x19,0x82,0x2c,0x82,0x0f,0x82,0x74,
-0x82,0x69,0x82,0x0d,0x82,0x0d,0x82,0x39,0x82,0x0c,0x82,0x02,0x82,0x0a,0x82,
-0x02,0x82,0x07,0x82,0x05,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x06,0x82,0x04,
-0x82,0x09,0x82,0x0e,0x82,0x0d,0x82,0x1c,0x82,0x3c,0x82,0x08,0x82,0x05,0x82,
-0x09,0x83,0x09,0x82,0x05,0x82,0x05,0x83,0x05,0x82,0x09,0x85,0x07,0x82,0x0d,
-0x82,0x13,0x82,0x07,0x82,0x05,0x82,0x05,0x82,0x05,0x83,0x51,0x82,0x04,0x82,
-0x06,0x82,0x07,0x82,0x08,0x84,0x07,0x82,0x06,0x82,0x05,0x82,0x07,0x82,0x04,
-0x82,0x06,0x83,0x05,0x82,0x0d,0x82,0x0c,0x82,0x07,0x82,0x03,0x82,0x08,0x82,
-0x08,0x82,0x11,0x82,0x06,0x82,0x04,0x83,0x06,0x82,0x0a,0x84,0x06,0x84,0x03,
-0x84,0x06,0x82,0x03,0x82,0x07,0x82,0x04,0x82,0x07,0x82,0x04,0x82,0x07,0x82,
-0x04,0x82,0x06,0x82,0x06,0x82,0x06,0x82,0x08,0x83,0x08,0x82,0x07,0x82,0x03,
-0x83,0x06,0x83,0x02,0x82,0x03,0x83,0x03,0x82,0x05,0x82,0x04,0x82,0x06,0x82,
-0x05,0x83,0x0c,0x83,0x0a,0x82,0x0b,0x82,0x0e,0x82,0x0c,0x81,0x01,0x82,0x35,
-0x82,0x24,0x82,0x18,0x82,0x19,0x82,0x2c,0x82,0x0f,0x82,0x74,0x82,0x69,0x82,
-0x0d,0x82,0x0d,0x83,0x38,0x82,0x0c,0x82,0x02,0x81,0x0b,0x81,0x03,0x82,0x07,
-0x82,0x05,0x82,0x04,0x82,0x03,0x82,0x02,0x81,0x07,0x82,0x04,0x82,0x09,0x82,
-0x0e,0x82,0x0d,0x82,0x0d,0x82,0x0d,0x82,0x3c,0x82,0x07,0x82,0x06,0x82,0x09,
-0x83,0x08,0x83,0x05,0x82,0x0d,0x82,0x09,0x85,0x07,0x82,0x0d,0x82,0x12,0x83,
-0x07,0x82,0x05,0x82,0x05,0x82,0x06,0x82,0x57,0x83,0x04,0x82,0x09,0x81,0x08,
-0x84,0x07,0x82,0x06,0x82,0x05,0x82,0x07,0x82,0x04,0x82,0x07,0x82,0x05,0x82,
-0x0d,0x82,0x0c,0x82,0x07,0x82,0x03,0x82,0x08,0x82,0x08,0x82,0x11,0x82,0x06,
-0x82,0x03,0x83,0x07,0x82,0x0a,0x84,0x06,0x84,0x03,0x85,0x05,0x82,0x03,0x82,
-0x07,0x82,0x04,0x82,0x07,0x82,0x04,0x82,0x07,0x82,0x04,0x82,0x06,0x83,0x05,
-0x82,0x06,0x82,0x08,0x83,0x08,0x82,0x07,0x82,0x04,0x82,0x06,0x82,0x03,0x82,
-0x03,0x83,0x03,0x82,0x05,0x83,0x02,0x83,0x07,0x82,0x04,0x82,0x0d,0x82,0x0b,
-0x82,0x0b,0x82,0x0e,0x82,0x0b,0x82,0x01,0x82,0x29,0x84,0x08,0x82,0x01,0x84,
-0x0a,0x86,0x0a,0x83,0x02,0x82,0x08,0x84,0x0a,0x86,0x0a,0x83,0x02,0x82,0x06,
-0x82,0x01,0x84,0x09,0x84,0x0e,0x82,0x0a,0x82,0x04,0x83,0x08,0x82,0x07,0x81,
-0x02,0x83,0x03,0x83,0x05,0x81,0x02,0x84,0x0b,0x84,0x09,0x81,0x02,0x84,0x0a,
-0x83,0x02,0x82,0x08,0x81,0x02,0x84,0x08,0x84,0x08,0x88,0x07,0x82,0x06,0x82,
-0x05,0x82,0x06,0x82,0x03,0x82,0x03,0x82,0x05,0x82,0x04,0x82,0x05,0x82,0x04,
-0x83,0x05,0x83,0x06,0x89,0x09,0x82,0x0d,0x82,0x0d,0x83,0x38,0x82,0x0c,0x82,
-0x02,0x81,0x08,0x8b,0x05,0x82,0x0b,0x82,0x03,0x81,0x02,0x82,0x07,0x83,0x02,
-0x82,0x0a,0x81,0x0f,0x82,0x0d,0x82,0x0d,0x82,0x0d,0x82,0x3c,0x82,0x07,0x82,
-0x06,0x82,0x09,0x83,0x10,0x82,0x0d,0x82,0x08,0x82,0x01,0x83,0x07,0x82,0x0d,
-0x82,0x12,0x82,0x08,0x82,0x05,0x82,0x05,0x82,0x06,0x82,0x08,0x82,0x0d,0x82,
-0x13,0x81,0x06,0x89,0x06,0x81,0x14,0x82,0x05,0x81,0x04,0x84,0x02,0x82,0x06,
-0x82,0x02,0x82,0x06,0x82,0x06,0x82,0x04,0x82,0x0e,0x82,0x07,0x82,0x05,0x82,
-0x0d,0x82,0x0b,0x82,0x0d,0x82,0x08,0x82,0x08,0x82,0x11,0x82,0x06,0x82,0x03,
-0x82,0x08,0x82,0x0a,0x82,0x01,0x82,0x05,0x84,0x03,0x82,0x01,0x82,0x05,0x82,
-0x02,0x82,0x09,0x82,0x03,0x82,0x07,0x82,0x03,0x82,0x09,0x82,0x03,0x82,0x06,
-0x83,0x05,0x82,0x10,0x83,0x08,0x82,0x07,0x82,0x04,0x82,0x06,0x82,0x03,0x82,
-0x03,0x81,0x01,0x82,0x02,0x82,0x06,0x82,0x02,0x82,0x08,0x82,0x03,0x83,0x0c,
-0x82,0x0c,0x82,0x0b,0x82,0x0e,0x82,0x0b,0x82,0x02,0x81,0x28,0x87,0x06,0x88,
-0x08,0x88,0x08,0x88,0x07,0x86,0x09,0x86,0x09,0x88,0x06,0x88,0x08,0x84,0x0e,
-0x82,0x0a,0x82,0x03,0x83,0x09,0x82,0x07,0x87,0x01,0x85,0x04,0x88,0x09,0x87,
-0x07,0x81,0x01,0x86,0x08,0x88,0x08,0x87,0x06,0x87,0x07,0x88,0x07,0x82,0x06,
-0x82,0x05,0x82,0x05,0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x04,0x83,0x03,0x83,
-0x05,0x82,0x05,0x82,0x07,0x89,0x09,0x82,0x0d,0x82,0x0d,0x83,0x38,0x82,0x1b,
-0x82,0x03,0x81,0x08,0x83,0x0b,0x85,0x01,0x82,0x09,0x85,0x1a,0x83,0x0d,0x83,
-0x09,0x81,0x02,0x82,0x01,0x81,0x0b,0x82,0x3b,0x82,0x08,0x82,0x06,0x82,0x09,
-0x83,0x0f,0x82,0x0d,0x82,0x09,0x82,0x01,0x83,0x07,0x87,0x07,0x83,0x01,0x84,
-0x0c,0x82,0x09,0x83,0x03,0x82,0x06,0x82,0x06,0x82,0x08,0x82,0x0d,0x82,0x11,
-0x83,0x06,0x89,0x06,0x83,0x12,0x82,0x05,0x81,0x03,0x82,0x02,0x82,0x02,0x81,
-0x06,0x82,0x02,0x82,0x06,0x82,0x05,0x82,0x05,0x82,0x0e,0x82,0x07,0x83,0x04,
-0x82,0x0d,0x82,0x0b,0x82,0x0d,0x82,0x08,0x82,0x08,0x82,0x11,0x82,0x06,0x82,
-0x02,0x82,0x09,0x82,0x0a,0x82,0x01,0x82,0x04,0x82,0x01,0x82,0x03,0x82,0x02,
-0x82,0x04,0x82,0x02,0x82,0x09,0x82,0x03,0x82,0x07,0x82,0x03,0x82,0x09,0x82,
-0x03,0x82,0x06,0x82,0x06,0x83,0x0f,0x83,0x08,0x82,0x07,0x82,0x05,0x82,0x04,
-0x82,0x05,0x81,0x02,0x82,0x01,0x82,0x02,0x82,0x07,0x84,0x0a,0x82,0x02,0x82,
-0x0c,0x83,0x0c,0x82,0x0c,0x82,0x0d,0x82,0x0a,0x82,0x03,0x82,0x26,0x82,0x04,
-0x82,0x06,0x83,0x03,0x83,0x07,0x82,0x05,0x82,0x06,0x82,0x04,0x83,0x06,0x82,
-0x04,0x82,0x0a,0x82,0x0a,0x83,0x03,0x83,0x06,0x82,0x04,0x83,0x09,0x82,0x0e,
-0x82,0x0a,0x82,0x03,0x82,0x0a,0x82,0x07,0x82,0x03,0x84,0x02,0x82,0x04,0x82,
-0x04,0x83,0x07,0x82,0x04,0x83,0x06,0x82,0x04,0x83,0x06,0x82,0x04,0x83,0x08,
-0x83,0x0a,0x82,0x04,0x82,0x08,0x82,0x0b,0x82,0x06,0x82,0x05,0x82,0x05,0x82,
-0x04,0x82,0x03,0x83,0x03,0x82,0x06,0x82,0x03,0x82,0x06,0x82,0x05,0x82,0x0d,
-0x82,0x0a,0x82,0x0d,0x82,0x0d,0x83,0x38,0x82,0x1b,0x82,0x02,0x82,0x09,0x85,
-0x0e,0x81,0x0b,0x83,0x1b,0x82,0x0f,0x82,0x09,0x87,0x0b,0x82,0x3b,0x82,0x08,
-0x82,0x06,0x82,0x09,0x83,0x0e,0x83,0x09,0x85,0x09,0x82,0x02,0x83,0x07,0x88,
-0x06,0x89,0x0b,0x82,0x0a,0x86,0x07,0x82,0x06,0x82,0x27,0x85,0x17,0x84,0x0f,
-0x82,0x05,0x82,0x03,0x81,0x03,0x82,0x02,0x81,0x06,0x82,0x02,0x82,0x06,0x88,
-0x06,0x82,0x0e,0x82,0x07,0x83,0x04,0x88,0x07,0x88,0x05,0x82,0x0d,0x8c,0x08,
-0x82,0x11,0x82,0x06,0x85,0x0a,0x82,0x0a,0x82,0x01,0x82,0x04,0x82,0x01,0x82,
-0x03,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x09,0x82,0x03,0x82,0x06,0x82,0x04,
-0x82,0x09,0x82,0x03,0x82,0x04,0x83,0x08,0x85,0x0c,0x83,0x08,0x82,0x07,0x82,
-0x05,0x82,0x04,0x82,0x05,0x82,0x01,0x82,0x01,0x82,0x02,0x81,0x08,0x84,0x0a,
-0x86,0x0c,0x82,0x0d,0x82,0x0c,0x82,0x0d,0x82,0x0a,0x82,0x03,0x82,0x26,0x82,
-0x04,0x83,0x05,0x82,0x05,0x82,0x06,0x83,0x05,0x82,0x05,0x83,0x05,0x82,0x05,
-0x83,0x04,0x82,0x0a,0x82,0x0a,0x82,0x05,0x82,0x06,0x82,0x05,0x82,0x09,0x82,
-0x0e,0x82,0x0a,0x82,0x02,0x82,0x0b,0x82,0x07,0x82,0x03,0x83,0x03,0x83,0x03,
-0x82,0x05,0x82,0x06,0x83,0x05,0x82,0x06,0x82,0x05,0x82,0x05,0x83,0x05,0x82,
-0x08,0x82,0x0b,0x82,0x04,0x82,0x08,0x82,0x0b,0x82,0x06,0x82,0x06,0x82,0x04,
-0x82,0x04,0x82,0x02,0x84,0x03,0x82,0x07,0x82,0x01,0x82,0x07,0x83,0x03,0x83,
-0x0c,0x83,0x0a,0x82,0x0d,0x82,0x0e,0x82,0x0a,0x82,0x2c,0x82,0x1b,0x82,0x02,
-0x82,0x0b,0x85,0x0b,0x82,0x09,0x85,0x1b,0x82,0x0f,0x82,0x0b,0x83,0x09,0x8b,
-0x36,0x81,0x09,0x82,0x06,0x82,0x09,0x83,0x0e,0x82,0x0a,0x86,0x07,0x82,0x03,
-0x83,0x07,0x82,0x04,0x83,0x05,0x84,0x03,0x83,0x09,0x82,0x0b,0x87,0x07,0x82,
-0x04,0x83,0x25,0x85,0x1b,0x85,0x0b,0x82,0x06,0x82,0x02,0x82,0x03,0x82,0x02,
-0x81,0x05,0x82,0x04,0x82,0x05,0x8a,0x04,0x82,0x0e,0x82,0x07,0x83,0x04,0x88,
-0x07,0x88,0x05,0x82,0x04,0x86,0x03,0x8c,0x08,0x82,0x11,0x82,0x06,0x86,0x09,
-0x82,0x0a,0x82,0x02,0x82,0x02,0x82,0x02,0x82,0x03,0x82,0x03,0x82,0x03,0x82,
-0x02,0x82,0x09,0x82,0x03,0x8a,0x04,0x82,0x09,0x82,0x03,0x89,0x0a,0x85,0x0a,
-0x83,0x08,0x82,0x07,0x82,0x05,0x82,0x04,0x82,0x05,0x82,0x01,0x82,0x02,0x81,
-0x01,0x82,0x09,0x82,0x0c,0x84,0x0c,0x82,0x0e,0x82,0x0d,0x82,0x0c,0x82,0x3d,
-0x83,0x05,0x82,0x05,0x82,0x06,0x82,0x0d,0x82,0x06,0x82,0x05,0x82,0x06,0x82,
-0x09,0x82,0x09,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x09,0x82,0x0e,0x82,0x0a,
-0x82,0x01,0x83,0x0b,0x82,0x07,0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x05,0x82,
-0x06,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x05,0x82,0x06,0x82,0x08,0x82,0x0b,
-0x82,0x0e,0x82,0x0b,0x82,0x06,0x82,0x06,0x82,0x03,0x82,0x06,0x82,0x01,0x82,
-0x01,0x81,0x03,0x82,0x07,0x82,0x01,0x82,0x08,0x82,0x03,0x82,0x0c,0x83,0x09,
-0x83,0x0e,0x82,0x0e,0x83,0x07,0x86,0x04,0x82,0x24,0x82,0x1b,0x81,0x03,0x82,
-0x0d,0x84,0x0a,0x81,0x02,0x84,0x03,0x83,0x01,0x83,0x03,0x82,0x15,0x82,0x0f,
-0x82,0x0b,0x84,0x08,0x8b,0x15,0x86,0x1a,0x82,0x09,0x82,0x06,0x82,0x09,0x83,
-0x0d,0x82,0x0f,0x83,0x06,0x82,0x03,0x83,0x0e,0x82,0x05,0x83,0x05,0x82,0x09,
-0x82,0x0a,0x82,0x04,0x83,0x06,0x89,0x24,0x83,0x21,0x84,0x08,0x82,0x07,0x81,
-0x03,0x82,0x03,0x81,0x03,0x81,0x05,0x82,0x04,0x82,0x05,0x82,0x06,0x83,0x03,
-0x82,0x0e,0x82,0x07,0x83,0x04,0x82,0x0d,0x82,0x0b,0x82,0x04,0x86,0x03,0x82,
-0x08,0x82,0x08,0x82,0x11,0x82,0x06,0x82,0x02,0x82,0x09,0x82,0x0a,0x82,0x02,
-0x82,0x02,0x82,0x02,0x82,0x03,0x82,0x03,0x83,0x02,0x82,0x02,0x82,0x09,0x82,
-0x03,0x88,0x06,0x82,0x09,0x82,0x03,0x82,0x05,0x83,0x0c,0x84,0x08,0x83,0x08,
-0x82,0x07,0x82,0x06,0x82,0x02,0x82,0x06,0x82,0x01,0x81,0x03,0x84,0x08,0x84,
-0x0b,0x83,0x0c,0x83,0x0e,0x82,0x0d,0x82,0x0c,0x82,0x39,0x87,0x05,0x82,0x05,
-0x82,0x06,0x82,0x0d,0x82,0x06,0x82,0x05,0x8a,0x09,0x82,0x09,0x82,0x06,0x82,
-0x06,0x82,0x05,0x82,0x09,0x82,0x0e,0x82,0x0a,0x85,0x0c,0x82,0x07,0x82,0x04,
-0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x06,0x82,0x06,0x82,0x06,0x82,0x05,0x82,
-0x05,0x82,0x06,0x82,0x08,0x82,0x0b,0x85,0x0b,0x82,0x0b,0x82,0x06,0x82,0x06,
-0x82,0x03,0x82,0x06,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x08,0x83,0x09,0x82,
-0x03,0x82,0x0c,0x82,0x0a,0x82,0x0f,0x82,0x0f,0x83,0x06,0x82,0x02,0x83,0x02,
-0x82,0x25,0x82,0x18,0x8b,0x0d,0x82,0x09,0x82,0x01,0x82,0x02,0x82,0x02,0x82,
-0x03,0x83,0x02,0x82,0x15,0x82,0x0f,0x82,0x0a,0x82,0x01,0x82,0x0c,0x82,0x3a,
-0x82,0x09,0x82,0x06,0x82,0x09,0x83,0x0c,0x82,0x11,0x82,0x05,0x82,0x04,0x83,
-0x0e,0x82,0x05,0x83,0x05,0x82,0x09,0x82,0x09,0x82,0x06,0x82,0x08,0x83,0x02,
-0x82,0x24,0x83,0x0c,0x89,0x0d,0x83,0x08,0x82,0x07,0x81,0x03,0x82,0x03,0x81,
-0x03,0x81,0x04,0x89,0x05,0x82,0x07,0x82,0x03,0x82,0x0e,0x82,0x07,0x82,0x05,
-0x82,0x0d,0x82,0x0b,0x82,0x08,0x82,0x03,0x82,0x08,0x82,0x08,0x82,0x11,0x82,
-0x06,0x82,0x03,0x82,0x08,0x82,0x0a,0x82,0x03,0x81,0x02,0x81,0x03,0x82,0x03,
-0x82,0x04,0x82,0x02,0x82,0x02,0x82,0x09,0x82,0x03,0x82,0x0c,0x82,0x09,0x82,
-0x03,0x82,0x06,0x82,0x0e,0x82,0x08,0x83,0x08,0x82,0x07,0x82,0x06,0x82,0x02,
-0x82,0x06,0x84,0x03,0x84,0x07,0x86,0x0b,0x82,0x0c,0x82,0x0f,0x82,0x0d,0x82,
-0x0c,0x82,0x37,0x89,0x05,0x82,0x05,0x82,0x06,0x82,0x0d,0x82,0x06,0x82,0x05,
-0x8a,0x09,0x82,0x09,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x09,0x82,0x0e,0x82,
-0x0a,0x85,0x0c,0x82,0x07,0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x06,
-0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x05,0x82,0x06,0x82,0x08,0x82,0x0d,0x85,
-0x09,0x82,0x0b,0x82,0x06,0x82,0x07,0x82,0x02,0x81,0x07,0x82,0x01,0x81,0x02,
-0x82,0x01,0x82,0x09,0x83,0x0a,0x82,0x01,0x83,0x0b,0x82,0x0c,0x82,0x0e,0x82,
-0x0e,0x82,0x07,0x82,0x04,0x86,0x3f,0x8b,0x05,0x82,0x06,0x82,0x08,0x82,0x02,
-0x81,0x04,0x81,0x02,0x82,0x04,0x85,0x16,0x82,0x0f,0x82,0x0e,0x81,0x0c,0x82,
-0x39,0x82,0x0a,0x82,0x06,0x82,0x09,0x83,0x0b,0x83,0x11,0x82,0x05,0x8b,0x0c,
-0x82,0x06,0x82,0x05,0x82,0x08,0x83,0x09,0x82,0x06,0x82,0x0d,0x82,0x25,0x85,
-0x09,0x89,0x0a,0x85,0x09,0x82,0x07,0x81,0x03,0x82,0x03,0x81,0x02,0x82,0x04,
-0x8a,0x04,0x82,0x07,0x82,0x03,0x83,0x07,0x82,0x04,0x82,0x07,0x82,0x05,0x82,
-0x0d,0x82,0x0b,0x83,0x07,0x82,0x03,0x82,0x08,0x82,0x08,0x82,0x11,0x82,0x06,
-0x82,0x03,0x83,0x07,0x82,0x0a,0x82,0x03,0x84,0x03,0x82,0x03,0x82,0x05,0x82,
-0x01,0x82,0x02,0x83,0x07,0x83,0x03,0x82,0x0c,0x83,0x07,0x83,0x03,0x82,0x06,
-0x83,0x04,0x82,0x07,0x82,0x08,0x83,0x08,0x82,0x07,0x82,0x06,0x82,0x01,0x83,
-0x07,0x83,0x03,0x84,0x07,0x82,0x02,0x82,0x0b,0x82,0x0b,0x82,0x10,0x82,0x0e,
-0x82,0x0b,0x82,0x36,0x83,0x04,0x83,0x05,0x82,0x05,0x82,0x06,0x82,0x0d,0x82,
-0x06,0x82,0x05,0x82,0x11,0x82,0x09,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x09,
-0x82,0x0e,0x82,0x0a,0x82,0x02,0x82,0x0b,0x82,0x07,0x82,0x04,0x82,0x04,0x82,
-0x03,0x82,0x05,0x82,0x06,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x05,0x82,0x06,
-0x82,0x08,0x82,0x10,0x83,0x08,0x82,0x0b,0x82,0x06,0x82,0x07,0x82,0x01,0x82,
-0x08,0x83,0x03,0x81,0x01,0x82,0x08,0x85,0x09,0x82,0x01,0x82,0x0b,0x83,0x0d,
-0x82,0x0d,0x82,0x0e,0x82,0x0f,0x82,0x43,0x82,0x02,0x82,0x08,0x83,0x05,0x82,
-0x08,0x81,0x03,0x81,0x04,0x81,0x02,0x82,0x05,0x84,0x16,0x82,0x0f,0x82,0x1b,
-0x82,0x39,0x82,0x0a,0x83,0x05,0x82,0x09,0x83,0x0a,0x83,0x0a,0x82,0x06,0x82,
-0x0b,0x83,0x07,0x82,0x05,0x82,0x06,0x82,0x05,0x82,0x08,0x82,0x0a,0x82,0x06,
-0x82,0x0c,0x83,0x27,0x85,0x18,0x84,0x15,0x82,0x02,0x82,0x02,0x82,0x02,0x81,
-0x05,0x82,0x06,0x82,0x04,0x82,0x07,0x82,0x04,0x82,0x07,0x82,0x04,0x82,0x06,
-0x83,0x05,0x82,0x0d,0x82,0x0c,0x82,0x07,0x82,0x03,0x82,0x08,0x82,0x08,0x82,
-0x0a,0x82,0x05,0x82,0x06,0x82,0x04,0x83,0x06,0x82,0x0a,0x82,0x03,0x84,0x03,
-0x82,0x03,0x82,0x05,0x85,0x03,0x82,0x07,0x82,0x04,0x82,0x0d,0x82,0x05,0x81,
-0x01,0x82,0x04,0x82,0x06,0x83,0x04,0x83,0x06,0x82,0x08,0x83,0x08,0x82,0x07,
-0x82,0x07,0x84,0x08,0x83,0x04,0x82,0x07,0x82,0x04,0x82,0x0a,0x82,0x0a,0x83,
-0x10,0x82,0x0e,0x82,0x0b,0x82,0x36,0x82,0x05,0x83,0x05,0x82,0x05,0x82,0x06,
-0x83,0x05,0x82,0x05,0x82,0x06,0x82,0x05,0x83,0x10,0x82,0x09,0x83,0x05,0x82,
-0x06,0x82,0x05,0x82,0x09,0x82,0x0e,0x82,0x0a,0x82,0x02,0x83,0x0a,0x82,0x07,
-0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x06,0x83,0x05,0x82,0x06,0x82,
-0x05,0x82,0x05,0x82,0x06,0x82,0x08,0x82,0x0a,0x82,0x05,0x82,0x08,0x82,0x0b,
-0x82,0x06,0x82,0x08,0x81,0x01,0x82,0x08,0x83,0x03,0x84,0x08,0x82,0x01,0x82,
-0x09,0x82,0x01,0x82,0x0b,0x82,0x0e,0x82,0x0d,0x82,0x0d,0x83,0x54,0x82,0x02,
-0x82,0x09,0x82,0x04,0x83,0x07,0x82,0x03,0x81,0x04,0x81,0x02,0x82,0x06,0x82,
-0x18,0x82,0x0d,0x82,0x1c,0x82,0x39,0x81,0x0c,0x82,0x04,0x83,0x09,0x83,0x09,
-0x83,0x0c,0x82,0x05,0x82,0x0b,0x83,0x07,0x82,0x04,0x83,0x06,0x83,0x04,0x82,
-0x08,0x82,0x0a,0x83,0x05,0x82,0x0c,0x82,0x2b,0x83,0x15,0x84,0x18,0x81,0x03,
-0x83,0x01,0x83,0x05,0x82,0x07,0x83,0x03,0x82,0x06,0x83,0x04,0x83,0x05,0x82,
-0x05,0x82,0x06,0x82,0x06,0x82,0x0d,0x82,0x0c,0x83,0x06,0x82,0x03,0x82,0x08,
-0x82,0x08,0x82,0x0a,0x82,0x05,0x82,0x06,0x82,0x05,0x83,0x05,0x82,0x0a,0x82,
-0x04,0x82,0x04,0x82,0x03,0x82,0x06,0x84,0x03,0x83,0x05,0x83,0x04,0x82,0x0d,
-0x83,0x05,0x83,0x04,0x82,0x06,0x83,0x05,0x82,0x06,0x82,0x08,0x83,0x08,0x83,
-0x05,0x83,0x07,0x84,0x08,0x82,0x05,0x82,0x06,0x83,0x04,0x83,0x09,0x82,0x0a,
-0x82,0x11,0x82,0x0e,0x82,0x0b,0x82,0x36,0x82,0x05,0x83,0x05,0x83,0x04,0x82,
-0x07,0x82,0x05,0x82,0x06,0x82,0x04,0x83,0x06,0x82,0x10,0x82,0x0a,0x82,0x04,
-0x83,0x06,0x82,0x05,0x82,0x09,0x82,0x0e,0x82,0x0a,0x82,0x03,0x82,0x0a,0x82,
-0x07,0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x07,0x82,0x04,0x83,0x06,
-0x82,0x05,0x82,0x06,0x82,0x04,0x83,0x08,0x82,0x0a,0x83,0x04,0x82,0x08,0x82,
-0x03,0x82,0x06,0x83,0x04,0x83,0x08,0x83,0x09,0x82,0x04,0x83,0x08,0x82,0x03,
-0x82,0x09,0x83,0x0b,0x82,0x0f,0x82,0x0d,0x82,0x0d,0x83,0x38,0x82,0x1a,0x81,
-0x03,0x82,0x09,0x88,0x08,0x81,0x04,0x82,0x02,0x82,0x03,0x83,0x02,0x85,0x17,
-0x82,0x0d,0x82,0x29,0x82,0x1d,0x82,0x0c,0x82,0x0c,0x83,0x02,0x83,0x0a,0x83,
-0x09,0x89,0x06,0x84,0x01,0x83,0x0c,0x83,0x07,0x84,0x01,0x83,0x08,0x83,0x01,
-0x83,0x09,0x82,0x0b,0x84,0x01,0x83,0x07,0x82,0x02,0x84,0x09,0x82,0x0d,0x82,
-0x13,0x81,0x15,0x82,0x10,0x82,0x08,0x81,0x0f,0x82,0x08,0x82,0x03,0x8a,0x06,
-0x83,0x02,0x84,0x05,0x89,0x07,0x89,0x06,0x82,0x0d,0x84,0x02,0x84,0x03,0x82,
-0x08,0x82,0x06,0x86,0x09,0x83,0x01,0x83,0x07,0x82,0x06,0x83,0x04,0x8a,0x02,
-0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x07,0x83,0x04,0x89,0x05,0x82,0x0e,0x8a,
-0x04,0x82,0x07,0x82,0x05,0x84,0x02,0x83,0x09,0x83,0x09,0x84,0x01,0x84,0x08,
-0x83,0x09,0x82,0x05,0x82,0x06,0x82,0x06,0x82,0x09,0x82,0x09,0x8b,0x09,0x82,
-0x0f,0x82,0x0a,0x82,0x37,0x89,0x05,0x88,0x08,0x88,0x07,0x89,0x06,0x84,0x02,
-0x82,0x0a,0x82,0x0a,0x89,0x06,0x82,0x05,0x82,0x06,0x88,0x0b,0x82,0x0a,0x82,
-0x04,0x82,0x06,0x88,0x04,0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x07,
-0x84,0x01,0x83,0x07,0x84,0x01,0x83,0x07,0x83,0x02,0x84,0x08,0x82,0x0b,0x83,
-0x02,0x83,0x08,0x87,0x06,0x8a,0x08,0x83,0x09,0x82,0x05,0x82,0x07,0x83,0x03,
-0x83,0x08,0x83,0x0a,0x89,0x09,0x82,0x0d,0x82,0x0d,0x83,0x38,0x82,0x1a,0x81,
-0x03,0x82,0x0a,0x86,0x0f,0x84,0x05,0x86,0x01,0x83,0x16,0x82,0x0d,0x82,0x29,
-0x82,0x1d,0x82,0x0c,0x82,0x0d,0x86,0x0b,0x83,0x09,0x89,0x07,0x86,0x0d,0x83,
-0x08,0x86,0x0a,0x85,0x0a,0x82,0x0c,0x86,0x08,0x86,0x0b,0x82,0x0d,0x82,0x3b,
-0x82,0x09,0x81,0x0e,0x82,0x08,0x82,0x03,0x89,0x08,0x86,0x07,0x88,0x08,0x89,
-0x06,0x82,0x0e,0x87,0x05,0x82,0x08,0x82,0x06,0x86,0x0a,0x85,0x08,0x82,0x07,
-0x82,0x04,0x8a,0x02,0x82,0x0a,0x82,0x03,0x82,0x07,0x83,0x05,0x86,0x07,0x82,
-0x0f,0x86,0x01,0x83,0x03,0x82,0x07,0x82,0x07,0x86,0x0a,0x83,0x0a,0x87,0x0a,
-0x82,0x09,0x82,0x06,0x81,0x05,0x83,0x06,0x83,0x08,0x82,0x09,0x8b,0x09,0x82,
-0x0f,0x82,0x0a,0x82,0x37,0x85,0x02,0x82,0x05,0x81,0x01,0x85,0x0b,0x85,0x09,
-0x85,0x01,0x82,0x08,0x86,0x0a,0x82,0x0b,0x85,0x01,0x82,0x06,0x82,0x05,0x82,
-0x06,0x88,0x0b,0x82,0x0a,0x82,0x04,0x83,0x05,0x88,0x04,0x82,0x04,0x82,0x04,
-0x82,0x03,0x82,0x05,0x82,0x09,0x85,0x08,0x87,0x09,0x85,0x01,0x82,0x08,0x82,
-0x0c,0x86,0x0a,0x84,0x09,0x86,0x01,0x82,0x09,0x82,0x0a,0x81,0x05,0x82,0x07,
-0x82,0x05,0x82,0x08,0x83,0x0a,0x89,0x09,0x82,0x0d,0x82,0x0d,0x82,0x68,0x81,
-0x3b,0x82,0x0b,0x82,0x2a,0x82,0x2a,0x82,0x7f,0x35,0x82,0x46,0x83,0x7f,0x7f,
-0x08,0x82,0x7f,0x10,0x82,0x10,0x82,0x09,0x82,0x18,0x8a,0x76,0x82,0x28,0x82,
-0x54,0x82,0x14,0x82,0x71,0x82,0x1d,0x82,0x0d,0x82,0x0d,0x82,0x68,0x81,0x3b,
-0x82,0x0b,0x82,0x2a,0x82,0x2a,0x82,0x7f,0x35,0x82,0x48,0x86,0x7f,0x7f,0x7f,
-0x15,0x84,0x0e,0x82,0x07,0x84,0x18,0x8a,0x76,0x82,0x28,0x82,0x54,0x82,0x14,
-0x82,0x71,0x82,0x1d,0x83,0x0c,0x82,0x0d,0x82,0x7f,0x26,0x82,0x09,0x82,0x2b,
-0x81,0x7f,0x62,0x81,0x7f,0x7f,0x7f,0x64,0x84,0x17,0x84,0x7f,0x12,0x82,0x04,
-0x82,0x28,0x83,0x54,0x82,0x14,0x82,0x70,0x83,0x1e,0x83,0x0b,0x82,0x0c,0x82,
-0x7f,0x28,0x82,0x07,0x82,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x27,0x88,0x26,
-0x84,0x55,0x82,0x14,0x82,0x6e,0x84,0x21,0x81,0x0b,0x82,0x0c,0x81,0x7f,0x2a,
-0x81,0x07,0x81,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x2a,0x84,0x28,0x83,0x7f,
-0x5d,0x83,0x64,
-0x00,
+  .stride = 180,
+  .bits = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x60,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x01,0x80,0x01,0xe0,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x38,0x00,0x00,
+0x18,0x00,0x06,0x00,0x06,0x00,0x60,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x30,0x01,0x80,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x33,0x00,0x31,0x00,0x3c,0x03,0x80,0x01,0xe0,0x03,0x00,
+0x00,0xc0,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,
+0x07,0x80,0x0f,0x00,0x1e,0x00,0x3c,0x00,0x0e,0x01,0xfe,0x00,0xf0,0x1f,0xf8,
+0x07,0x80,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,
+0x00,0x00,0x03,0x00,0xfe,0x00,0x3e,0x03,0xf8,0x03,0xfe,0x07,0xfe,0x03,0xe0,
+0x60,0x18,0x1f,0x80,0x00,0xc0,0xc0,0x61,0x80,0x1c,0x01,0x8c,0x03,0x03,0xe0,
+0x3f,0x80,0x0f,0x80,0xfe,0x00,0x1e,0x07,0xff,0xc6,0x03,0x38,0x07,0x60,0x06,
+0x60,0x18,0xc0,0x30,0xff,0xe0,0x0c,0x01,0x80,0x00,0x60,0x00,0x80,0x00,0x00,
+0x03,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x78,0x00,0x00,
+0x18,0x00,0x06,0x00,0x06,0x00,0x60,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x30,0x00,0xc0,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x33,0x00,0x31,0x00,0xfe,0x06,0xc0,0x03,0xf0,0x03,0x00,
+0x01,0x80,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
+0x0f,0xe0,0x3f,0x00,0x3f,0x80,0x7f,0x00,0x0e,0x01,0xfe,0x03,0xf8,0x1f,0xf8,
+0x0f,0xe0,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,
+0x0f,0xc0,0x03,0x00,0xff,0x80,0xff,0x03,0xfe,0x03,0xfe,0x07,0xfe,0x0f,0xf0,
+0x60,0x18,0x1f,0x80,0x00,0xc0,0xc0,0xc1,0x80,0x1c,0x03,0x8e,0x03,0x0f,0xf0,
+0x3f,0xe0,0x3f,0xc0,0xff,0x80,0x7f,0x87,0xff,0xc6,0x03,0x18,0x06,0x61,0x06,
+0x30,0x30,0xc0,0x70,0xff,0xe0,0x0c,0x00,0xc0,0x00,0x60,0x01,0xc0,0x00,0x00,
+0x01,0x80,0x00,0x00,0xc0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xe0,0x00,0x00,
+0x18,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x30,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x33,0x00,0x33,0x01,0xc7,0x0c,0x42,0x07,0x18,0x03,0x00,
+0x01,0x80,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
+0x18,0x60,0x07,0x00,0x61,0xc0,0xc3,0x80,0x1e,0x01,0x80,0x03,0x00,0x00,0x18,
+0x18,0x70,0x30,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x30,
+0x18,0x30,0x07,0x80,0xc1,0xc0,0xc1,0x83,0x07,0x03,0x00,0x06,0x00,0x0c,0x18,
+0x60,0x18,0x06,0x00,0x00,0xc0,0xc1,0x81,0x80,0x1c,0x03,0x8e,0x03,0x0c,0x18,
+0x30,0x30,0x30,0x60,0xc1,0xc0,0xe1,0xc0,0x38,0x06,0x03,0x18,0x06,0x63,0x86,
+0x38,0x70,0x60,0x60,0x00,0xc0,0x0c,0x00,0xc0,0x00,0x60,0x01,0xc0,0x00,0x00,
+0x00,0x80,0x00,0x00,0xc0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xc0,0x00,0x00,
+0x18,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x33,0x00,0x33,0x01,0x83,0x0c,0x66,0x06,0x18,0x03,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,
+0x18,0x30,0x07,0x00,0x60,0xc1,0xc1,0x80,0x3e,0x03,0x00,0x06,0x00,0x00,0x30,
+0x18,0x30,0x60,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x30,
+0x30,0x18,0x07,0x80,0xc0,0xc1,0x80,0xc3,0x03,0x83,0x00,0x06,0x00,0x18,0x0c,
+0x60,0x18,0x06,0x00,0x00,0xc0,0xc3,0x81,0x80,0x1e,0x07,0x8f,0x03,0x18,0x0c,
+0x30,0x18,0x60,0x30,0xc0,0xc0,0xc0,0xc0,0x38,0x06,0x03,0x1c,0x0e,0x63,0x8c,
+0x18,0x60,0x60,0xe0,0x01,0xc0,0x0c,0x00,0x60,0x00,0x60,0x01,0x60,0x00,0x00,
+0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xc0,0x00,0x00,
+0x18,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x30,0x00,0x70,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x32,0x00,0x23,0x01,0x83,0x0c,0x64,0x06,0x18,0x03,0x00,
+0x03,0x00,0x06,0x00,0x0c,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,
+0x30,0x30,0x07,0x00,0xe0,0xc0,0x01,0x80,0x3e,0x03,0x00,0x06,0x00,0x00,0x70,
+0x18,0x30,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,
+0x60,0x08,0x07,0x80,0xc0,0xc1,0x80,0xc3,0x01,0x83,0x00,0x06,0x00,0x18,0x0c,
+0x60,0x18,0x06,0x00,0x00,0xc0,0xc7,0x01,0x80,0x1e,0x07,0x8f,0x83,0x18,0x0c,
+0x30,0x18,0x60,0x30,0xc0,0xe0,0xc0,0xc0,0x38,0x06,0x03,0x0c,0x0c,0x63,0x8c,
+0x1c,0xe0,0x30,0xc0,0x01,0x80,0x0c,0x00,0x60,0x00,0x60,0x03,0x60,0x00,0x00,
+0x00,0x00,0x0f,0x00,0xde,0x00,0x7e,0x00,0x73,0x00,0xf0,0x03,0xf0,0x03,0x98,
+0x1b,0xc0,0x1e,0x00,0x06,0x00,0x61,0xc0,0x30,0x13,0x8e,0x09,0xe0,0x03,0xc0,
+0x13,0xc0,0x0e,0x60,0x13,0xc0,0x3c,0x03,0xfc,0x06,0x06,0x0c,0x0c,0x63,0x06,
+0x18,0x30,0xe0,0xe0,0x7f,0xc0,0x18,0x00,0x30,0x00,0x70,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x32,0x01,0xff,0xc1,0x80,0x0c,0x4c,0x07,0x30,0x02,0x00,
+0x03,0x00,0x06,0x00,0x0c,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,
+0x30,0x30,0x07,0x00,0x00,0xc0,0x01,0x80,0x6e,0x03,0x00,0x06,0x00,0x00,0x60,
+0x18,0x30,0x60,0x60,0x18,0x00,0x30,0x00,0x01,0x03,0xfe,0x04,0x00,0x00,0x30,
+0x43,0xcc,0x0c,0xc0,0xc0,0xc3,0x00,0x03,0x01,0x83,0x00,0x06,0x00,0x30,0x00,
+0x60,0x18,0x06,0x00,0x00,0xc0,0xc6,0x01,0x80,0x1b,0x07,0x8d,0x83,0x30,0x06,
+0x30,0x18,0xc0,0x18,0xc0,0xe0,0xc0,0x00,0x38,0x06,0x03,0x0c,0x0c,0x62,0xcc,
+0x0c,0xc0,0x31,0xc0,0x03,0x00,0x0c,0x00,0x60,0x00,0x60,0x03,0x20,0x00,0x00,
+0x00,0x00,0x1f,0xc0,0xff,0x00,0xff,0x00,0xff,0x01,0xf8,0x03,0xf0,0x07,0xf8,
+0x1f,0xe0,0x1e,0x00,0x06,0x00,0x63,0x80,0x30,0x1f,0xdf,0x0f,0xf0,0x07,0xf0,
+0x17,0xe0,0x1f,0xe0,0x1f,0xc0,0xfe,0x03,0xfc,0x06,0x06,0x0c,0x18,0x63,0x06,
+0x1c,0x70,0x60,0xc0,0x7f,0xc0,0x18,0x00,0x30,0x00,0x70,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x00,0x62,0x01,0xc0,0x07,0xd8,0x03,0xe0,0x00,0x00,
+0x07,0x00,0x07,0x00,0x4d,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,
+0x30,0x30,0x07,0x00,0x01,0x80,0x03,0x00,0x6e,0x03,0xf8,0x0e,0xf0,0x00,0xc0,
+0x1c,0x60,0x60,0x60,0x18,0x00,0x30,0x00,0x07,0x03,0xfe,0x07,0x00,0x00,0x30,
+0x46,0x64,0x0c,0xc0,0xc1,0x83,0x00,0x03,0x01,0xc3,0x00,0x06,0x00,0x30,0x00,
+0x60,0x18,0x06,0x00,0x00,0xc0,0xcc,0x01,0x80,0x1b,0x0d,0x8c,0xc3,0x30,0x06,
+0x30,0x18,0xc0,0x18,0xc0,0xc0,0xe0,0x00,0x38,0x06,0x03,0x06,0x18,0x26,0xcc,
+0x07,0x80,0x19,0x80,0x07,0x00,0x0c,0x00,0x30,0x00,0x60,0x06,0x30,0x00,0x00,
+0x00,0x00,0x30,0xc0,0xe3,0x80,0xc1,0x81,0x87,0x03,0x0c,0x00,0xc0,0x0e,0x38,
+0x18,0x70,0x06,0x00,0x06,0x00,0x63,0x00,0x30,0x18,0xf3,0x0c,0x38,0x0c,0x38,
+0x18,0x70,0x30,0xe0,0x1c,0x00,0xc3,0x00,0xc0,0x06,0x06,0x0c,0x18,0x63,0x8c,
+0x0c,0x60,0x60,0xc0,0x01,0x80,0x18,0x00,0x30,0x00,0x70,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x00,0x66,0x00,0xf8,0x00,0x10,0x01,0xc0,0x00,0x00,
+0x06,0x00,0x03,0x00,0x7f,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,
+0x30,0x30,0x07,0x00,0x03,0x80,0x3e,0x00,0xce,0x03,0xfc,0x0f,0xf8,0x00,0xc0,
+0x0f,0xc0,0x60,0x60,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x03,0xc0,0x00,0x60,
+0xc4,0x64,0x0c,0xc0,0xff,0x03,0x00,0x03,0x01,0xc3,0xfc,0x07,0xf8,0x30,0x00,
+0x7f,0xf8,0x06,0x00,0x00,0xc0,0xf8,0x01,0x80,0x1b,0x0d,0x8c,0xc3,0x30,0x06,
+0x30,0x30,0xc0,0x18,0xc3,0x80,0x7c,0x00,0x38,0x06,0x03,0x06,0x18,0x36,0xc8,
+0x07,0x80,0x1f,0x80,0x06,0x00,0x0c,0x00,0x30,0x00,0x60,0x06,0x30,0x00,0x00,
+0x00,0x00,0x30,0xe0,0xc1,0x81,0xc1,0x83,0x83,0x07,0x0c,0x00,0xc0,0x0c,0x18,
+0x18,0x30,0x06,0x00,0x06,0x00,0x66,0x00,0x30,0x18,0xe3,0x8c,0x18,0x1c,0x18,
+0x18,0x30,0x70,0x60,0x18,0x00,0xc3,0x00,0xc0,0x06,0x06,0x06,0x18,0x67,0x8c,
+0x06,0xc0,0x71,0xc0,0x03,0x80,0x18,0x00,0x30,0x00,0x30,0x03,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x00,0x66,0x00,0x3e,0x00,0x30,0x07,0xc0,0x00,0x00,
+0x06,0x00,0x03,0x00,0x1c,0x01,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x80,
+0x30,0x30,0x07,0x00,0x03,0x00,0x3f,0x01,0x8e,0x03,0x0e,0x0f,0x1c,0x01,0x80,
+0x0f,0xe0,0x30,0xe0,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0xf8,0x00,0xc0,
+0xcc,0x64,0x18,0x60,0xff,0xc3,0x00,0x03,0x01,0xc3,0xfc,0x07,0xf8,0x30,0xfc,
+0x7f,0xf8,0x06,0x00,0x00,0xc0,0xfc,0x01,0x80,0x19,0x99,0x8c,0x63,0x30,0x06,
+0x3f,0xf0,0xc0,0x18,0xff,0x80,0x1f,0x00,0x38,0x06,0x03,0x06,0x18,0x36,0x58,
+0x03,0x00,0x0f,0x00,0x0c,0x00,0x0c,0x00,0x18,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0xe0,0xc1,0x81,0x80,0x03,0x03,0x06,0x06,0x00,0xc0,0x18,0x18,
+0x18,0x30,0x06,0x00,0x06,0x00,0x6e,0x00,0x30,0x18,0x61,0x8c,0x18,0x18,0x18,
+0x18,0x30,0x60,0x60,0x18,0x00,0xc0,0x00,0xc0,0x06,0x06,0x06,0x30,0x36,0x8c,
+0x06,0xc0,0x31,0x80,0x07,0x00,0x70,0x00,0x30,0x00,0x38,0x0f,0xc3,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x00,0x46,0x00,0x0f,0x00,0x27,0x8e,0xe3,0x00,0x00,
+0x06,0x00,0x03,0x00,0x1e,0x01,0xff,0xc0,0x00,0x01,0xf8,0x00,0x00,0x01,0x80,
+0x30,0x30,0x07,0x00,0x06,0x00,0x03,0x81,0x8e,0x00,0x06,0x0e,0x0c,0x01,0x80,
+0x18,0x70,0x3f,0xe0,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x1e,0x01,0x80,
+0x8c,0x44,0x18,0x60,0xc0,0xe3,0x00,0x03,0x01,0xc3,0x00,0x06,0x00,0x30,0xfc,
+0x60,0x18,0x06,0x00,0x00,0xc0,0xcc,0x01,0x80,0x19,0x99,0x8c,0x73,0x30,0x06,
+0x3f,0xc0,0xc0,0x18,0xc1,0xc0,0x03,0xc0,0x38,0x06,0x03,0x03,0x30,0x34,0x78,
+0x07,0x80,0x0e,0x00,0x1c,0x00,0x0c,0x00,0x18,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0f,0xe0,0xc1,0x81,0x80,0x03,0x03,0x07,0xfe,0x00,0xc0,0x18,0x18,
+0x18,0x30,0x06,0x00,0x06,0x00,0x7c,0x00,0x30,0x18,0x61,0x8c,0x18,0x18,0x18,
+0x18,0x30,0x60,0x60,0x18,0x00,0xf8,0x00,0xc0,0x06,0x06,0x06,0x30,0x36,0xcc,
+0x03,0x80,0x31,0x80,0x06,0x00,0x60,0x00,0x30,0x00,0x1c,0x0c,0xe6,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x03,0xff,0x80,0x03,0x00,0x6c,0xcc,0x73,0x00,0x00,
+0x06,0x00,0x03,0x00,0x36,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,
+0x30,0x30,0x07,0x00,0x0c,0x00,0x01,0x83,0x0e,0x00,0x06,0x0e,0x0c,0x01,0x80,
+0x30,0x30,0x0e,0x60,0x00,0x00,0x00,0x01,0xc0,0x03,0xfe,0x00,0x0e,0x01,0x80,
+0x8c,0x44,0x3f,0xe0,0xc0,0x63,0x00,0x03,0x01,0x83,0x00,0x06,0x00,0x30,0x0c,
+0x60,0x18,0x06,0x00,0x00,0xc0,0xc6,0x01,0x80,0x18,0x91,0x8c,0x33,0x30,0x06,
+0x30,0x00,0xc0,0x18,0xc0,0xc0,0x00,0xc0,0x38,0x06,0x03,0x03,0x30,0x3c,0x78,
+0x0f,0xc0,0x06,0x00,0x18,0x00,0x0c,0x00,0x18,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x3f,0xe0,0xc1,0x81,0x80,0x03,0x03,0x07,0xfe,0x00,0xc0,0x18,0x18,
+0x18,0x30,0x06,0x00,0x06,0x00,0x7c,0x00,0x30,0x18,0x61,0x8c,0x18,0x18,0x18,
+0x18,0x30,0x60,0x60,0x18,0x00,0x3e,0x00,0xc0,0x06,0x06,0x03,0x20,0x34,0xd8,
+0x03,0x80,0x1b,0x80,0x0c,0x00,0x30,0x00,0x30,0x00,0x30,0x18,0x7e,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x83,0x03,0x00,0xc8,0x4c,0x3e,0x00,0x00,
+0x06,0x00,0x03,0x00,0x02,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x30,0x30,0x07,0x00,0x1c,0x00,0x01,0x83,0xff,0x80,0x06,0x06,0x0c,0x03,0x80,
+0x30,0x30,0x00,0x60,0x00,0x00,0x00,0x00,0xf8,0x03,0xfe,0x00,0x7c,0x01,0x80,
+0x8c,0x4c,0x3f,0xf0,0xc0,0x63,0x80,0xc3,0x01,0x83,0x00,0x06,0x00,0x38,0x0c,
+0x60,0x18,0x06,0x00,0x00,0xc0,0xc7,0x01,0x80,0x18,0xf1,0x8c,0x1b,0x38,0x0e,
+0x30,0x00,0xe0,0x38,0xc0,0xe1,0x80,0xc0,0x38,0x06,0x03,0x03,0x70,0x1c,0x78,
+0x0c,0xc0,0x06,0x00,0x30,0x00,0x0c,0x00,0x0c,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x70,0xe0,0xc1,0x81,0x80,0x03,0x03,0x06,0x00,0x00,0xc0,0x18,0x18,
+0x18,0x30,0x06,0x00,0x06,0x00,0x66,0x00,0x30,0x18,0x61,0x8c,0x18,0x18,0x18,
+0x18,0x30,0x60,0x60,0x18,0x00,0x07,0x00,0xc0,0x06,0x06,0x03,0x60,0x1c,0x58,
+0x07,0xc0,0x1b,0x00,0x1c,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xcc,0x03,0x83,0x00,0x88,0x4c,0x1e,0x00,0x00,
+0x06,0x00,0x03,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x38,0x30,0x07,0x00,0x38,0x01,0x81,0x80,0x0e,0x03,0x06,0x06,0x0c,0x03,0x00,
+0x30,0x30,0x00,0xe0,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x01,0xe0,0x00,0x00,
+0xcc,0xc8,0x30,0x30,0xc0,0x61,0x80,0xc3,0x03,0x83,0x00,0x06,0x00,0x18,0x0c,
+0x60,0x18,0x06,0x00,0x60,0xc0,0xc3,0x81,0x80,0x18,0xf1,0x8c,0x1f,0x18,0x0c,
+0x30,0x00,0x60,0xb0,0xc0,0xe1,0xc0,0xc0,0x38,0x06,0x03,0x01,0xe0,0x1c,0x30,
+0x18,0x60,0x06,0x00,0x70,0x00,0x0c,0x00,0x0c,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x60,0xe0,0xc1,0x81,0xc1,0x83,0x03,0x07,0x00,0x00,0xc0,0x1c,0x18,
+0x18,0x30,0x06,0x00,0x06,0x00,0x67,0x00,0x30,0x18,0x61,0x8c,0x18,0x1c,0x18,
+0x18,0x30,0x60,0x60,0x18,0x01,0x83,0x00,0xc0,0x06,0x06,0x01,0x60,0x1c,0x78,
+0x06,0xc0,0x1b,0x00,0x18,0x00,0x18,0x00,0x30,0x00,0x70,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xcc,0x01,0x87,0x01,0x88,0x4c,0x0c,0x00,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x18,0x70,0x07,0x00,0x70,0x00,0xc1,0x80,0x0e,0x03,0x0e,0x07,0x0c,0x03,0x00,
+0x38,0x30,0x00,0xc0,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x07,0x80,0x00,0x00,
+0x47,0x70,0x60,0x38,0xc0,0xe1,0xc1,0x83,0x03,0x03,0x00,0x06,0x00,0x1c,0x0c,
+0x60,0x18,0x06,0x00,0x60,0xc0,0xc1,0xc1,0x80,0x18,0x61,0x8c,0x0f,0x1c,0x1c,
+0x30,0x00,0x70,0x70,0xc0,0xe0,0xc0,0xc0,0x38,0x07,0x07,0x01,0xe0,0x18,0x30,
+0x38,0x70,0x06,0x00,0x60,0x00,0x0c,0x00,0x0c,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x60,0xe0,0xe1,0x80,0xc1,0x81,0x87,0x03,0x00,0x00,0xc0,0x0c,0x38,
+0x18,0x30,0x06,0x00,0x06,0x00,0x63,0x00,0x30,0x18,0x61,0x8c,0x18,0x0c,0x38,
+0x18,0x30,0x30,0xe0,0x18,0x01,0xc3,0x00,0xc6,0x07,0x0e,0x01,0xc0,0x18,0x70,
+0x0c,0x60,0x0e,0x00,0x30,0x00,0x18,0x00,0x30,0x00,0x70,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x00,0x8c,0x01,0xfe,0x01,0x0c,0xc7,0x3e,0x00,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x01,0x80,0x06,0x00,
+0x1c,0xe0,0x07,0x00,0x7f,0xc0,0xf7,0x00,0x0e,0x03,0xdc,0x03,0xb8,0x03,0x00,
+0x1e,0xe0,0x33,0xc0,0x18,0x00,0x30,0x00,0x01,0x00,0x00,0x06,0x00,0x01,0x80,
+0x40,0x00,0x60,0x18,0xff,0xc0,0xe7,0x83,0xfe,0x03,0xfe,0x06,0x00,0x0f,0x3c,
+0x60,0x18,0x1f,0x80,0x3b,0x80,0xc0,0xe1,0xff,0x98,0x61,0x8c,0x07,0x0f,0xf8,
+0x30,0x00,0x3f,0xf0,0xc0,0x60,0xf3,0x80,0x38,0x03,0xde,0x01,0xc0,0x18,0x30,
+0x30,0x30,0x06,0x00,0xff,0xe0,0x0c,0x00,0x06,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x3f,0xe0,0xff,0x00,0xff,0x01,0xff,0x03,0xcc,0x00,0xc0,0x0f,0xf8,
+0x18,0x30,0x3f,0xc0,0x06,0x00,0x61,0x81,0xfe,0x18,0x61,0x8c,0x18,0x0f,0x70,
+0x1e,0xe0,0x39,0xe0,0x18,0x00,0xe7,0x00,0xfe,0x07,0xfe,0x01,0xc0,0x18,0x30,
+0x1c,0x70,0x0e,0x00,0x7f,0xc0,0x18,0x00,0x30,0x00,0x70,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x00,0x8c,0x00,0xfc,0x00,0x07,0x83,0xf7,0x00,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x01,0x80,0x06,0x00,
+0x0f,0xc0,0x07,0x00,0x7f,0xc0,0x7e,0x00,0x0e,0x01,0xf8,0x01,0xf0,0x03,0x00,
+0x0f,0xc0,0x3f,0x00,0x18,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,
+0x20,0x00,0x60,0x18,0xff,0x80,0x7e,0x03,0xfc,0x03,0xfe,0x06,0x00,0x07,0xf0,
+0x60,0x18,0x1f,0x80,0x1f,0x00,0xc0,0x61,0xff,0x98,0x01,0x8c,0x07,0x07,0xe0,
+0x30,0x00,0x1f,0xb8,0xc0,0x60,0x3f,0x00,0x38,0x01,0xfc,0x00,0xc0,0x18,0x10,
+0x70,0x38,0x06,0x00,0xff,0xe0,0x0c,0x00,0x06,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x3e,0x60,0xbe,0x00,0x3e,0x00,0xfb,0x00,0xfc,0x00,0xc0,0x07,0xd8,
+0x18,0x30,0x3f,0xc0,0x06,0x00,0x61,0xc1,0xfe,0x18,0x61,0x8c,0x18,0x03,0xe0,
+0x1f,0xc0,0x1f,0x60,0x18,0x00,0x7e,0x00,0x78,0x03,0xf6,0x00,0xc0,0x08,0x30,
+0x18,0x30,0x0e,0x00,0x7f,0xc0,0x18,0x00,0x30,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x80,0x0c,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x0c,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x03,0x00,0x60,0x00,0x00,0x1f,0xf8,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,
+0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x18,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x80,0x0c,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x0c,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x03,0x01,0xe0,0x00,0x00,0x1f,0xf8,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,
+0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x18,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x00,0x1c,0x00,0x30,0x00,0x60,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0xc0,0x18,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x30,
+0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x18,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x1c,0x00,0x00,0x00,0x0e,0x00,0x30,0x00,0xc0,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x60,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf0,
+0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x18,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x78,0x00,0x00,0x00,0x02,0x00,0x30,0x00,0x80,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,
+0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   }
 };
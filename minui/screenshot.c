@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Screenshots.  gr_screenshot() only copies the frame and queues it; a
+ * thread started on the first capture encodes the queue as PNGs, so the
+ * caller never waits for zlib, and a burst of captures records an
+ * animation frame by frame as long as the queue has room. */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <pthread.h>
+#include <stdio.h>
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+
+#include <pixelflinger/pixelflinger.h>
+
+#include <png.h>
+#include <zlib.h>
+
+#include "minui.h"
+#include "graphics.h"
+
+#define GR_SHOT_QUEUE 8
+
+typedef struct {
+    GGLSurface frame;       /* packed rows follow the header */
+    char *path;
+} GRShot;
+
+static pthread_t gr_shot_thread;
+static pthread_mutex_t gr_shot_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gr_shot_ready = PTHREAD_COND_INITIALIZER;
+static GRShot *gr_shot_queue[GR_SHOT_QUEUE];
+static unsigned gr_shot_head = 0, gr_shot_count = 0;
+/* written shots, kept so a burst does not fault in new pages */
+static GRShot *gr_shot_free[GR_SHOT_QUEUE];
+static unsigned gr_shot_free_count = 0;
+static int gr_shot_running = 0;
+static int gr_shot_stop = 0;
+
+/* Converts line y of s to packed RGB. */
+static void rgb_row(unsigned char *row, const GGLSurface *s, unsigned y)
+{
+    int bpp = gr_bytes_per_pixel(s->format);
+    const unsigned char *p = s->data + y * s->stride * bpp;
+    unsigned x;
+
+    for (x = 0; x < s->width; x++, p += bpp) {
+        unsigned r, g, b;
+        gr_load(s->format, p, &r, &g, &b);
+        row[x * 3] = r;
+        row[x * 3 + 1] = g;
+        row[x * 3 + 2] = b;
+    }
+}
+
+/* Encodes s into fp, using row for one line.  Kept apart from
+ * write_png() so that none of its state lives across the setjmp. */
+static int encode_png(FILE *fp, const GGLSurface *s, unsigned char *row)
+{
+    png_structp png_ptr;
+    png_infop info_ptr = NULL;
+    unsigned y;
+
+    png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if (png_ptr == NULL) return -1;
+    info_ptr = png_create_info_struct(png_ptr);
+    if (info_ptr == NULL || setjmp(png_jmpbuf(png_ptr))) {
+        png_destroy_write_struct(&png_ptr, &info_ptr);
+        return -1;
+    }
+
+    png_init_io(png_ptr, fp);
+    /* a fast level and one cheap filter: the queue should drain
+     * faster than a burst fills it */
+    png_set_compression_level(png_ptr, Z_BEST_SPEED);
+    png_set_filter(png_ptr, 0, PNG_FILTER_SUB);
+    png_set_IHDR(png_ptr, info_ptr, s->width, s->height, 8,
+                 PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE,
+                 PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png_ptr, info_ptr);
+
+    for (y = 0; y < s->height; y++) {
+        rgb_row(row, s, y);
+        png_write_row(png_ptr, row);
+    }
+    png_write_end(png_ptr, info_ptr);
+    png_destroy_write_struct(&png_ptr, &info_ptr);
+    return 0;
+}
+
+static int write_png(const GRShot *shot)
+{
+    const GGLSurface *s = &shot->frame;
+    unsigned char *row;
+    int result = -1;
+    FILE *fp;
+
+    fp = fopen(shot->path, "wb");
+    if (fp == NULL) {
+        perror(shot->path);
+        return -1;
+    }
+    row = malloc(s->width * 3);
+    if (row != NULL) result = encode_png(fp, s, row);
+    free(row);
+    if (fclose(fp) != 0) result = -1;
+    if (result < 0) {
+        fprintf(stderr, "cannot write screenshot %s\n", shot->path);
+        remove(shot->path);
+    }
+    return result;
+}
+
+static void *shot_thread(void *cookie)
+{
+    GRShot *shot;
+
+    /* only idle time goes to encoding */
+    setpriority(PRIO_PROCESS, syscall(__NR_gettid), 19);
+
+    for (;;) {
+        pthread_mutex_lock(&gr_shot_lock);
+        while (gr_shot_count == 0 && !gr_shot_stop) {
+            pthread_cond_wait(&gr_shot_ready, &gr_shot_lock);
+        }
+        /* captures already taken are written before stopping */
+        if (gr_shot_count == 0) {
+            pthread_mutex_unlock(&gr_shot_lock);
+            break;
+        }
+        shot = gr_shot_queue[gr_shot_head];
+        pthread_mutex_unlock(&gr_shot_lock);
+
+        write_png(shot);
+
+        free(shot->path);
+        shot->path = NULL;
+        pthread_mutex_lock(&gr_shot_lock);
+        gr_shot_head = (gr_shot_head + 1) % GR_SHOT_QUEUE;
+        gr_shot_count--;
+        gr_shot_free[gr_shot_free_count++] = shot;
+        pthread_mutex_unlock(&gr_shot_lock);
+    }
+    return NULL;
+}
+
+int gr_screenshot(const char *path)
+{
+    const GGLSurface *frame = gr_last_frame();
+    GRShot *shot = NULL;
+    int bpp, result = -1;
+    size_t line;
+    unsigned y;
+
+    if (frame == NULL) return -1;
+
+    pthread_mutex_lock(&gr_shot_lock);
+    if (gr_shot_count == GR_SHOT_QUEUE) {
+        pthread_mutex_unlock(&gr_shot_lock);
+        return -1;
+    }
+    if (gr_shot_free_count > 0) shot = gr_shot_free[--gr_shot_free_count];
+    pthread_mutex_unlock(&gr_shot_lock);
+
+    bpp = gr_bytes_per_pixel(frame->format);
+    line = frame->width * bpp;
+    if (shot != NULL && (shot->frame.width != frame->width ||
+                         shot->frame.height != frame->height ||
+                         shot->frame.format != frame->format)) {
+        free(shot);
+        shot = NULL;
+    }
+    if (shot == NULL) shot = malloc(sizeof(*shot) + line * frame->height);
+    if (shot == NULL) return -1;
+    shot->frame = *frame;
+    shot->frame.stride = frame->width;
+    shot->frame.data = (unsigned char *) (shot + 1);
+    shot->path = strdup(path);
+    if (shot->path == NULL) {
+        free(shot);
+        return -1;
+    }
+    for (y = 0; y < frame->height; y++) {
+        memcpy(shot->frame.data + y * line,
+               frame->data + y * frame->stride * bpp, line);
+    }
+
+    pthread_mutex_lock(&gr_shot_lock);
+    if (!gr_shot_running) {
+        gr_shot_stop = 0;
+        gr_shot_running = (pthread_create(&gr_shot_thread, NULL,
+                                          shot_thread, NULL) == 0);
+    }
+    if (gr_shot_running && gr_shot_count < GR_SHOT_QUEUE) {
+        gr_shot_queue[(gr_shot_head + gr_shot_count) % GR_SHOT_QUEUE] = shot;
+        gr_shot_count++;
+        pthread_cond_signal(&gr_shot_ready);
+        shot = NULL;
+        result = 0;
+    }
+    pthread_mutex_unlock(&gr_shot_lock);
+
+    if (shot != NULL) {
+        free(shot->path);
+        free(shot);
+    }
+    return result;
+}
+
+void gr_screenshot_finish(void)
+{
+    pthread_mutex_lock(&gr_shot_lock);
+    if (!gr_shot_running) {
+        pthread_mutex_unlock(&gr_shot_lock);
+        return;
+    }
+    gr_shot_stop = 1;
+    pthread_cond_signal(&gr_shot_ready);
+    pthread_mutex_unlock(&gr_shot_lock);
+
+    pthread_join(gr_shot_thread, NULL);
+    gr_shot_running = 0;
+
+    while (gr_shot_free_count > 0) free(gr_shot_free[--gr_shot_free_count]);
+}
@@ -0,0 +1,1873 @@
+/* Generated by mkglyphs; do not edit. */
+
+#define GLYPHS_CWIDTH   15
+#define GLYPHS_CHEIGHT  24
+#define GLYPHS_STRIDE   2
+#define GLYPHS_NONE     0xffff
+#define GLYPHS_MISSING  23334
+
+/* block of glyphs_index for each 256 code points */
+static const unsigned short glyphs_page[256] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x0005, 0x0006, 0xffff, 0xffff, 0xffff, 0x0007, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+};
+
+/* offset of each glyph in glyphs_data */
+static const unsigned short glyphs_index[8 * 256] = {
+  /* U+00xx */
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x0000, 0x0002, 0x0024, 0x0044, 0x0064, 0x007a, 0x009a, 0x00c6,
+  0x00e8, 0x00ee, 0x010e, 0x011e, 0x0132, 0x0142, 0x0148, 0x015c,
+  0x0162, 0x0170, 0x018a, 0x019c, 0x01b0, 0x01ba, 0x01dc, 0x0200,
+  0x020a, 0x0216, 0x0228, 0x0238, 0x024c, 0x026a, 0x0288, 0x02a6,
+  0x02c8, 0x02f0, 0x0318, 0x0340, 0x0368, 0x038e, 0x03b6, 0x03d6,
+  0x03fe, 0x0426, 0x044e, 0x0476, 0x049c, 0x04c4, 0x04ec, 0x0514,
+  0x053a, 0x055a, 0x0582, 0x05aa, 0x05d2, 0x05fa, 0x0622, 0x0648,
+  0x065c, 0x067c, 0x06a4, 0x06cc, 0x06f4, 0x071a, 0x0742, 0x0762,
+  0x0784, 0x07a8, 0x07cc, 0x07ee, 0x0810, 0x0832, 0x0856, 0x086e,
+  0x088e, 0x08b2, 0x08d6, 0x08f8, 0x091a, 0x093e, 0x0962, 0x0986,
+  0x09a8, 0x09ca, 0x09ec, 0x0a10, 0x0a34, 0x0a56, 0x0a78, 0x0a9a,
+  0x0ab0, 0x0ac8, 0x0aec, 0x0b10, 0x0b34, 0x0b56, 0x0b84, 0x0bb0,
+  /* U+01xx */
+  0x0bdc, 0x0c02, 0x0c22, 0x0c4a, 0x0c6c, 0x0c96, 0x0cb8, 0x0ce0,
+  0x0d04, 0x0d2c, 0x0d50, 0x0d78, 0x0d9a, 0x0dc2, 0x0de4, 0x0e0c,
+  0x0e32, 0x0e52, 0x0e74, 0x0e9a, 0x0eba, 0x0ee2, 0x0f04, 0x0f2c,
+  0x0f4e, 0x0f78, 0x0f9a, 0x0fc2, 0x0fe6, 0x100e, 0x103a, 0x1062,
+  0x108e, 0x10b6, 0x10e2, 0x110c, 0x1138, 0x1160, 0x1188, 0x11a8,
+  0x11ca, 0x11f2, 0x1214, 0x123a, 0x125a, 0x1282, 0x12a4, 0x12ce,
+  0x12fa, 0x1322, 0x133a, 0x1360, 0x138c, 0x13b4, 0x13e0, 0x140a,
+  0x1436, 0x144e, 0x1476, 0x149e, 0x14c8, 0x14f4, 0x1518, 0x153e,
+  0x155e, 0x1580, 0x15a0, 0x15c2, 0x15ea, 0x160e, 0x1638, 0x165a,
+  0x1682, 0x16a4, 0x16c6, 0x16e6, 0x1708, 0x172e, 0x174e, 0x1776,
+  0x1798, 0x17c0, 0x17e2, 0x1802, 0x181a, 0x1842, 0x1866, 0x1890,
+  0x18b2, 0x18da, 0x18fc, 0x1924, 0x1948, 0x1970, 0x1994, 0x19bc,
+  0x19dc, 0x1a04, 0x1a26, 0x1a50, 0x1a78, 0x1aa0, 0x1ac6, 0x1ae6,
+  0x1b06, 0x1b2e, 0x1b50, 0x1b76, 0x1b96, 0x1bbe, 0x1be0, 0x1c08,
+  0x1c2c, 0x1c54, 0x1c78, 0x1ca2, 0x1cc4, 0x1cec, 0x1d10, 0x1d38,
+  0x1d64, 0x1d8a, 0x1db2, 0x1dd6, 0x1dfe, 0x1e20, 0x1e48, 0x1e6a,
+  0x1e8c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x1eae, 0xffff, 0xffff, 0xffff, 0xffff, 0x1ece,
+  0xffff, 0xffff, 0x1eee, 0x1f12, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x1f38, 0x1f5e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1f7c,
+  0x1fa2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x1fc2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1fee, 0x2016, 0x203a,
+  0x2062, 0x2084, 0x20ac, 0x20d0, 0x20f8, 0x211a, 0x2140, 0x2166,
+  0x218c, 0x21b2, 0x21d8, 0x21fe, 0x2224, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x224a, 0x2270, 0xffff, 0xffff, 0x2290, 0x22b8,
+  0xffff, 0xffff, 0x22e4, 0x230c, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x232e, 0x2356, 0xffff, 0xffff,
+  0x2384, 0x23ac, 0x23d0, 0x23f8, 0x2420, 0x2448, 0x246c, 0x2494,
+  /* U+02xx */
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x24b8, 0x24e2, 0x2504, 0x252e, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2558,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0x257a, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  /* U+03xx */
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x259a, 0x25a6, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x25b2, 0xffff, 0xffff, 0xffff, 0x25ba, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x25dc, 0x25e8, 0x25f2, 0x2614,
+  0x261e, 0x2640, 0x2662, 0xffff, 0x2684, 0xffff, 0x26a4, 0x26c6,
+  0x26e6, 0x270a, 0x272a, 0x274a, 0x276a, 0x278a, 0x27aa, 0x27ca,
+  0x27ea, 0x280a, 0x282a, 0x284a, 0x286a, 0x288a, 0x28aa, 0x28ca,
+  0x28ea, 0x290a, 0xffff, 0x292a, 0x294a, 0x296a, 0x298a, 0x29aa,
+  0x29ca, 0x29ea, 0x2a0a, 0x2a30, 0x2a56, 0x2a7a, 0x2a9e, 0x2acc,
+  0x2af2, 0x2b16, 0x2b2e, 0x2b58, 0x2b78, 0x2b9a, 0x2bb2, 0x2bdc,
+  0x2bfc, 0x2c1e, 0x2c36, 0x2c4e, 0x2c70, 0x2c90, 0x2ca8, 0x2cd2,
+  0x2cea, 0x2d02, 0x2d22, 0x2d42, 0x2d5a, 0x2d72, 0x2d8a, 0x2db0,
+  0x2dd0, 0x2df6, 0x2e0e, 0x2e30, 0x2e52, 0x2e76, 0x2e9c, 0xffff,
+  0x2ec2, 0x2ee4, 0xffff, 0xffff, 0xffff, 0x2f06, 0xffff, 0x2f2c,
+  0xffff, 0x2f4c, 0xffff, 0x2f6c, 0xffff, 0x2f8a, 0xffff, 0xffff,
+  0xffff, 0x2faa, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  /* U+04xx */
+  0x2fd2, 0x2ffa, 0x3020, 0x3040, 0x3068, 0x3088, 0x30a8, 0x30c8,
+  0x30ee, 0x310e, 0x312e, 0x314e, 0x316e, 0x3196, 0x31be, 0x31e6,
+  0x320e, 0x322e, 0x324e, 0x326e, 0x328e, 0x32b8, 0x32d8, 0x32f8,
+  0x3318, 0x3338, 0x3360, 0x3380, 0x33a0, 0x33c0, 0x33e0, 0x3400,
+  0x3420, 0x3440, 0x3460, 0x3480, 0x34a0, 0x34c0, 0x34e0, 0x3508,
+  0x3528, 0x3548, 0x3570, 0x3590, 0x35b0, 0x35d0, 0x35f0, 0x3610,
+  0x3630, 0x3648, 0x366c, 0x3684, 0x369c, 0x36bc, 0x36d4, 0x36ec,
+  0x3704, 0x371c, 0x373e, 0x3756, 0x376e, 0x3786, 0x379e, 0x37b6,
+  0x37ce, 0x37f0, 0x3808, 0x3820, 0x3842, 0x386e, 0x3886, 0x38a6,
+  0x38be, 0x38d6, 0x38f6, 0x390e, 0x3926, 0x393e, 0x3956, 0x396e,
+  0x3986, 0x39aa, 0x39cc, 0x39f8, 0x3a1c, 0x3a34, 0x3a4c, 0x3a6e,
+  0x3a8e, 0x3aba, 0x3ad2, 0x3aea, 0x3b0c, 0x3b30, 0x3b54, 0x3b80,
+  0xffff, 0xffff, 0x3ba0, 0x3bc2, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x3be0, 0x3c00, 0x3c18, 0x3c38, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x3c50, 0x3c76, 0x3c96, 0x3cb6, 0xffff, 0xffff, 0x3cce, 0x3cf6,
+  0x3d16, 0x3d3e, 0x3d5e, 0x3d86, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x3da6, 0x3dc6, 0x3dde, 0x3e06, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x3e26, 0x3e4e, 0xffff, 0xffff, 0x3e6e, 0x3e8e,
+  0x3eb0, 0x3ed0, 0x3ef2, 0x3f1a, 0xffff, 0xffff, 0x3f3a, 0x3f62,
+  0xffff, 0xffff, 0x3f82, 0x3fa2, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x3fc4, 0x3fe4, 0x400c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x402e,
+  0x4050, 0x4078, 0xffff, 0xffff, 0x409c, 0x40bc, 0x40d4, 0x40fc,
+  0x4120, 0x4140, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x4158, 0x417e, 0xffff, 0xffff, 0x419e, 0x41c4,
+  0x41e6, 0x4206, 0xffff, 0xffff, 0xffff, 0xffff, 0x421e, 0x4244,
+  0xffff, 0xffff, 0x426e, 0x4296, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  /* U+20xx */
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x42c4, 0xffff, 0x42ca, 0x42d0, 0x42d6, 0x42dc, 0x42e2, 0x430e,
+  0x4316, 0x4326, 0x4336, 0x4346, 0x4356, 0x4366, 0x4376, 0xffff,
+  0x4386, 0x43ac, 0x43d2, 0xffff, 0xffff, 0xffff, 0x43e0, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x43e8,
+  0x43ea, 0xffff, 0x440a, 0x4418, 0xffff, 0x4426, 0xffff, 0xffff,
+  0xffff, 0x4434, 0x4448, 0xffff, 0x445c, 0x447c, 0x449c, 0x44a2,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x44aa, 0xffff, 0xffff, 0x44c4,
+  0x44e4, 0x4504, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x4524, 0xffff, 0x454c, 0x456c, 0xffff, 0x458c, 0x45ac,
+  0xffff, 0x45cc, 0xffff, 0x45ec, 0x460c, 0xffff, 0x462c, 0xffff,
+  0xffff, 0x464c, 0x466c, 0xffff, 0x4694, 0x46b4, 0xffff, 0xffff,
+  0x46da, 0x46fa, 0x4716, 0xffff, 0xffff, 0x4736, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  /* U+21xx */
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4756, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0x4774, 0xffff, 0xffff, 0x4794, 0x47b0,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x47ce, 0xffff, 0x47de, 0xffff, 0xffff, 0xffff, 0x47ee, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x480c, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x482c, 0x4842, 0x485c, 0x4874, 0x488c, 0x48a0, 0x48bc, 0x48ce,
+  0x48e0, 0x48f2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x4904, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x4922, 0x493a, 0x4954, 0x496c, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  /* U+25xx */
+  0x4984, 0x498a, 0x4992, 0x49c4, 0x49f6, 0x49fc, 0x4a04, 0x4a34,
+  0x4a64, 0x4a6a, 0x4a72, 0x4aa2, 0x4ad2, 0x4aec, 0x4b08, 0x4b22,
+  0x4b3e, 0x4b58, 0x4b74, 0x4b8e, 0x4baa, 0x4bc8, 0x4be6, 0x4c04,
+  0x4c22, 0x4c40, 0x4c5e, 0x4c7c, 0x4c9a, 0x4ccc, 0x4cfe, 0x4d30,
+  0x4d62, 0x4d94, 0x4dc6, 0x4df8, 0x4e2a, 0x4e5c, 0x4e8e, 0x4ec0,
+  0x4ef2, 0x4f24, 0x4f56, 0x4f88, 0x4fba, 0x4fd4, 0x4ff0, 0x500c,
+  0x5028, 0x5042, 0x505e, 0x507a, 0x5096, 0x50b4, 0x50d2, 0x50f0,
+  0x510e, 0x512c, 0x514a, 0x5168, 0x5186, 0x51b8, 0x51ea, 0x521c,
+  0x524e, 0x5280, 0x52b2, 0x52e4, 0x5316, 0x5348, 0x537a, 0x53ac,
+  0x53de, 0x5410, 0x5442, 0x5474, 0x54a6, 0x54ac, 0x54b4, 0x54dc,
+  0x5504, 0x5510, 0x5542, 0x5560, 0x557a, 0x5598, 0x55b6, 0x55d0,
+  0x55ee, 0x560e, 0x562c, 0x564c, 0x566c, 0x568a, 0x56aa, 0x56dc,
+  0x570e, 0x5740, 0x5772, 0x57a4, 0x57d6, 0x57f4, 0x580e, 0x582c,
+  0x584c, 0x586a, 0x588a, 0x58bc, 0x58ee, 0x5920, 0x593a, 0x5954,
+  0x5972, 0x5990, 0x59c2, 0x59f4, 0x5a26, 0x5a2c, 0x5a4a, 0x5a50,
+  0x5a6a, 0x5a72, 0x5a90, 0x5a98, 0x5ab2, 0x5aba, 0x5aec, 0x5af4,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+};
+
+/* per glyph: first row, row count, then the rows, 2 bytes each */
+static const unsigned char glyphs_data[23364] = {
+0x00,0x00,0x08,0x10,0x03,0x80,0x03,0x80,0x03,0x80,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+0x01,0x80,0x01,0x80,0x01,0x80,0x04,0x0f,0x01,0x00,0x01,0x00,0x03,0xc0,0x0f,
+0xc0,0x0d,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x0d,0x00,
+0x07,0xe0,0x03,0x80,0x01,0x00,0x01,0x00,0x04,0x0f,0x01,0xe0,0x07,0xf8,0x06,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x04,0x00,0x1f,0xe0,0x1f,0xe0,0x06,0x00,
+0x06,0x00,0x06,0x00,0x04,0x00,0x0f,0xf8,0x1f,0xf8,0x07,0x0a,0x30,0x30,0x1f,
+0xe0,0x0c,0xc0,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x1f,0xe0,0x1b,0x60,
+0x30,0x30,0x04,0x0f,0x18,0x10,0x18,0x30,0x0c,0x20,0x0c,0x20,0x04,0x60,0x06,
+0x40,0x02,0xc0,0x03,0x80,0x1f,0xf0,0x01,0x80,0x1f,0xf0,0x1f,0xf0,0x01,0x80,
+0x01,0x80,0x01,0x80,0x03,0x15,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,
+0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,
+0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,
+0x80,0x01,0x80,0x04,0x10,0x03,0xc0,0x07,0xe0,0x0c,0x00,0x0c,0x00,0x06,0x00,
+0x0f,0x80,0x18,0xe0,0x18,0x30,0x18,0x30,0x0c,0x30,0x07,0x60,0x01,0xc0,0x00,
+0x40,0x00,0x60,0x08,0xe0,0x0f,0xc0,0x04,0x02,0x0c,0xc0,0x0c,0xc0,0x04,0x0f,
+0x07,0xc0,0x0f,0xe0,0x18,0x30,0x10,0x10,0x37,0xd8,0x26,0x08,0x2c,0x08,0x2c,
+0x08,0x2c,0x08,0x24,0x08,0x37,0xd8,0x13,0x90,0x18,0x30,0x0f,0xe0,0x03,0xc0,
+0x04,0x07,0x03,0xc0,0x00,0x60,0x00,0x60,0x03,0xe0,0x04,0x20,0x04,0x60,0x03,
+0xa0,0x09,0x09,0x02,0x10,0x06,0x30,0x0c,0x60,0x18,0xc0,0x18,0xc0,0x18,0xc0,
+0x0c,0x60,0x06,0x30,0x02,0x10,0x0a,0x07,0x1f,0xe0,0x3f,0xf0,0x00,0x30,0x00,
+0x30,0x00,0x30,0x00,0x30,0x00,0x20,0x0a,0x02,0x1f,0xf0,0x1f,0xf0,0x03,0x09,
+0x07,0x80,0x0f,0xc0,0x1f,0xe0,0x17,0xa0,0x17,0x20,0x14,0xa0,0x18,0x60,0x0f,
+0xc0,0x07,0x80,0x04,0x02,0x0f,0xc0,0x0f,0xc0,0x04,0x06,0x03,0x80,0x07,0xc0,
+0x04,0x40,0x04,0x40,0x07,0xc0,0x03,0x80,0x07,0x0c,0x01,0x80,0x01,0x80,0x01,
+0x80,0x01,0x80,0x1f,0xf0,0x1f,0xf0,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,
+0x1f,0xf0,0x1f,0xf0,0x03,0x08,0x07,0x80,0x0c,0xc0,0x00,0x40,0x00,0xc0,0x00,
+0x80,0x01,0x00,0x06,0x00,0x0f,0xc0,0x02,0x09,0x03,0x80,0x04,0xc0,0x00,0x40,
+0x00,0xc0,0x03,0x80,0x00,0xc0,0x00,0x40,0x0c,0xc0,0x07,0x80,0x02,0x04,0x00,
+0xc0,0x00,0xc0,0x01,0x80,0x03,0x00,0x08,0x10,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x1f,0xb0,0x1f,
+0x18,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x04,0x11,0x03,0xb0,
+0x0f,0xb0,0x1f,0xb0,0x1f,0xb0,0x1f,0xb0,0x1f,0xb0,0x1f,0xb0,0x0f,0xb0,0x0f,
+0xb0,0x03,0xb0,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x30,0x09,0x04,0x01,0x00,0x03,0x80,0x03,0x80,0x01,0x00,0x13,0x05,0x01,
+0x00,0x01,0x00,0x00,0xc0,0x00,0xc0,0x03,0x80,0x03,0x08,0x01,0x80,0x03,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x07,0xe0,0x04,0x07,0x07,
+0x80,0x0c,0xc0,0x08,0x40,0x08,0x40,0x08,0x40,0x0c,0xc0,0x07,0x80,0x09,0x09,
+0x10,0x80,0x18,0xc0,0x0c,0x60,0x06,0x30,0x06,0x30,0x06,0x30,0x0c,0x60,0x18,
+0xc0,0x10,0x80,0x05,0x0e,0x1c,0x00,0x3c,0x18,0x0c,0x30,0x0c,0x60,0x0c,0x40,
+0x0c,0x00,0x0c,0x00,0x00,0x40,0x04,0x40,0x0c,0xb0,0x18,0xb0,0x31,0xf8,0x20,
+0xf8,0x00,0x30,0x05,0x0e,0x1c,0x00,0x3c,0x18,0x0c,0x30,0x0c,0x20,0x0c,0x40,
+0x0c,0x00,0x0c,0x00,0x00,0x70,0x00,0xf8,0x04,0x18,0x18,0x10,0x30,0x20,0x20,
+0x78,0x00,0xf8,0x05,0x0e,0x3c,0x00,0x06,0x18,0x0c,0x10,0x1c,0x20,0x06,0x40,
+0x3e,0x00,0x1c,0x00,0x00,0x40,0x04,0x40,0x0c,0xb0,0x08,0xb0,0x11,0xf8,0x30,
+0xf8,0x00,0x30,0x08,0x10,0x01,0xc0,0x01,0xc0,0x01,0xc0,0x00,0x00,0x00,0x00,
+0x00,0x80,0x00,0x80,0x01,0x80,0x03,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x10,0x07,0xf0,0x03,0xc0,0x00,0x13,0x06,0x00,0x03,0x00,0x01,0x00,
+0x00,0x00,0x03,0x00,0x03,0x80,0x02,0x80,0x06,0x80,0x04,0xc0,0x04,0xc0,0x0c,
+0x40,0x0c,0x60,0x08,0x60,0x1f,0xe0,0x18,0x30,0x10,0x30,0x30,0x30,0x30,0x10,
+0x30,0x18,0x00,0x13,0x00,0xc0,0x01,0x80,0x02,0x00,0x00,0x00,0x03,0x00,0x03,
+0x80,0x02,0x80,0x06,0x80,0x04,0xc0,0x04,0xc0,0x0c,0x40,0x0c,0x60,0x08,0x60,
+0x1f,0xe0,0x18,0x30,0x10,0x30,0x30,0x30,0x30,0x10,0x30,0x18,0x00,0x13,0x03,
+0x00,0x06,0x80,0x04,0x40,0x00,0x00,0x03,0x00,0x03,0x80,0x02,0x80,0x06,0x80,
+0x04,0xc0,0x04,0xc0,0x0c,0x40,0x0c,0x60,0x08,0x60,0x1f,0xe0,0x18,0x30,0x10,
+0x30,0x30,0x30,0x30,0x10,0x30,0x18,0x00,0x13,0x06,0x20,0x0f,0xa0,0x08,0xe0,
+0x00,0x00,0x01,0x80,0x03,0x80,0x02,0xc0,0x02,0xc0,0x06,0x40,0x06,0x40,0x04,
+0x60,0x0c,0x60,0x0c,0x20,0x0f,0xf0,0x18,0x30,0x18,0x10,0x18,0x18,0x10,0x18,
+0x30,0x18,0x01,0x12,0x0c,0xc0,0x0c,0xc0,0x00,0x00,0x03,0x00,0x07,0x80,0x07,
+0x80,0x05,0x80,0x0c,0x80,0x0c,0xc0,0x08,0xc0,0x08,0x40,0x18,0x60,0x1f,0xe0,
+0x18,0x60,0x30,0x20,0x30,0x30,0x30,0x30,0x20,0x30,0x00,0x13,0x04,0x80,0x04,
+0x80,0x04,0x80,0x03,0x00,0x03,0x00,0x03,0x00,0x07,0x80,0x04,0x80,0x04,0x80,
+0x0c,0xc0,0x0c,0xc0,0x08,0x40,0x18,0x60,0x1f,0xe0,0x18,0x60,0x30,0x20,0x30,
+0x30,0x30,0x30,0x20,0x10,0x04,0x0f,0x01,0xfc,0x03,0xf8,0x03,0xc0,0x02,0xc0,
+0x06,0xc0,0x06,0xc0,0x0c,0xf0,0x0c,0xf8,0x0c,0xc0,0x1f,0xc0,0x1f,0xc0,0x10,
+0xc0,0x30,0xc0,0x30,0xf8,0x20,0xfc,0x04,0x13,0x03,0xc0,0x0f,0xf0,0x1c,0x00,
+0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x18,0x00,0x1c,0x10,0x0f,0xf0,0x03,0xc0,0x01,0x00,0x01,0x80,0x00,0xc0,
+0x01,0x80,0x00,0x13,0x06,0x00,0x03,0x00,0x00,0x80,0x00,0x00,0x1f,0xf0,0x1f,
+0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,0xe0,0x18,0x00,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xe0,0x1f,0xf0,0x00,0x13,0x00,
+0xc0,0x01,0x80,0x01,0x00,0x00,0x00,0x1f,0xf0,0x1f,0xe0,0x18,0x00,0x18,0x00,
+0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x18,0x00,0x1f,0xe0,0x1f,0xf0,0x00,0x13,0x03,0x80,0x06,0xc0,0x04,0x40,
+0x00,0x00,0x1f,0xf0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,
+0xc0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xe0,
+0x1f,0xf0,0x01,0x12,0x06,0xc0,0x06,0xc0,0x00,0x00,0x1f,0xf0,0x1f,0xe0,0x18,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,0xc0,0x18,0x00,0x18,0x00,
+0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xe0,0x1f,0xf0,0x00,0x13,0x06,0x00,0x03,
+0x00,0x01,0x00,0x00,0x00,0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x1f,0xf0,0x1f,0xf0,0x00,0x13,0x01,0xc0,0x03,0x80,0x02,0x00,0x00,0x00,
+0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1f,0xf0,0x1f,0xf0,
+0x00,0x13,0x03,0x00,0x06,0x80,0x08,0x40,0x00,0x00,0x1f,0xf0,0x1f,0xf0,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x1f,0xf0,0x1f,0xf0,0x01,0x12,0x0c,0xc0,0x0c,
+0xc0,0x00,0x00,0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1f,
+0xf0,0x1f,0xf0,0x04,0x0f,0x1f,0x80,0x1f,0xe0,0x18,0x70,0x18,0x30,0x18,0x18,
+0x18,0x18,0x1f,0x18,0x3f,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x30,0x18,
+0x70,0x1f,0xe0,0x1f,0x80,0x00,0x13,0x06,0x20,0x05,0xe0,0x00,0xc0,0x00,0x00,
+0x18,0x30,0x1c,0x30,0x1c,0x30,0x1e,0x30,0x1a,0x30,0x1a,0x30,0x1b,0x30,0x19,
+0x30,0x19,0xb0,0x18,0xb0,0x18,0xb0,0x18,0xf0,0x18,0x70,0x18,0x70,0x18,0x30,
+0x00,0x13,0x06,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,
+0x30,0x18,0x30,0x30,0x10,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x10,0x18,0x30,0x18,0x30,0x0f,0xe0,0x07,0x80,0x00,0x13,0x00,0xc0,0x01,
+0x80,0x02,0x00,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,0x30,0x18,0x30,0x30,0x10,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x10,0x18,0x30,0x18,
+0x30,0x0f,0xe0,0x07,0x80,0x00,0x13,0x03,0x80,0x06,0xc0,0x00,0x40,0x00,0x00,
+0x07,0x80,0x0f,0xe0,0x18,0x30,0x18,0x30,0x30,0x10,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x10,0x18,0x30,0x18,0x30,0x0f,0xe0,0x07,0x80,
+0x00,0x13,0x06,0x20,0x0f,0xe0,0x08,0xc0,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,
+0x30,0x18,0x30,0x30,0x10,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x10,0x18,0x30,0x18,0x30,0x0f,0xe0,0x07,0x80,0x01,0x12,0x0c,0xc0,0x0c,
+0xc0,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,0x30,0x18,0x30,0x30,0x10,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x10,0x18,0x30,0x18,0x30,0x0f,
+0xe0,0x07,0x80,0x07,0x09,0x00,0x20,0x18,0x60,0x0c,0xc0,0x07,0x80,0x03,0x00,
+0x03,0x80,0x06,0xc0,0x0c,0x60,0x18,0x20,0x04,0x0f,0x07,0xd8,0x0f,0xf0,0x18,
+0x70,0x18,0x70,0x30,0xf0,0x30,0xd8,0x31,0x98,0x33,0x18,0x33,0x18,0x36,0x18,
+0x3c,0x10,0x1c,0x30,0x18,0x30,0x1f,0xe0,0x37,0x80,0x00,0x13,0x06,0x00,0x03,
+0x00,0x01,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x0c,
+0x60,0x0f,0xe0,0x07,0xc0,0x00,0x13,0x00,0xc0,0x01,0x80,0x00,0x00,0x00,0x00,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x0c,0x60,0x0f,0xe0,0x07,0xc0,
+0x00,0x13,0x03,0x80,0x06,0xc0,0x04,0x40,0x00,0x00,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x0c,0x60,0x0f,0xe0,0x07,0xc0,0x01,0x12,0x06,0x60,0x06,
+0x60,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x0c,0x60,0x0f,
+0xe0,0x07,0xc0,0x00,0x13,0x01,0x80,0x03,0x00,0x02,0x00,0x00,0x00,0x20,0x30,
+0x30,0x30,0x10,0x60,0x18,0x60,0x08,0x40,0x0c,0xc0,0x0c,0x80,0x07,0x80,0x07,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x04,0x0f,
+0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,0xe0,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x60,0x1f,0xe0,0x1e,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
+0x03,0x10,0x07,0x80,0x0f,0xc0,0x18,0x60,0x18,0x60,0x18,0x40,0x18,0xc0,0x19,
+0x80,0x19,0x80,0x19,0x80,0x18,0xe0,0x18,0x70,0x18,0x18,0x18,0x18,0x18,0x18,
+0x19,0xf0,0x19,0xe0,0x02,0x11,0x02,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x00,
+0x00,0x00,0x00,0x03,0xc0,0x0f,0xe0,0x08,0x30,0x00,0x30,0x01,0xf0,0x0f,0x30,
+0x1c,0x30,0x18,0x30,0x18,0x30,0x1f,0xf0,0x0f,0x10,0x02,0x11,0x00,0x40,0x00,
+0xc0,0x01,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x0f,0xe0,0x08,0x30,
+0x00,0x30,0x01,0xf0,0x0f,0x30,0x1c,0x30,0x18,0x30,0x18,0x30,0x1f,0xf0,0x0f,
+0x10,0x03,0x10,0x03,0xc0,0x02,0x40,0x04,0x20,0x00,0x00,0x00,0x00,0x03,0xc0,
+0x0f,0xe0,0x08,0x30,0x00,0x30,0x01,0xf0,0x0f,0x30,0x1c,0x30,0x18,0x30,0x18,
+0x30,0x1f,0xf0,0x0f,0x10,0x03,0x10,0x07,0x10,0x09,0xb0,0x08,0xe0,0x00,0x00,
+0x00,0x00,0x03,0xe0,0x0f,0xf0,0x00,0x30,0x00,0x18,0x00,0xf8,0x07,0x98,0x0c,
+0x18,0x18,0x18,0x18,0x38,0x1f,0xf8,0x07,0x98,0x03,0x10,0x06,0x60,0x06,0x60,
+0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x0f,0xe0,0x08,0x30,0x00,0x30,0x01,
+0xf0,0x0f,0x30,0x1c,0x30,0x18,0x30,0x18,0x30,0x1f,0xf0,0x0f,0x30,0x02,0x11,
+0x03,0xc0,0x02,0x40,0x02,0x40,0x03,0xc0,0x00,0x00,0x00,0x00,0x03,0xc0,0x0f,
+0xe0,0x08,0x30,0x00,0x30,0x01,0xf0,0x0f,0x30,0x1c,0x30,0x18,0x30,0x18,0x30,
+0x1f,0xf0,0x0f,0x10,0x08,0x0b,0x0e,0x70,0x1f,0x78,0x01,0x8c,0x01,0x8c,0x07,
+0xfc,0x1d,0xfc,0x31,0x80,0x31,0x80,0x31,0x80,0x3f,0xf8,0x1c,0x78,0x08,0x0f,
+0x03,0xe0,0x07,0xf8,0x0c,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x0c,0x08,0x07,0xf8,0x03,0xe0,0x00,0x80,0x00,0xc0,0x00,0x60,0x00,0xc0,
+0x02,0x11,0x04,0x00,0x06,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x07,
+0x80,0x0f,0xe0,0x18,0x60,0x30,0x30,0x3f,0xf0,0x3f,0xf0,0x30,0x00,0x30,0x00,
+0x18,0x00,0x0f,0xe0,0x07,0xc0,0x02,0x11,0x00,0x80,0x01,0x80,0x01,0x00,0x03,
+0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,0x60,0x30,0x30,0x3f,0xf0,
+0x3f,0xf0,0x30,0x00,0x30,0x00,0x18,0x00,0x0f,0xe0,0x07,0xc0,0x03,0x10,0x07,
+0x80,0x04,0x80,0x08,0x40,0x00,0x00,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,0x60,
+0x30,0x30,0x3f,0xf0,0x3f,0xf0,0x30,0x00,0x30,0x00,0x18,0x00,0x0f,0xe0,0x07,
+0xc0,0x03,0x10,0x0c,0xc0,0x0c,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,
+0x0f,0xe0,0x18,0x20,0x30,0x30,0x3f,0xf0,0x3f,0xf0,0x30,0x00,0x30,0x00,0x18,
+0x00,0x0f,0xe0,0x07,0xc0,0x02,0x11,0x03,0x00,0x01,0x80,0x01,0x80,0x00,0xc0,
+0x00,0x00,0x00,0x00,0x1f,0xc0,0x0f,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x02,0x11,0x00,0x20,
+0x00,0x60,0x00,0xc0,0x00,0x80,0x00,0x00,0x00,0x00,0x1f,0xc0,0x0f,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x02,0x11,0x00,0x80,0x01,0xc0,0x03,0x60,0x02,0x10,0x00,0x00,0x00,
+0x00,0x1f,0xc0,0x0f,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x03,0x10,0x06,0x60,0x06,0x60,0x00,
+0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x1f,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0x10,0x04,
+0x20,0x07,0xe0,0x03,0x80,0x06,0xc0,0x08,0x60,0x00,0x60,0x07,0xa0,0x1f,0xf0,
+0x18,0x70,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,
+0x80,0x03,0x10,0x06,0x20,0x09,0xe0,0x08,0xc0,0x00,0x00,0x00,0x00,0x11,0xc0,
+0x1f,0xe0,0x1c,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x02,0x11,0x04,0x00,0x06,0x00,0x02,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,0x80,0x02,0x11,0x00,0x80,
+0x01,0x80,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x0f,0xc0,0x18,
+0x60,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,
+0x07,0x80,0x03,0x10,0x07,0x80,0x04,0x80,0x08,0x40,0x00,0x00,0x00,0x00,0x07,
+0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x18,0x60,0x1f,0xc0,0x07,0x80,0x03,0x10,0x06,0x20,0x09,0xe0,0x08,0xc0,0x00,
+0x00,0x00,0x00,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,0x80,0x03,0x10,0x0c,0xc0,0x0c,
+0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,0x80,0x07,
+0x0a,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x1f,0xf0,0x1f,0xf0,0x00,0x00,
+0x00,0x00,0x01,0x80,0x01,0x80,0x08,0x0b,0x07,0xb0,0x1f,0xe0,0x18,0x60,0x30,
+0xf0,0x31,0xb0,0x33,0x30,0x36,0x30,0x3c,0x30,0x18,0x60,0x1f,0xe0,0x37,0x80,
+0x02,0x11,0x06,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0x00,0x00,0x00,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x70,0x0f,0xf0,0x07,0x10,0x02,0x11,0x00,0xc0,0x00,0xc0,0x01,0x80,0x01,
+0x00,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xf0,0x07,0x10,0x02,0x11,0x01,
+0x00,0x03,0x80,0x06,0xc0,0x04,0x60,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,
+0xf0,0x07,0x10,0x03,0x10,0x06,0x60,0x06,0x60,0x00,0x00,0x00,0x00,0x00,0x00,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x1c,0x70,0x0f,0xf0,0x07,0x10,0x02,0x16,0x00,0xc0,0x01,0xc0,0x01,0x80,
+0x03,0x00,0x00,0x00,0x00,0x00,0x30,0x10,0x10,0x30,0x18,0x30,0x08,0x20,0x0c,
+0x60,0x0c,0x60,0x04,0x40,0x06,0xc0,0x02,0x80,0x03,0x80,0x03,0x80,0x01,0x00,
+0x03,0x00,0x02,0x00,0x1e,0x00,0x1c,0x00,0x03,0x15,0x18,0x00,0x18,0x00,0x18,
+0x00,0x18,0x00,0x18,0x00,0x1b,0xc0,0x1f,0xe0,0x18,0x70,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x60,0x1f,0xe0,0x1b,0x80,0x18,0x00,0x18,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x03,0x15,0x0c,0xc0,0x0c,0xc0,0x00,0x00,
+0x00,0x00,0x00,0x00,0x30,0x30,0x30,0x20,0x18,0x20,0x18,0x60,0x08,0x40,0x0c,
+0x40,0x0c,0xc0,0x04,0x80,0x06,0x80,0x03,0x80,0x03,0x00,0x03,0x00,0x02,0x00,
+0x06,0x00,0x1c,0x00,0x38,0x00,0x01,0x12,0x0f,0xc0,0x0f,0xc0,0x00,0x00,0x03,
+0x00,0x07,0x80,0x07,0x80,0x04,0x80,0x04,0x80,0x0c,0xc0,0x08,0xc0,0x08,0x40,
+0x18,0x60,0x1f,0xe0,0x10,0x60,0x30,0x30,0x30,0x30,0x20,0x10,0x60,0x18,0x04,
+0x0f,0x07,0xe0,0x07,0xe0,0x00,0x00,0x00,0x00,0x03,0xc0,0x0f,0xe0,0x08,0x30,
+0x00,0x30,0x01,0xf0,0x0f,0x30,0x1c,0x30,0x18,0x30,0x18,0x30,0x1f,0xf0,0x07,
+0x10,0x00,0x13,0x0c,0x40,0x07,0xc0,0x03,0x80,0x00,0x00,0x03,0x00,0x03,0x80,
+0x02,0x80,0x06,0x80,0x04,0xc0,0x04,0xc0,0x0c,0x40,0x0c,0x60,0x08,0x60,0x1f,
+0xe0,0x18,0x30,0x10,0x30,0x30,0x30,0x30,0x10,0x30,0x18,0x03,0x10,0x04,0x20,
+0x06,0x60,0x03,0xc0,0x00,0x00,0x00,0x00,0x03,0xc0,0x0f,0xe0,0x08,0x30,0x00,
+0x30,0x01,0xf0,0x0f,0x30,0x1c,0x30,0x18,0x30,0x18,0x30,0x1f,0xf0,0x0f,0x10,
+0x04,0x14,0x03,0x80,0x03,0x80,0x02,0x80,0x02,0xc0,0x06,0xc0,0x06,0x40,0x04,
+0x60,0x0c,0x60,0x0c,0x60,0x0f,0xf0,0x18,0x30,0x18,0x18,0x18,0x18,0x30,0x18,
+0x30,0x0c,0x00,0x08,0x00,0x10,0x00,0x30,0x00,0x3c,0x00,0x1c,0x08,0x10,0x03,
+0xc0,0x0f,0xe0,0x08,0x30,0x00,0x30,0x01,0xf0,0x0f,0x30,0x1c,0x30,0x18,0x30,
+0x18,0x30,0x1f,0xf0,0x0f,0x30,0x00,0x20,0x00,0x40,0x00,0xc0,0x00,0xf0,0x00,
+0x70,0x00,0x13,0x00,0xc0,0x01,0x80,0x01,0x00,0x00,0x00,0x03,0xc0,0x0f,0xf0,
+0x1c,0x20,0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x18,0x00,0x1c,0x10,0x0f,0xf0,0x03,0xc0,0x02,0x11,0x00,0x20,
+0x00,0x60,0x00,0xc0,0x01,0x80,0x00,0x00,0x00,0x00,0x03,0xe0,0x07,0xf0,0x0c,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0c,0x10,0x07,0xf0,
+0x03,0xe0,0x00,0x13,0x03,0x80,0x02,0x40,0x04,0x20,0x00,0x00,0x03,0xc0,0x0f,
+0xf0,0x1c,0x20,0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+0x30,0x00,0x30,0x00,0x18,0x00,0x1c,0x10,0x0f,0xf0,0x03,0xc0,0x02,0x11,0x00,
+0x80,0x01,0xc0,0x03,0x60,0x02,0x30,0x00,0x00,0x00,0x00,0x03,0xe0,0x07,0xf0,
+0x0c,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0c,0x10,0x07,
+0xf0,0x03,0xe0,0x00,0x13,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x03,0xc0,
+0x0f,0xf0,0x1c,0x20,0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x1c,0x10,0x0f,0xf0,0x03,0xc0,0x03,0x10,
+0x00,0xc0,0x01,0xc0,0x00,0x80,0x00,0x00,0x00,0x00,0x03,0xe0,0x07,0xf0,0x0c,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0c,0x10,0x07,0xf0,
+0x03,0xe0,0x00,0x13,0x04,0x20,0x02,0xc0,0x01,0x80,0x00,0x00,0x03,0xc0,0x0f,
+0xf0,0x1c,0x20,0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+0x30,0x00,0x30,0x00,0x18,0x00,0x1c,0x10,0x0f,0xf0,0x03,0xc0,0x03,0x10,0x02,
+0x20,0x01,0xe0,0x01,0xc0,0x00,0x00,0x00,0x00,0x03,0xe0,0x07,0xf0,0x0c,0x00,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0c,0x10,0x07,0xf0,0x03,
+0xe0,0x00,0x13,0x04,0x40,0x06,0xc0,0x03,0x80,0x00,0x00,0x1f,0x80,0x1f,0xe0,
+0x18,0x70,0x18,0x30,0x18,0x10,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x10,0x18,0x30,0x18,0x60,0x1f,0xe0,0x1f,0x80,0x01,0x12,0x00,0x0c,
+0x00,0x0c,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x60,0x07,0x60,0x1f,
+0xe0,0x18,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x18,0x60,
+0x1f,0xe0,0x0f,0x60,0x04,0x0f,0x1f,0x80,0x1f,0xe0,0x18,0x70,0x18,0x30,0x18,
+0x18,0x18,0x18,0x1f,0x18,0x3f,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x30,
+0x18,0x70,0x1f,0xe0,0x1f,0x80,0x03,0x10,0x00,0x30,0x00,0x30,0x03,0xf8,0x03,
+0xf0,0x00,0x30,0x07,0xb0,0x0f,0xf0,0x18,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x18,0x70,0x1f,0xf0,0x0f,0x30,0x01,0x12,0x07,0xe0,0x07,
+0xe0,0x00,0x00,0x1f,0xf0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
+0x1f,0xe0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,
+0xe0,0x1f,0xf0,0x04,0x0f,0x07,0xe0,0x07,0xe0,0x00,0x00,0x00,0x00,0x03,0xc0,
+0x0f,0xf0,0x18,0x30,0x18,0x18,0x1f,0xf8,0x1f,0xf8,0x10,0x00,0x18,0x00,0x1c,
+0x00,0x0f,0xf0,0x03,0xe0,0x00,0x13,0x04,0x40,0x07,0xc0,0x03,0x80,0x00,0x00,
+0x1f,0xf0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,
+0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xe0,0x1f,0xf0,
+0x03,0x10,0x08,0x40,0x0c,0xc0,0x07,0x80,0x00,0x00,0x00,0x00,0x07,0x80,0x0f,
+0xe0,0x18,0x60,0x30,0x30,0x3f,0xf0,0x3f,0xf0,0x30,0x00,0x30,0x00,0x18,0x00,
+0x0f,0xe0,0x07,0xc0,0x00,0x13,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x1f,
+0xf0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,0xe0,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xe0,0x1f,0xf0,0x03,
+0x10,0x03,0x00,0x03,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x0f,0xe0,
+0x18,0x20,0x30,0x30,0x3f,0xf0,0x3f,0xf0,0x30,0x00,0x30,0x00,0x18,0x00,0x0f,
+0xe0,0x07,0xc0,0x04,0x14,0x1f,0xf0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,
+0x18,0x00,0x1f,0xc0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x1f,0xe0,0x1f,0xf0,0x00,0x60,0x00,0xc0,0x00,0xc0,0x00,0xf0,0x00,0x70,
+0x08,0x10,0x03,0xc0,0x0f,0xf0,0x18,0x30,0x18,0x18,0x1f,0xf8,0x1f,0xf8,0x10,
+0x00,0x18,0x00,0x1c,0x00,0x0f,0xf0,0x03,0xe0,0x00,0x40,0x00,0xc0,0x00,0xc0,
+0x00,0xf0,0x00,0x70,0x00,0x13,0x04,0x40,0x06,0xc0,0x03,0x80,0x00,0x00,0x1f,
+0xf0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,0xe0,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xe0,0x1f,0xf0,0x02,
+0x11,0x08,0x40,0x0c,0xc0,0x07,0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x07,0x80,
+0x0f,0xe0,0x18,0x60,0x30,0x30,0x3f,0xf0,0x3f,0xf0,0x30,0x00,0x30,0x00,0x18,
+0x00,0x0f,0xe0,0x07,0xc0,0x00,0x13,0x03,0x80,0x06,0xc0,0x04,0x40,0x00,0x00,
+0x03,0xc0,0x0f,0xf0,0x1c,0x20,0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0xf0,0x30,0xf0,0x30,0x30,0x30,0x30,0x18,0x30,0x18,0x30,0x0f,0xf0,0x03,0xc0,
+0x03,0x15,0x03,0xc0,0x02,0x40,0x04,0x20,0x00,0x00,0x00,0x00,0x07,0xf8,0x0f,
+0xf8,0x0c,0x60,0x18,0x30,0x18,0x30,0x0c,0x60,0x07,0xe0,0x0f,0xc0,0x18,0x00,
+0x0f,0x80,0x0f,0xf0,0x08,0x18,0x18,0x08,0x18,0x18,0x0f,0xf0,0x07,0xc0,0x00,
+0x13,0x04,0x60,0x07,0xc0,0x03,0x80,0x00,0x00,0x03,0xc0,0x0f,0xf0,0x1c,0x20,
+0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0xf0,0x30,0xf0,0x30,0x30,0x30,
+0x30,0x18,0x30,0x18,0x30,0x0f,0xf0,0x03,0xc0,0x03,0x15,0x04,0x20,0x06,0x60,
+0x03,0xc0,0x00,0x00,0x00,0x00,0x07,0xf8,0x0f,0xf8,0x0c,0x60,0x18,0x30,0x18,
+0x30,0x0c,0x60,0x07,0xe0,0x0f,0xc0,0x18,0x00,0x0f,0x80,0x0f,0xf0,0x08,0x18,
+0x18,0x08,0x18,0x18,0x0f,0xf0,0x07,0xc0,0x00,0x13,0x01,0x80,0x01,0x80,0x01,
+0x80,0x00,0x00,0x03,0xc0,0x0f,0xf0,0x1c,0x20,0x18,0x00,0x30,0x00,0x30,0x00,
+0x30,0x00,0x30,0xf0,0x30,0xf0,0x30,0x30,0x30,0x30,0x18,0x30,0x18,0x30,0x0f,
+0xf0,0x03,0xc0,0x03,0x15,0x01,0x80,0x03,0x80,0x01,0x00,0x00,0x00,0x00,0x00,
+0x07,0xf8,0x0f,0xf8,0x0c,0x60,0x18,0x30,0x18,0x30,0x0c,0x60,0x07,0xe0,0x0f,
+0xc0,0x18,0x00,0x0f,0x80,0x0f,0xf0,0x08,0x18,0x18,0x08,0x18,0x18,0x0f,0xf0,
+0x07,0xc0,0x04,0x14,0x03,0xc0,0x0f,0xf0,0x1c,0x20,0x18,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x30,0xf0,0x30,0xf0,0x30,0x30,0x30,0x30,0x18,0x30,0x18,0x30,
+0x0f,0xf0,0x03,0xc0,0x00,0x00,0x01,0x80,0x00,0xc0,0x00,0xc0,0x03,0x80,0x03,
+0x15,0x01,0xc0,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x07,0xf8,0x0f,0xf8,
+0x0c,0x60,0x18,0x30,0x18,0x30,0x0c,0x60,0x07,0xe0,0x0f,0xc0,0x18,0x00,0x0f,
+0x80,0x0f,0xf0,0x08,0x18,0x18,0x08,0x18,0x18,0x0f,0xf0,0x07,0xc0,0x00,0x13,
+0x03,0x80,0x06,0xc0,0x04,0x40,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x1f,0xf0,0x1f,0xf0,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x00,0x13,0x24,0x00,0x42,0x00,0x00,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x19,0xc0,0x1f,0xe0,
+0x1c,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x04,0x0f,0x18,0x18,0x18,0x18,0x18,0x18,0x3f,0xfc,0x3f,0xfc,
+0x18,0x18,0x1f,0xf8,0x1f,0xf8,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x03,0x10,0x18,0x00,0x18,0x00,0x3f,0xc0,0x3f,0xc0,
+0x18,0x00,0x19,0xe0,0x1b,0xf0,0x1c,0x38,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x13,0x06,0x20,0x0f,0xe0,
+0x08,0xc0,0x00,0x00,0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x1f,0xf0,0x1f,0xf0,0x03,0x10,0x03,0x10,0x04,0xf0,0x04,0x60,0x00,0x00,0x00,
+0x00,0x1f,0xc0,0x0f,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x01,0x12,0x0f,0xc0,0x0f,0xc0,0x00,
+0x00,0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1f,0xf0,0x1f,
+0xf0,0x04,0x0f,0x03,0xf0,0x03,0xf0,0x00,0x00,0x00,0x00,0x1f,0xc0,0x0f,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0x13,0x08,0x40,0x07,0xc0,0x03,0x80,0x00,0x00,0x1f,0xf0,
+0x1f,0xf0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1f,0xf0,0x1f,0xf0,0x03,0x10,
+0x06,0x10,0x02,0x30,0x03,0xe0,0x00,0x00,0x00,0x00,0x1f,0xc0,0x0f,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x04,0x14,0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x1f,0xf0,0x1f,0xf0,0x01,0x00,0x02,0x00,0x06,0x00,0x07,0x80,0x03,0x80,0x03,
+0x15,0x01,0x80,0x01,0xc0,0x00,0x80,0x00,0x00,0x00,0x00,0x1f,0x80,0x1f,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+0x80,0x00,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x03,0xc0,0x01,0xc0,0x00,0x13,
+0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x1f,0xf0,0x1f,0xf0,0x08,0x0b,0x1f,0xc0,0x0f,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x04,0x12,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,
+0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,
+0x18,0x60,0x18,0x60,0x00,0x60,0x00,0x60,0x01,0xc0,0x03,0x15,0x18,0x30,0x1c,
+0x70,0x08,0x20,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x00,
+0x30,0x00,0x30,0x00,0x30,0x00,0xe0,0x00,0xe0,0x00,0x13,0x01,0xc0,0x02,0x40,
+0x04,0x20,0x00,0x00,0x0f,0xf0,0x0f,0xf0,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x18,0x60,
+0x0f,0xe0,0x07,0x80,0x03,0x15,0x01,0xc0,0x03,0x60,0x02,0x30,0x00,0x00,0x00,
+0x00,0x1f,0xc0,0x0f,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x80,0x1f,
+0x80,0x1f,0x00,0x04,0x14,0x18,0x18,0x18,0x30,0x18,0x60,0x18,0xc0,0x19,0x80,
+0x1b,0x00,0x1b,0x80,0x1f,0x80,0x1c,0xc0,0x18,0xc0,0x18,0x60,0x18,0x20,0x18,
+0x30,0x18,0x18,0x18,0x18,0x00,0x00,0x01,0x00,0x00,0xc0,0x00,0xc0,0x03,0x80,
+0x03,0x15,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x30,0x18,
+0x60,0x18,0xc0,0x19,0x80,0x1b,0x00,0x1f,0x80,0x1c,0xc0,0x18,0x60,0x18,0x60,
+0x18,0x30,0x18,0x18,0x00,0x00,0x01,0x00,0x00,0xc0,0x00,0xc0,0x03,0x80,0x08,
+0x0b,0x18,0x30,0x18,0x60,0x18,0xc0,0x19,0x80,0x1b,0x00,0x1f,0x80,0x1c,0xc0,
+0x18,0x40,0x18,0x60,0x18,0x30,0x18,0x18,0x00,0x13,0x06,0x00,0x0c,0x00,0x08,
+0x00,0x00,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0f,
+0xf0,0x0f,0xf8,0x00,0x13,0x03,0x00,0x02,0x00,0x00,0x00,0x3f,0x00,0x1f,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0xf0,0x00,0xf0,0x04,0x14,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0f,0xf0,0x0f,0xf8,
+0x00,0x00,0x01,0x00,0x00,0xc0,0x00,0xc0,0x01,0x80,0x03,0x15,0x3f,0x00,0x1f,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0xf0,0x00,0xf0,0x00,
+0x00,0x00,0xc0,0x00,0x60,0x00,0x60,0x01,0xc0,0x02,0x11,0x00,0x60,0x00,0x60,
+0x0c,0x60,0x0c,0x60,0x0c,0x60,0x0c,0x40,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0f,0xf0,0x0f,0xf8,
+0x01,0x12,0x00,0x60,0x00,0x60,0x3f,0x60,0x1f,0x60,0x03,0x60,0x03,0x60,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x01,0xf0,0x00,0xf0,0x04,0x0f,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x38,0x0c,0x38,0x0c,0x10,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0f,0xf8,0x0f,0xf8,0x03,0x10,0x7e,0x00,0x3e,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x0c,0x06,0x1c,
+0x06,0x08,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x03,0xe0,0x01,0xe0,0x04,
+0x0f,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x60,0x0d,0xc0,
+0x0f,0x00,0x1c,0x00,0x3c,0x00,0x2c,0x00,0x0c,0x00,0x0c,0x00,0x0f,0xf0,0x0f,
+0xf8,0x03,0x10,0x3f,0x00,0x1f,0x00,0x03,0x00,0x03,0x00,0x03,0x20,0x03,0x60,
+0x03,0x80,0x07,0x00,0x1f,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x01,0xf0,0x00,0xf0,0x00,0x13,0x00,0xc0,0x01,0x80,0x01,0x00,0x00,0x00,
+0x18,0x30,0x1c,0x30,0x1c,0x30,0x1e,0x30,0x1a,0x30,0x1a,0x30,0x1b,0x30,0x19,
+0x30,0x19,0xb0,0x18,0xb0,0x18,0xb0,0x18,0xf0,0x18,0x70,0x18,0x70,0x18,0x30,
+0x02,0x11,0x00,0x40,0x00,0xc0,0x01,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0xc0,0x1f,0xe0,0x1c,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x04,0x14,0x18,0x30,0x1c,0x30,0x1c,0x30,0x1e,
+0x30,0x1a,0x30,0x1a,0x30,0x1b,0x30,0x19,0x30,0x19,0xb0,0x18,0xb0,0x18,0xb0,
+0x18,0x70,0x18,0x70,0x18,0x70,0x18,0x30,0x00,0x00,0x01,0x00,0x00,0xc0,0x00,
+0xc0,0x03,0x80,0x08,0x10,0x19,0xc0,0x1f,0xe0,0x1c,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x00,0x00,0x01,
+0x00,0x00,0xc0,0x00,0xc0,0x03,0x80,0x00,0x13,0x04,0x40,0x02,0xc0,0x01,0x80,
+0x00,0x00,0x18,0x30,0x1c,0x30,0x1c,0x30,0x1e,0x30,0x1a,0x30,0x1a,0x30,0x1b,
+0x30,0x19,0x30,0x19,0xb0,0x18,0xb0,0x18,0xb0,0x18,0xf0,0x18,0x70,0x18,0x70,
+0x18,0x30,0x03,0x10,0x04,0x60,0x06,0xc0,0x03,0x80,0x01,0x00,0x00,0x00,0x19,
+0xc0,0x1f,0xe0,0x1c,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x03,0x10,0x30,0x00,0x78,0x00,0x78,0x00,0x18,
+0x00,0x18,0x00,0x36,0x70,0x37,0xf8,0x67,0x0c,0x06,0x0c,0x06,0x0c,0x06,0x0c,
+0x06,0x0c,0x06,0x0c,0x06,0x0c,0x06,0x0c,0x06,0x0c,0x04,0x0f,0x19,0xc0,0x1f,
+0xe0,0x1c,0x30,0x18,0x30,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x10,0x18,0x30,0x18,0xf0,0x18,0xe0,0x08,0x10,0x19,
+0xc0,0x1f,0xe0,0x1c,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xf0,0x00,
+0xe0,0x01,0x12,0x0f,0xc0,0x0f,0xc0,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,0x30,
+0x18,0x30,0x30,0x10,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x10,0x18,0x30,0x18,0x30,0x0f,0xe0,0x07,0x80,0x04,0x0f,0x0f,0xc0,0x0f,0xc0,
+0x00,0x00,0x00,0x00,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,0x80,0x00,0x13,0x0c,0x40,
+0x07,0xc0,0x03,0x80,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,0x30,0x18,0x30,0x30,
+0x10,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x10,0x18,0x30,
+0x18,0x30,0x0f,0xe0,0x07,0x80,0x03,0x10,0x08,0x40,0x0c,0xc0,0x07,0xc0,0x00,
+0x00,0x00,0x00,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,0x10,
+0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,0x80,0x00,0x13,0x03,0x20,0x02,
+0x40,0x04,0x40,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,0x30,0x18,0x30,0x30,0x10,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x10,0x18,0x30,0x18,
+0x30,0x0f,0xe0,0x07,0x80,0x03,0x10,0x02,0x60,0x02,0x40,0x04,0x80,0x00,0x00,
+0x00,0x00,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,0x80,0x04,0x0f,0x07,0xfc,0x0f,0xf8,
+0x18,0xc0,0x10,0xc0,0x30,0xc0,0x30,0xc0,0x30,0xf0,0x30,0xf8,0x30,0xc0,0x30,
+0xc0,0x30,0xc0,0x18,0xc0,0x18,0xc0,0x0f,0xf8,0x07,0xfc,0x08,0x0b,0x0e,0x38,
+0x1f,0x7c,0x31,0xc4,0x31,0x86,0x31,0xfe,0x31,0xfe,0x31,0x80,0x31,0x80,0x31,
+0xc0,0x1f,0x7c,0x0e,0x3c,0x00,0x13,0x00,0x80,0x01,0x00,0x02,0x00,0x00,0x00,
+0x1f,0xc0,0x1f,0xe0,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x1f,
+0xe0,0x1f,0xc0,0x19,0x80,0x18,0xc0,0x18,0xc0,0x18,0x60,0x18,0x30,0x18,0x30,
+0x02,0x11,0x00,0x20,0x00,0x60,0x00,0xc0,0x01,0x80,0x00,0x00,0x00,0x00,0x0c,
+0xf0,0x0d,0xf0,0x0f,0x00,0x0e,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x04,0x14,0x1f,0xc0,0x1f,0xe0,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x1f,0xe0,0x1f,0xc0,0x18,0xc0,0x18,0xc0,
+0x18,0x60,0x18,0x60,0x18,0x30,0x18,0x30,0x00,0x00,0x01,0x00,0x00,0xc0,0x00,
+0xc0,0x03,0x80,0x08,0x10,0x0c,0xf0,0x0d,0xf0,0x0f,0x00,0x0e,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x08,
+0x00,0x06,0x00,0x06,0x00,0x1c,0x00,0x00,0x13,0x0c,0x40,0x06,0x80,0x03,0x80,
+0x00,0x00,0x1f,0xc0,0x1f,0xe0,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x1f,0xe0,0x1f,0xc0,0x19,0x80,0x18,0xc0,0x18,0xc0,0x18,0x60,0x18,0x30,
+0x18,0x30,0x03,0x10,0x06,0x30,0x03,0x60,0x01,0xc0,0x00,0x80,0x00,0x00,0x0c,
+0xf0,0x0d,0xf0,0x0f,0x00,0x0e,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x00,0x13,0x00,0xc0,0x01,0x80,0x00,0x00,0x00,
+0x00,0x07,0xc0,0x0f,0xe0,0x18,0x20,0x18,0x00,0x18,0x00,0x1c,0x00,0x0f,0x00,
+0x03,0xc0,0x00,0xe0,0x00,0x70,0x00,0x30,0x00,0x30,0x10,0x30,0x1f,0xe0,0x07,
+0xc0,0x02,0x11,0x00,0xc0,0x00,0xc0,0x01,0x80,0x03,0x00,0x00,0x00,0x00,0x00,
+0x07,0xc0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x0e,0x00,0x07,0xc0,0x00,0x70,0x00,
+0x30,0x10,0x30,0x1f,0xe0,0x07,0xc0,0x00,0x13,0x03,0x80,0x06,0xc0,0x04,0x40,
+0x00,0x00,0x07,0xc0,0x0f,0xe0,0x18,0x20,0x18,0x00,0x18,0x00,0x1c,0x00,0x0f,
+0x00,0x03,0xc0,0x00,0xe0,0x00,0x70,0x00,0x30,0x00,0x30,0x10,0x30,0x1f,0xe0,
+0x07,0xc0,0x02,0x11,0x01,0x00,0x03,0x80,0x06,0xc0,0x0c,0x40,0x00,0x00,0x00,
+0x00,0x07,0xc0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x0e,0x00,0x07,0xc0,0x00,0x70,
+0x00,0x30,0x10,0x30,0x1f,0xe0,0x07,0xc0,0x04,0x13,0x07,0xc0,0x0f,0xe0,0x18,
+0x20,0x18,0x00,0x18,0x00,0x1c,0x00,0x0f,0x00,0x03,0xc0,0x00,0xe0,0x00,0x70,
+0x00,0x30,0x00,0x30,0x10,0x30,0x1f,0xe0,0x07,0xc0,0x01,0x00,0x01,0x80,0x00,
+0xc0,0x01,0x80,0x08,0x0f,0x07,0xc0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x0e,0x00,
+0x07,0xc0,0x00,0x70,0x00,0x30,0x10,0x30,0x1f,0xe0,0x07,0xc0,0x02,0x00,0x03,
+0x00,0x01,0x80,0x03,0x80,0x00,0x13,0x04,0x40,0x06,0xc0,0x03,0x80,0x00,0x00,
+0x07,0xc0,0x0f,0xe0,0x18,0x20,0x18,0x00,0x18,0x00,0x1c,0x00,0x0f,0x00,0x03,
+0xc0,0x00,0xe0,0x00,0x70,0x00,0x30,0x00,0x30,0x10,0x30,0x1f,0xe0,0x07,0xc0,
+0x03,0x10,0x0c,0x40,0x07,0x80,0x03,0x80,0x00,0x00,0x00,0x00,0x07,0xc0,0x1f,
+0xe0,0x18,0x00,0x18,0x00,0x0e,0x00,0x07,0xc0,0x00,0x70,0x00,0x30,0x10,0x30,
+0x1f,0xe0,0x07,0xc0,0x04,0x14,0x3f,0xf8,0x3f,0xf8,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x07,
+0x00,0x04,0x13,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x3f,0xf0,0x3f,0xf0,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x03,
+0xf0,0x01,0xf0,0x00,0x80,0x00,0xc0,0x00,0x60,0x00,0xc0,0x00,0x13,0x08,0x40,
+0x06,0x80,0x03,0x80,0x00,0x00,0x3f,0xf8,0x3f,0xf8,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x12,0x00,0x60,0x00,0x60,0x00,0x60,0x06,
+0x60,0x06,0x60,0x06,0x40,0x06,0x00,0x3f,0xf0,0x3f,0xf0,0x06,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x03,0xf0,0x01,0xf0,0x04,
+0x0f,0x3f,0xf8,0x3f,0xf8,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x1f,0xe0,0x1f,0xe0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x04,0x0f,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x3f,0xf0,0x3f,0xf0,
+0x06,0x00,0x06,0x00,0x3f,0xe0,0x3f,0xe0,0x06,0x00,0x06,0x00,0x06,0x00,0x03,
+0xf0,0x01,0xf0,0x00,0x13,0x06,0x20,0x0f,0xe0,0x08,0xc0,0x00,0x00,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x0c,0x60,0x0f,0xe0,0x07,0xc0,0x03,0x10,
+0x06,0x20,0x09,0xe0,0x08,0xc0,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xf0,
+0x07,0x30,0x01,0x12,0x07,0xe0,0x07,0xe0,0x00,0x00,0x18,0x10,0x18,0x10,0x18,
+0x10,0x18,0x10,0x18,0x10,0x18,0x10,0x18,0x10,0x18,0x10,0x18,0x10,0x18,0x10,
+0x18,0x10,0x18,0x10,0x0c,0x20,0x0f,0xe0,0x07,0xc0,0x04,0x0f,0x07,0xe0,0x07,
+0xe0,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xd0,0x07,0x90,0x00,0x13,0x04,
+0x40,0x07,0xc0,0x03,0x80,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x0c,0x60,0x0f,0xe0,0x07,0xc0,0x03,0x10,0x0c,0x60,0x04,0x40,0x07,0xc0,
+0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xf0,0x07,0x10,0x00,0x13,0x03,0xc0,
+0x02,0x40,0x02,0x40,0x03,0xc0,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x0c,0x60,0x0f,0xe0,0x07,0xc0,0x02,0x11,0x03,0x80,0x04,0x40,0x04,0x40,0x03,
+0x80,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xf0,0x07,0x10,0x00,0x13,0x03,
+0x60,0x02,0x40,0x00,0x40,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x0c,0x60,0x0f,0xe0,0x07,0xc0,0x02,0x11,0x01,0x20,0x03,0x20,0x02,0x40,
+0x02,0x40,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xf0,0x07,0x10,0x04,0x14,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x0c,0x70,0x0f,0xe0,0x03,0xc0,
+0x01,0x80,0x03,0x00,0x03,0x00,0x03,0x80,0x01,0x80,0x08,0x10,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,
+0x0f,0xf0,0x07,0x10,0x00,0x20,0x00,0x40,0x00,0xc0,0x00,0xc0,0x00,0x70,0x00,
+0x13,0x03,0x00,0x05,0x80,0x08,0x40,0x00,0x00,0x60,0x18,0x60,0x18,0x60,0x18,
+0x60,0x18,0x63,0x10,0x23,0x10,0x23,0x30,0x37,0xb0,0x37,0xb0,0x34,0xb0,0x34,
+0xb0,0x3c,0xf0,0x1c,0xe0,0x18,0xe0,0x18,0x60,0x02,0x11,0x01,0x00,0x03,0x80,
+0x06,0xc0,0x0c,0x40,0x00,0x00,0x00,0x00,0x60,0x08,0x63,0x08,0x23,0x98,0x33,
+0x98,0x32,0x98,0x36,0x90,0x36,0x90,0x14,0xf0,0x1c,0xf0,0x1c,0x70,0x1c,0x60,
+0x00,0x13,0x03,0x00,0x05,0x80,0x08,0x40,0x00,0x00,0x20,0x30,0x30,0x30,0x10,
+0x60,0x18,0x60,0x08,0x40,0x0c,0xc0,0x0c,0x80,0x07,0x80,0x07,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x15,0x03,0x80,0x06,
+0xc0,0x0c,0x40,0x00,0x00,0x00,0x00,0x30,0x10,0x10,0x30,0x18,0x30,0x08,0x20,
+0x0c,0x60,0x0c,0x60,0x04,0x40,0x06,0xc0,0x02,0x80,0x03,0x80,0x03,0x80,0x01,
+0x00,0x03,0x00,0x02,0x00,0x1e,0x00,0x1c,0x00,0x01,0x12,0x0c,0xc0,0x0c,0xc0,
+0x00,0x00,0x30,0x30,0x30,0x30,0x10,0x60,0x18,0x60,0x08,0x40,0x0c,0xc0,0x04,
+0x80,0x07,0x80,0x07,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x00,0x13,0x00,0xc0,0x01,0x80,0x01,0x00,0x00,0x00,0x1f,0xf0,0x1f,
+0xf0,0x00,0x60,0x00,0x60,0x00,0xc0,0x01,0x80,0x01,0x80,0x03,0x00,0x06,0x00,
+0x06,0x00,0x0c,0x00,0x0c,0x00,0x18,0x00,0x3f,0xf0,0x3f,0xf0,0x02,0x11,0x00,
+0x40,0x00,0xc0,0x01,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x1f,0xf0,0x1f,0xf0,
+0x00,0x60,0x00,0xc0,0x01,0x80,0x03,0x00,0x06,0x00,0x0c,0x00,0x1c,0x00,0x3f,
+0xf0,0x3f,0xf0,0x00,0x13,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x1f,0xf0,
+0x1f,0xf0,0x00,0x60,0x00,0xc0,0x00,0xc0,0x01,0x80,0x03,0x80,0x03,0x00,0x06,
+0x00,0x06,0x00,0x0c,0x00,0x1c,0x00,0x18,0x00,0x3f,0xf0,0x3f,0xf0,0x03,0x10,
+0x03,0x00,0x03,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x1f,0xf0,0x1f,0xf0,0x00,
+0xe0,0x00,0xc0,0x01,0x80,0x03,0x00,0x06,0x00,0x0c,0x00,0x18,0x00,0x3f,0xf0,
+0x3f,0xf0,0x00,0x13,0x04,0x40,0x06,0xc0,0x03,0x80,0x00,0x00,0x1f,0xf0,0x1f,
+0xf0,0x00,0x60,0x00,0x60,0x00,0xc0,0x01,0x80,0x01,0x80,0x03,0x00,0x06,0x00,
+0x06,0x00,0x0c,0x00,0x0c,0x00,0x18,0x00,0x3f,0xf0,0x3f,0xf0,0x03,0x10,0x04,
+0x60,0x06,0xc0,0x03,0x80,0x01,0x00,0x00,0x00,0x1f,0xf0,0x1f,0xf0,0x00,0x60,
+0x00,0xc0,0x01,0x80,0x03,0x00,0x06,0x00,0x0c,0x00,0x1c,0x00,0x3f,0xf0,0x3f,
+0xf0,0x03,0x10,0x00,0xf8,0x01,0xf8,0x03,0x00,0x03,0x00,0x03,0x00,0x1f,0x00,
+0x0f,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x10,0x18,0x00,0x18,0x00,0x3f,0xc0,0x3f,0xc0,
+0x18,0x00,0x19,0xe0,0x1f,0xf0,0x1c,0x30,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x30,0x1f,0xe0,0x1b,0xc0,0x04,0x0f,0x07,0xc0,0x1f,0xf0,
+0x1b,0x38,0x33,0x18,0x33,0x08,0x33,0x0c,0x33,0x0c,0x1b,0x0c,0x0b,0x0c,0x03,
+0x0c,0x03,0x08,0x03,0x18,0x03,0x18,0x03,0xf0,0x03,0xc0,0x04,0x0f,0x07,0x80,
+0x0f,0xc0,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x30,0x00,0x30,0x3f,0xf0,0x3f,
+0xf0,0x30,0x30,0x30,0x30,0x10,0x20,0x18,0x60,0x0f,0xc0,0x07,0x80,0x04,0x11,
+0x00,0xf0,0x01,0xf0,0x01,0x80,0x01,0x00,0x03,0x00,0x0f,0xe0,0x0f,0xe0,0x03,
+0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x06,0x00,0x06,0x00,
+0x3c,0x00,0x38,0x00,0x01,0x12,0x00,0x38,0x00,0x78,0x00,0x60,0x03,0xe0,0x0f,
+0xf0,0x1c,0x20,0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x31,0xf0,0x30,0xf0,
+0x30,0x30,0x30,0x30,0x18,0x30,0x18,0x30,0x0f,0xf0,0x03,0xc0,0x01,0x12,0x00,
+0x18,0x00,0x18,0x00,0x18,0x07,0xf0,0x0f,0xe0,0x18,0x30,0x18,0x30,0x30,0x10,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x10,0x18,0x30,0x18,
+0x30,0x0f,0xe0,0x07,0x80,0x05,0x0e,0x00,0x18,0x00,0x18,0x00,0x10,0x07,0xf0,
+0x0f,0xe0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x18,
+0x60,0x1f,0xc0,0x07,0x80,0x01,0x12,0x00,0x06,0x00,0x06,0x00,0x0c,0x18,0x38,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x0c,0x60,0x0f,0xe0,0x07,0xc0,0x04,0x0f,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x08,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xf0,0x07,0x10,
+0x03,0x15,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,
+0x80,0x01,0x80,0x1f,0xf0,0x1f,0xf0,0x01,0x80,0x1f,0xf0,0x1f,0xf0,0x01,0x80,
+0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,
+0x13,0x0c,0x40,0x06,0xc0,0x03,0x80,0x00,0x00,0x03,0x00,0x03,0x80,0x02,0x80,
+0x06,0x80,0x04,0xc0,0x04,0xc0,0x0c,0x40,0x0c,0x60,0x08,0x60,0x1f,0xe0,0x18,
+0x30,0x10,0x30,0x30,0x30,0x30,0x10,0x30,0x18,0x02,0x11,0x04,0x20,0x06,0x60,
+0x03,0xc0,0x01,0x80,0x00,0x00,0x00,0x00,0x03,0xc0,0x0f,0xe0,0x08,0x30,0x00,
+0x30,0x01,0xf0,0x0f,0x30,0x1c,0x30,0x18,0x30,0x18,0x30,0x1f,0xf0,0x0f,0x10,
+0x00,0x13,0x08,0x40,0x06,0xc0,0x03,0x80,0x00,0x00,0x1f,0xf0,0x1f,0xf0,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x1f,0xf0,0x1f,0xf0,0x03,0x10,0x02,0x30,0x03,
+0x60,0x01,0xc0,0x00,0x80,0x00,0x00,0x1f,0xc0,0x0f,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0x13,0x0c,0x40,0x06,0xc0,0x03,0x80,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,0x30,
+0x18,0x30,0x30,0x10,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x10,0x18,0x30,0x18,0x30,0x0f,0xe0,0x07,0x80,0x02,0x11,0x08,0x40,0x0c,0xc0,
+0x07,0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,0x80,
+0x00,0x13,0x04,0x40,0x06,0xc0,0x03,0x80,0x00,0x00,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x0c,0x60,0x0f,0xe0,0x07,0xc0,0x03,0x10,0x04,0x40,0x03,
+0xc0,0x03,0x80,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xf0,0x07,0x10,0x01,
+0x12,0x0c,0x60,0x00,0x00,0x00,0x00,0x18,0x10,0x18,0x10,0x18,0x10,0x18,0x10,
+0x18,0x10,0x18,0x10,0x18,0x10,0x18,0x10,0x18,0x10,0x18,0x10,0x18,0x10,0x18,
+0x10,0x0c,0x20,0x0f,0xe0,0x07,0xc0,0x01,0x12,0x07,0xe0,0x07,0xc0,0x00,0x00,
+0x06,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xd0,0x07,0x90,
+0x01,0x12,0x0c,0x60,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x0c,0x60,0x0f,0xe0,0x07,0xc0,0x01,0x12,0x00,0x80,0x01,0x00,0x00,
+0x00,0x06,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xd0,0x07,
+0x90,0x01,0x12,0x0c,0x60,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x0c,0x60,0x0f,0xe0,0x07,0xc0,0x01,0x12,0x02,0xc0,0x01,0x80,
+0x00,0x00,0x06,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,0xd0,
+0x07,0x90,0x01,0x12,0x0c,0x60,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x0c,0x60,0x0f,0xe0,0x07,0xc0,0x01,0x12,0x03,0x00,0x01,
+0x80,0x00,0x00,0x06,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x0f,
+0xd0,0x07,0x90,0x01,0x12,0x01,0xf8,0x01,0xf8,0x00,0x00,0x03,0xf8,0x03,0xf8,
+0x03,0x80,0x07,0x80,0x05,0x80,0x0d,0x80,0x0d,0xf0,0x09,0xf8,0x19,0x80,0x1f,
+0x80,0x1f,0x80,0x31,0x80,0x31,0x80,0x21,0xf8,0x61,0xf8,0x04,0x0f,0x07,0xe0,
+0x07,0xe0,0x00,0x00,0x00,0x00,0x0e,0x70,0x1f,0x78,0x01,0x8c,0x01,0x8c,0x07,
+0xfc,0x1d,0xfc,0x31,0x80,0x31,0x80,0x31,0x80,0x3f,0xf8,0x1c,0x78,0x00,0x13,
+0x04,0x40,0x06,0xc0,0x03,0x80,0x00,0x00,0x03,0xc0,0x0f,0xf0,0x1c,0x20,0x18,
+0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0xf0,0x30,0xf0,0x30,0x30,0x30,0x30,
+0x18,0x30,0x18,0x30,0x0f,0xf0,0x03,0xc0,0x03,0x15,0x04,0x20,0x02,0x40,0x03,
+0xc0,0x00,0x00,0x00,0x00,0x07,0xf8,0x0f,0xf8,0x0c,0x60,0x18,0x30,0x18,0x30,
+0x0c,0x60,0x07,0xe0,0x0f,0xc0,0x18,0x00,0x0f,0x80,0x0f,0xf0,0x08,0x18,0x18,
+0x08,0x18,0x18,0x0f,0xf0,0x07,0xc0,0x04,0x13,0x07,0x80,0x0f,0xe0,0x18,0x30,
+0x18,0x30,0x30,0x10,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x30,0x18,0x30,0x1c,0x60,0x0f,0xc0,0x01,0x80,0x03,0x00,0x06,0x00,0x06,0x00,
+0x03,0x80,0x08,0x10,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x0f,0xe0,0x07,0x80,0x01,0x00,0x02,0x00,
+0x06,0x00,0x07,0x80,0x03,0x80,0x00,0x13,0x00,0xc0,0x01,0x80,0x01,0x00,0x00,
+0x00,0x03,0xc0,0x0f,0xf0,0x1c,0x20,0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+0x30,0xf0,0x30,0xf0,0x30,0x30,0x30,0x30,0x18,0x30,0x18,0x30,0x0f,0xf0,0x03,
+0xc0,0x02,0x16,0x00,0x40,0x00,0xc0,0x01,0x80,0x01,0x00,0x00,0x00,0x00,0x00,
+0x07,0xf8,0x0f,0xf8,0x0c,0x60,0x18,0x30,0x18,0x30,0x0c,0x60,0x07,0xe0,0x0f,
+0xc0,0x18,0x00,0x0f,0x80,0x0f,0xf0,0x08,0x18,0x18,0x08,0x18,0x18,0x0f,0xf0,
+0x07,0xc0,0x00,0x13,0x02,0x00,0x01,0x00,0x00,0x80,0x00,0x00,0x18,0x30,0x1c,
+0x30,0x1c,0x30,0x1e,0x30,0x1a,0x30,0x1a,0x30,0x1b,0x30,0x19,0x30,0x19,0xb0,
+0x18,0xb0,0x18,0xb0,0x18,0xf0,0x18,0x70,0x18,0x70,0x18,0x30,0x02,0x11,0x06,
+0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0x00,0x00,0x00,0x19,0xc0,0x1f,0xe0,
+0x1c,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x00,0x13,0x03,0x00,0x04,0x80,0x04,0x80,0x07,0x80,0x03,0x00,
+0x03,0x00,0x07,0x80,0x04,0x80,0x04,0x80,0x0c,0xc0,0x0c,0xc0,0x08,0x40,0x18,
+0x60,0x1f,0xe0,0x18,0x60,0x30,0x20,0x30,0x30,0x30,0x30,0x20,0x10,0x00,0x13,
+0x00,0x40,0x00,0x80,0x01,0xc0,0x02,0x40,0x02,0x40,0x03,0xc0,0x00,0x00,0x00,
+0x00,0x03,0xc0,0x0f,0xe0,0x08,0x30,0x00,0x30,0x01,0xf0,0x0f,0x30,0x1c,0x30,
+0x18,0x30,0x18,0x30,0x1f,0xf0,0x0f,0x10,0x00,0x13,0x00,0x30,0x00,0x60,0x00,
+0x40,0x00,0x00,0x01,0xfc,0x03,0xf8,0x03,0xc0,0x02,0xc0,0x06,0xc0,0x06,0xc0,
+0x0c,0xf0,0x0c,0xf8,0x0c,0xc0,0x1f,0xc0,0x1f,0xc0,0x10,0xc0,0x30,0xc0,0x30,
+0xf8,0x20,0xfc,0x02,0x11,0x00,0x40,0x00,0xc0,0x00,0x80,0x01,0x80,0x00,0x00,
+0x00,0x00,0x0e,0x70,0x1f,0x78,0x01,0x8c,0x01,0x8c,0x07,0xfc,0x1d,0xfc,0x31,
+0x80,0x31,0x80,0x31,0x80,0x3f,0xf8,0x1c,0x78,0x00,0x13,0x01,0x80,0x03,0x00,
+0x00,0x00,0x00,0x00,0x07,0xd8,0x0f,0xf0,0x18,0x70,0x18,0x70,0x30,0xf0,0x30,
+0xd8,0x31,0x98,0x33,0x18,0x33,0x18,0x36,0x18,0x3c,0x10,0x1c,0x30,0x18,0x30,
+0x1f,0xe0,0x37,0x80,0x02,0x11,0x00,0x80,0x01,0x80,0x01,0x00,0x02,0x00,0x00,
+0x00,0x00,0x00,0x07,0xb0,0x1f,0xe0,0x18,0x60,0x30,0xf0,0x31,0xb0,0x33,0x30,
+0x36,0x30,0x3c,0x30,0x18,0x60,0x1f,0xe0,0x37,0x80,0x04,0x14,0x07,0xc0,0x0f,
+0xe0,0x18,0x20,0x18,0x00,0x18,0x00,0x1c,0x00,0x0f,0x00,0x03,0xc0,0x00,0xe0,
+0x00,0x70,0x00,0x30,0x00,0x30,0x10,0x30,0x1f,0xe0,0x07,0xc0,0x00,0x00,0x03,
+0x00,0x01,0x80,0x01,0x80,0x07,0x00,0x08,0x10,0x07,0xc0,0x1f,0xe0,0x18,0x00,
+0x18,0x00,0x0e,0x00,0x07,0xc0,0x00,0x70,0x00,0x30,0x10,0x30,0x1f,0xe0,0x07,
+0xc0,0x00,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x07,0x00,0x04,0x14,0x3f,0xf8,
+0x3f,0xf8,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,
+0x02,0x00,0x01,0x80,0x01,0x80,0x07,0x00,0x04,0x14,0x06,0x00,0x06,0x00,0x06,
+0x00,0x06,0x00,0x3f,0xf0,0x3f,0xf0,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x03,0xf0,0x01,0xf0,0x00,0x00,0x01,0x80,0x00,
+0xc0,0x00,0xc0,0x01,0x80,0x08,0x10,0x1f,0xc0,0x0f,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0x80,0x1f,0x80,0x1f,0x00,0x04,0x0f,0x0f,0xc0,0x0f,0xe0,
+0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0f,0xe0,0x0f,0xe0,0x0c,0x30,0x0c,
+0x18,0x3f,0x18,0x3f,0x18,0x0c,0x18,0x0f,0xf0,0x0f,0xe0,0x03,0x05,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x0e,0x05,0x01,0x00,0x01,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x14,0x03,0x01,0x80,0x01,0x80,0x01,0xc0,0x08,0x10,
+0x01,0x00,0x03,0x80,0x03,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x80,0x03,0xc0,0x03,0xc0,0x00,0xc0,0x00,0x80,0x01,0x80,0x03,0x00,
+0x02,0x00,0x02,0x05,0x01,0x80,0x01,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x02,
+0x04,0x01,0x80,0x01,0x80,0x01,0x00,0x0d,0x60,0x03,0x10,0x10,0x00,0x33,0x80,
+0x33,0x80,0x33,0x80,0x22,0xc0,0x26,0xc0,0x24,0x40,0x04,0x40,0x0c,0x60,0x0c,
+0x60,0x0f,0xe0,0x18,0x30,0x18,0x30,0x18,0x30,0x10,0x10,0x30,0x18,0x08,0x04,
+0x01,0x00,0x03,0x80,0x03,0x80,0x01,0x00,0x03,0x10,0x20,0x00,0x37,0xf0,0x27,
+0xe0,0x26,0x00,0x26,0x00,0x66,0x00,0x66,0x00,0x07,0xc0,0x07,0xe0,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0xe0,0x07,0xf0,0x03,0x10,0x20,
+0x00,0x36,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x66,0x30,0x07,0xf0,
+0x07,0xf0,0x06,0x30,0x06,0x30,0x06,0x30,0x06,0x30,0x06,0x30,0x06,0x30,0x06,
+0x30,0x03,0x10,0x10,0x00,0x37,0xf0,0x37,0xf0,0x21,0x80,0x21,0x80,0x21,0x80,
+0x21,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,
+0x80,0x07,0xf0,0x07,0xf0,0x04,0x0f,0x31,0xc0,0x33,0xe0,0x26,0x30,0x24,0x30,
+0x2c,0x18,0x2c,0x18,0x0c,0x18,0x0c,0x18,0x0c,0x18,0x0c,0x18,0x0c,0x10,0x04,
+0x30,0x06,0x30,0x03,0xe0,0x01,0xc0,0x03,0x10,0x20,0x00,0x34,0x08,0x26,0x18,
+0x26,0x10,0x22,0x10,0x63,0x30,0x63,0x20,0x01,0x60,0x01,0xe0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x04,0x0f,0x31,0xc0,
+0x33,0xe0,0x36,0x30,0x24,0x10,0x2c,0x18,0x2c,0x18,0x0c,0x18,0x0c,0x18,0x0c,
+0x18,0x0c,0x18,0x04,0x10,0x06,0x10,0x06,0x30,0x0f,0x38,0x0f,0x38,0x02,0x11,
+0x01,0x80,0x01,0x00,0x0f,0x60,0x02,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x0f,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x01,0xf0,0x00,0xf0,0x04,0x0f,0x03,0x00,0x03,0x80,0x02,0x80,0x06,0x80,0x04,
+0xc0,0x04,0xc0,0x0c,0x40,0x0c,0x60,0x08,0x60,0x1f,0xe0,0x18,0x30,0x10,0x30,
+0x30,0x30,0x30,0x10,0x30,0x18,0x04,0x0f,0x1f,0xc0,0x1f,0xe0,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x60,0x1f,0xc0,0x1f,0xc0,0x18,0x30,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x30,0x1f,0xf0,0x1f,0xc0,0x04,0x0f,0x0f,0xf8,0x0f,0xf0,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x04,0x0f,0x03,0x80,0x03,
+0x80,0x02,0x80,0x06,0xc0,0x06,0xc0,0x04,0x40,0x0c,0x60,0x0c,0x60,0x08,0x20,
+0x18,0x30,0x18,0x30,0x18,0x30,0x30,0x18,0x3f,0xf8,0x3f,0xf8,0x04,0x0f,0x1f,
+0xf0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,0xe0,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xe0,0x1f,0xf0,0x04,
+0x0f,0x1f,0xf0,0x1f,0xf0,0x00,0x60,0x00,0x60,0x00,0xc0,0x01,0x80,0x01,0x80,
+0x03,0x00,0x06,0x00,0x06,0x00,0x0c,0x00,0x0c,0x00,0x18,0x00,0x3f,0xf0,0x3f,
+0xf0,0x04,0x0f,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x1f,0xf0,0x1f,0xf0,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x04,0x0f,0x07,0x80,0x0f,0xe0,0x18,0x30,0x18,0x30,0x30,0x10,
+0x30,0x18,0x37,0x98,0x37,0x98,0x30,0x18,0x30,0x18,0x30,0x10,0x18,0x30,0x18,
+0x70,0x0f,0xe0,0x07,0x80,0x04,0x0f,0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x1f,0xf0,0x1f,0xf0,0x04,0x0f,0x18,0x30,0x18,0x60,0x18,0x60,
+0x18,0xc0,0x19,0x80,0x1b,0x00,0x1b,0x80,0x1f,0x80,0x1c,0xc0,0x18,0xc0,0x18,
+0x60,0x18,0x60,0x18,0x30,0x18,0x30,0x18,0x18,0x04,0x0f,0x03,0x00,0x03,0x80,
+0x03,0x80,0x06,0x80,0x06,0xc0,0x04,0xc0,0x0c,0x40,0x0c,0x60,0x08,0x60,0x08,
+0x60,0x18,0x20,0x18,0x30,0x10,0x30,0x30,0x30,0x30,0x18,0x04,0x0f,0x1c,0x38,
+0x1c,0x38,0x1c,0x38,0x1c,0x78,0x1e,0x78,0x1a,0x58,0x1a,0x58,0x1b,0xd8,0x19,
+0x98,0x19,0x98,0x19,0x98,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x04,0x0f,
+0x18,0x30,0x1c,0x30,0x1c,0x30,0x1e,0x30,0x1a,0x30,0x1a,0x30,0x1b,0x30,0x19,
+0x30,0x19,0xb0,0x18,0xb0,0x18,0xb0,0x18,0xf0,0x18,0x70,0x18,0x70,0x18,0x30,
+0x04,0x0f,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,
+0xc0,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf0,
+0x3f,0xf0,0x04,0x0f,0x07,0x80,0x0f,0xe0,0x18,0x30,0x18,0x30,0x30,0x10,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x10,0x18,0x30,0x18,0x30,
+0x0f,0xe0,0x07,0x80,0x04,0x0f,0x1f,0xf0,0x1f,0xf0,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x04,0x0f,0x1f,0xc0,0x1f,0xe0,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x60,0x1f,0xc0,0x1e,0x00,0x18,0x00,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x04,0x0f,0x1f,0xf0,0x1f,0xf0,0x0c,
+0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x01,0x80,0x00,0x80,0x01,0x80,0x03,0x00,
+0x06,0x00,0x06,0x00,0x0c,0x00,0x1f,0xf8,0x1f,0xf8,0x04,0x0f,0x3f,0xf8,0x3f,
+0xf8,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x04,0x0f,0x20,
+0x30,0x30,0x30,0x10,0x60,0x18,0x60,0x08,0x40,0x0c,0xc0,0x0c,0x80,0x07,0x80,
+0x07,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x04,
+0x0f,0x01,0x80,0x01,0x80,0x07,0xe0,0x1d,0xf0,0x19,0x98,0x31,0x8c,0x31,0x8c,
+0x31,0x8c,0x31,0x8c,0x31,0x88,0x19,0x98,0x1d,0xf0,0x07,0xe0,0x01,0x80,0x01,
+0x80,0x04,0x0f,0x18,0x30,0x18,0x20,0x0c,0x60,0x0c,0x40,0x06,0xc0,0x06,0x80,
+0x03,0x80,0x03,0x00,0x03,0x80,0x06,0xc0,0x04,0xc0,0x0c,0x60,0x18,0x60,0x18,
+0x30,0x30,0x30,0x04,0x0f,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,
+0x33,0x30,0x33,0x30,0x1b,0x60,0x0f,0xe0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x04,0x0f,0x07,0xc0,0x0f,0xe0,0x18,0x30,0x18,0x30,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x10,0x10,0x18,
+0x30,0x08,0x20,0x3c,0x78,0x3c,0x78,0x01,0x12,0x0c,0xc0,0x0c,0xc0,0x00,0x00,
+0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1f,0xf0,0x1f,0xf0,
+0x01,0x12,0x0c,0xc0,0x0c,0xc0,0x00,0x00,0x30,0x30,0x30,0x30,0x10,0x60,0x18,
+0x60,0x08,0x40,0x0c,0xc0,0x04,0x80,0x07,0x80,0x07,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x02,0x11,0x01,0x80,0x01,0x80,0x01,
+0x80,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x30,0x1f,0xb0,0x18,0x70,0x30,0x70,
+0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x38,0xe0,0x1f,0xf0,0x0f,0x38,0x02,
+0x11,0x00,0xc0,0x00,0xc0,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x07,0xc0,
+0x0f,0xf0,0x18,0x00,0x18,0x00,0x0f,0x80,0x0f,0xc0,0x1c,0x00,0x18,0x00,0x18,
+0x00,0x0f,0xf0,0x07,0xe0,0x01,0x16,0x00,0x80,0x00,0xc0,0x00,0x80,0x01,0x80,
+0x01,0x80,0x00,0x00,0x00,0x00,0x19,0xc0,0x1f,0xe0,0x1c,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x00,0x30,
+0x00,0x30,0x00,0x30,0x00,0x30,0x01,0x12,0x01,0x80,0x01,0x80,0x01,0x00,0x03,
+0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x1f,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0xf0,0x01,0xf0,0x02,
+0x11,0x01,0x80,0x01,0x00,0x0d,0x60,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x20,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x60,0x0f,0xe0,0x07,0x80,0x08,0x0b,0x07,0x30,0x1f,0xb0,0x18,0x70,0x30,0x70,
+0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x38,0xe0,0x1f,0xf0,0x0f,0x38,0x03,
+0x14,0x07,0x80,0x0f,0xc0,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0xc0,
+0x19,0x80,0x19,0xe0,0x18,0x30,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x30,0x1f,
+0xf0,0x1b,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x08,0x0f,0x30,0x30,
+0x30,0x30,0x18,0x20,0x08,0x60,0x0c,0x60,0x0c,0x40,0x04,0xc0,0x06,0x80,0x07,
+0x80,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x10,
+0x0f,0xc0,0x1f,0xf0,0x18,0x00,0x18,0x00,0x0c,0x00,0x07,0x00,0x07,0x80,0x0c,
+0xc0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xe0,
+0x07,0x80,0x08,0x0b,0x07,0xc0,0x0f,0xf0,0x18,0x00,0x18,0x00,0x0f,0x80,0x0f,
+0xc0,0x1c,0x00,0x18,0x00,0x18,0x00,0x0f,0xf0,0x07,0xe0,0x03,0x14,0x0f,0xf0,
+0x0f,0xf0,0x00,0xc0,0x01,0x80,0x03,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x08,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0c,0x00,0x0f,0x00,0x03,0xe0,
+0x00,0x70,0x00,0x30,0x00,0x30,0x00,0x20,0x08,0x0f,0x19,0xc0,0x1f,0xe0,0x1c,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x03,0x10,0x03,0xc0,0x07,
+0xe0,0x0c,0x30,0x08,0x30,0x18,0x10,0x18,0x18,0x18,0x18,0x1f,0xf8,0x1f,0xf8,
+0x18,0x18,0x18,0x18,0x18,0x10,0x08,0x30,0x0c,0x30,0x07,0xe0,0x03,0xc0,0x08,
+0x0b,0x1f,0x00,0x1f,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x01,0xf0,0x01,0xf0,0x08,0x0b,0x18,0x30,0x18,0x70,0x18,
+0xc0,0x19,0x80,0x1b,0x00,0x1f,0x80,0x1c,0xc0,0x18,0xc0,0x18,0x60,0x18,0x30,
+0x18,0x38,0x03,0x10,0x1c,0x00,0x1e,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,
+0x80,0x03,0x80,0x03,0xc0,0x06,0xc0,0x06,0x40,0x04,0x60,0x0c,0x60,0x08,0x20,
+0x18,0x30,0x18,0x30,0x30,0x10,0x08,0x0f,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x70,0x1f,0xb0,0x1f,0x18,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x08,0x0b,0x30,0x10,0x18,0x30,0x18,
+0x30,0x0c,0x30,0x0c,0x60,0x06,0x60,0x06,0x40,0x02,0xc0,0x03,0x80,0x03,0x80,
+0x03,0x00,0x03,0x14,0x1f,0xf0,0x1f,0xf0,0x06,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x06,0x00,0x03,0xc0,0x07,0xc0,0x0c,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
+0x1c,0x00,0x0f,0x00,0x07,0xe0,0x00,0x70,0x00,0x30,0x00,0x30,0x00,0x20,0x08,
+0x0b,0x07,0x80,0x1f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x18,0x60,0x1f,0xe0,0x07,0x80,0x08,0x0b,0x3f,0xf8,0x3f,0xf8,0x0c,
+0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,
+0x0c,0x18,0x08,0x0f,0x03,0xc0,0x0f,0xe0,0x0c,0x20,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x60,0x1f,0xe0,0x1b,0xc0,0x18,0x00,0x18,0x00,
+0x18,0x00,0x18,0x00,0x08,0x0f,0x03,0xe0,0x07,0xf0,0x0c,0x00,0x18,0x00,0x18,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0e,0x00,0x07,0xc0,0x01,0xe0,0x00,0x30,
+0x00,0x30,0x00,0x20,0x00,0x60,0x08,0x0b,0x07,0xf8,0x1f,0xf8,0x18,0x60,0x30,
+0x20,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,0x80,
+0x08,0x0b,0x3f,0xf0,0x3f,0xf0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0xc0,0x01,0xc0,0x08,0x0b,0x18,0x20,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x60,0x0f,
+0xe0,0x07,0x80,0x05,0x12,0x01,0x00,0x03,0x00,0x03,0x00,0x0f,0xc0,0x1f,0xe0,
+0x1b,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x1b,0x30,0x1f,
+0xe0,0x0f,0xc0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x08,0x0f,0x10,0x30,
+0x18,0x60,0x0c,0x60,0x0c,0xc0,0x06,0xc0,0x07,0x80,0x03,0x80,0x03,0x00,0x03,
+0x80,0x06,0xc0,0x04,0xc0,0x0c,0x60,0x18,0x30,0x18,0x30,0x10,0x10,0x05,0x12,
+0x01,0x00,0x03,0x00,0x03,0x00,0x33,0x30,0x33,0x10,0x33,0x18,0x33,0x18,0x33,
+0x18,0x33,0x18,0x33,0x18,0x33,0x10,0x33,0x30,0x1f,0xe0,0x0f,0xc0,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x08,0x0b,0x08,0x30,0x18,0x30,0x18,0x10,0x30,
+0x18,0x31,0x98,0x31,0x98,0x31,0x98,0x31,0x98,0x31,0x98,0x1f,0xf0,0x0e,0x60,
+0x03,0x10,0x0c,0xc0,0x0c,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x1f,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x01,0xf0,0x00,0xf0,0x03,0x10,0x0c,0xc0,0x0c,0xc0,0x00,0x00,0x00,0x00,0x00,
+0x00,0x18,0x20,0x18,0x20,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x60,0x0f,0xe0,0x07,0x80,0x02,0x11,0x01,0x80,0x01,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x1f,0xc0,0x18,0x60,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xe0,0x07,0x80,0x01,
+0x12,0x00,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x18,0x20,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x60,0x0f,0xe0,0x07,0x80,0x01,0x12,0x00,0x80,0x00,0x80,0x00,0x80,
+0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x08,0x30,0x18,0x30,0x18,0x10,0x30,
+0x18,0x31,0x98,0x31,0x98,0x31,0x98,0x31,0x98,0x31,0x98,0x1f,0xf0,0x0e,0x60,
+0x03,0x10,0x07,0x80,0x0f,0xc0,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,
+0xc0,0x1b,0x80,0x1f,0xe0,0x18,0x30,0x18,0x18,0x18,0x18,0x18,0x18,0x0c,0x30,
+0x0f,0xf0,0x03,0xc0,0x03,0x10,0x07,0xc0,0x0f,0xe0,0x18,0x30,0x18,0x30,0x18,
+0x10,0x18,0x18,0x0c,0x18,0x07,0xf8,0x00,0x18,0x08,0x18,0x18,0x18,0x18,0x10,
+0x18,0x30,0x0c,0x30,0x0f,0xe0,0x07,0xc0,0x05,0x12,0x01,0x00,0x03,0x00,0x03,
+0x00,0x0f,0xc0,0x1f,0xe0,0x1b,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,
+0x33,0x30,0x1b,0x30,0x1f,0xe0,0x0f,0xc0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x08,0x0f,0x18,0x30,0x18,0x70,0x18,0xc0,0x19,0x80,0x1b,0x00,0x1f,0x80,
+0x1c,0xc0,0x18,0xc0,0x18,0x60,0x18,0x30,0x18,0x38,0x00,0x18,0x00,0x30,0x00,
+0x60,0x00,0xe0,0x08,0x0f,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x10,0x20,0x18,0x60,0x0f,0xc0,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x08,0x0e,0x03,0xf0,0x0f,0xf0,0x0c,0x00,0x18,0x00,
+0x18,0x00,0x18,0x00,0x18,0x00,0x1c,0x00,0x0e,0x00,0x07,0xc0,0x00,0xf0,0x00,
+0x30,0x00,0x30,0x00,0x60,0x08,0x0f,0x0f,0xf0,0x0f,0xf0,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0f,0xe0,0x0f,0xe0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x04,0x13,0x18,0x00,0x0c,0x00,0x06,0x00,
+0x03,0x00,0x01,0x80,0x01,0x80,0x01,0xc0,0x07,0xc0,0x1e,0x60,0x38,0x60,0x00,
+0x60,0x01,0xf0,0x07,0x30,0x0c,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x20,0x00,0x13,0x06,0x00,0x03,0x00,0x00,0x80,0x00,0x00,0x1f,0xf0,0x1f,
+0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,0xe0,0x18,0x00,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xe0,0x1f,0xf0,0x01,0x12,0x06,
+0xc0,0x06,0xc0,0x00,0x00,0x1f,0xf0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,
+0x18,0x00,0x1f,0xc0,0x1f,0xc0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x1f,0xe0,0x1f,0xf0,0x04,0x0f,0x3f,0xf0,0x3f,0xf0,0x06,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x07,0xf0,0x07,0xf8,0x06,0x0c,0x06,0x0c,0x06,0x0c,0x06,
+0x0c,0x06,0x0c,0x06,0x38,0x06,0x70,0x00,0x13,0x00,0xc0,0x01,0x80,0x03,0x00,
+0x00,0x00,0x0f,0xf8,0x0f,0xf0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x04,0x0f,0x03,0xc0,0x0f,0xf0,0x18,0x20,0x18,0x00,0x30,0x00,0x30,
+0x00,0x3f,0x80,0x3f,0xc0,0x30,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x18,0x10,
+0x0f,0xf0,0x03,0xc0,0x04,0x0f,0x07,0xc0,0x0f,0xe0,0x18,0x20,0x18,0x00,0x18,
+0x00,0x1c,0x00,0x0f,0x00,0x03,0xc0,0x00,0xe0,0x00,0x70,0x00,0x30,0x00,0x30,
+0x10,0x30,0x1f,0xe0,0x07,0xc0,0x04,0x0f,0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x1f,0xf0,0x1f,0xf0,0x01,0x12,0x0c,0xc0,0x0c,0xc0,0x00,
+0x00,0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1f,0xf0,0x1f,
+0xf0,0x04,0x0f,0x0f,0xf0,0x0f,0xf0,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x18,0x60,0x0f,
+0xe0,0x07,0x80,0x04,0x0f,0x1f,0x00,0x1f,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,
+0x1b,0x00,0x1b,0xe0,0x13,0xf0,0x13,0x38,0x13,0x18,0x13,0x18,0x33,0x18,0x33,
+0x30,0x63,0xf0,0x63,0xe0,0x04,0x0f,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x80,
+0x31,0x80,0x31,0x80,0x3f,0x80,0x3f,0xf8,0x31,0x98,0x31,0x8c,0x31,0x8c,0x31,
+0x8c,0x31,0x88,0x31,0xf8,0x31,0xf0,0x04,0x0f,0x3f,0xf0,0x3f,0xf0,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x07,0xf0,0x07,0xf8,0x06,0x1c,0x06,0x0c,0x06,
+0x0c,0x06,0x0c,0x06,0x0c,0x06,0x0c,0x06,0x0c,0x00,0x13,0x00,0xc0,0x01,0x80,
+0x01,0x00,0x00,0x00,0x18,0x38,0x18,0x30,0x18,0x60,0x18,0x40,0x18,0xc0,0x18,
+0x80,0x1f,0x80,0x1f,0x80,0x19,0x80,0x18,0xc0,0x18,0xc0,0x18,0x60,0x18,0x30,
+0x18,0x30,0x18,0x18,0x00,0x13,0x06,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x18,
+0x30,0x18,0x70,0x18,0x70,0x18,0xf0,0x18,0xb0,0x18,0xb0,0x19,0xb0,0x19,0x30,
+0x1b,0x30,0x1a,0x30,0x1a,0x30,0x1e,0x30,0x1c,0x30,0x1c,0x30,0x18,0x30,0x00,
+0x13,0x0c,0x60,0x0f,0xc0,0x07,0x80,0x00,0x00,0x30,0x18,0x30,0x10,0x18,0x30,
+0x18,0x30,0x08,0x60,0x0c,0x60,0x04,0x40,0x06,0xc0,0x06,0xc0,0x03,0x80,0x03,
+0x80,0x01,0x00,0x03,0x00,0x0e,0x00,0x1c,0x00,0x04,0x13,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1f,0xf8,0x1f,0xf8,0x01,0x80,0x01,0x80,
+0x01,0x80,0x01,0x80,0x04,0x0f,0x03,0x00,0x03,0x80,0x02,0x80,0x06,0x80,0x04,
+0xc0,0x04,0xc0,0x0c,0x40,0x0c,0x60,0x08,0x60,0x1f,0xe0,0x18,0x30,0x10,0x30,
+0x30,0x30,0x30,0x10,0x30,0x18,0x04,0x0f,0x1f,0xf0,0x1f,0xe0,0x18,0x00,0x18,
+0x00,0x18,0x00,0x18,0x00,0x1e,0x00,0x1f,0xe0,0x18,0x30,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x30,0x1f,0xf0,0x1f,0xc0,0x04,0x0f,0x1f,0xc0,0x1f,0xe0,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x60,0x1f,0xc0,0x1f,0xc0,0x18,0x30,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x30,0x1f,0xf0,0x1f,0xc0,0x04,0x0f,0x0f,0xf8,0x0f,
+0xf0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x04,0x14,0x07,
+0xf0,0x07,0xf0,0x06,0x30,0x06,0x30,0x04,0x30,0x04,0x30,0x04,0x30,0x0c,0x30,
+0x0c,0x30,0x0c,0x30,0x0c,0x30,0x08,0x30,0x18,0x30,0x3f,0xf8,0x3f,0xfc,0x30,
+0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x04,0x0f,0x1f,0xf0,0x1f,0xe0,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,0xe0,0x18,0x00,0x18,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xe0,0x1f,0xf0,0x04,0x0f,0x63,0x18,
+0x63,0x38,0x33,0x30,0x13,0x20,0x13,0x60,0x1b,0x60,0x1f,0xc0,0x1f,0xc0,0x1b,
+0x60,0x13,0x20,0x33,0x30,0x33,0x30,0x63,0x10,0x63,0x18,0x63,0x18,0x04,0x0f,
+0x07,0xc0,0x1f,0xe0,0x08,0x30,0x00,0x30,0x00,0x30,0x00,0x60,0x03,0xe0,0x07,
+0xe0,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x18,0x10,0x30,0x1f,0xf0,0x07,0xc0,
+0x04,0x0f,0x18,0x30,0x18,0x70,0x18,0x70,0x18,0xf0,0x18,0xb0,0x18,0xb0,0x19,
+0xb0,0x19,0x30,0x1b,0x30,0x1a,0x30,0x1a,0x30,0x1e,0x30,0x1c,0x30,0x1c,0x30,
+0x18,0x30,0x00,0x13,0x0c,0x60,0x07,0xe0,0x03,0xc0,0x00,0x00,0x18,0x30,0x18,
+0x70,0x18,0x70,0x18,0x70,0x18,0xb0,0x18,0xb0,0x19,0xb0,0x19,0x30,0x1b,0x30,
+0x1a,0x30,0x1a,0x30,0x1c,0x30,0x1c,0x30,0x1c,0x30,0x18,0x30,0x04,0x0f,0x18,
+0x38,0x18,0x30,0x18,0x60,0x18,0x40,0x18,0xc0,0x18,0x80,0x1f,0x80,0x1f,0x80,
+0x19,0x80,0x18,0xc0,0x18,0xc0,0x18,0x60,0x18,0x30,0x18,0x30,0x18,0x18,0x04,
+0x0f,0x07,0xf0,0x07,0xf0,0x04,0x30,0x04,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,
+0x0c,0x30,0x08,0x30,0x08,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x30,0x30,0x60,
+0x30,0x04,0x0f,0x1c,0x38,0x1c,0x38,0x1c,0x38,0x1c,0x78,0x1e,0x78,0x1a,0x58,
+0x1a,0x58,0x1b,0xd8,0x19,0x98,0x19,0x98,0x19,0x98,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x04,0x0f,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x1f,0xf0,0x1f,0xf0,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x04,0x0f,0x07,0x80,0x0f,0xe0,0x18,0x30,0x18,0x30,
+0x30,0x10,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x10,0x18,
+0x30,0x18,0x30,0x0f,0xe0,0x07,0x80,0x04,0x0f,0x1f,0xf0,0x1f,0xf0,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x04,0x0f,0x1f,0xc0,0x1f,0xe0,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x60,0x1f,0xc0,0x1e,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x04,0x0f,0x03,0xc0,
+0x0f,0xf0,0x1c,0x20,0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x1c,0x10,0x0f,0xf0,0x03,0xc0,0x04,0x0f,
+0x3f,0xf8,0x3f,0xf8,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x04,0x0f,0x30,0x10,0x10,0x30,0x18,0x30,0x18,0x20,0x0c,0x60,0x0c,0x60,0x04,
+0x40,0x06,0xc0,0x06,0x80,0x03,0x80,0x03,0x80,0x01,0x00,0x03,0x00,0x0e,0x00,
+0x0c,0x00,0x04,0x0f,0x01,0x80,0x01,0x80,0x07,0xe0,0x1d,0xf0,0x19,0x98,0x31,
+0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x19,0x98,0x1d,0xf0,0x07,0xe0,
+0x01,0x80,0x01,0x80,0x04,0x0f,0x18,0x30,0x18,0x20,0x0c,0x60,0x0c,0x40,0x06,
+0xc0,0x06,0x80,0x03,0x80,0x03,0x00,0x03,0x80,0x06,0xc0,0x04,0xc0,0x0c,0x60,
+0x18,0x60,0x18,0x30,0x30,0x30,0x04,0x13,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x1f,0xf8,0x1f,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x04,0x0f,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x18,0x30,0x0f,0xf0,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+0x30,0x00,0x30,0x04,0x0f,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,
+0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,
+0x30,0x3f,0xf0,0x3f,0xf0,0x04,0x13,0x33,0x18,0x33,0x18,0x33,0x18,0x33,0x18,
+0x33,0x18,0x33,0x18,0x33,0x18,0x33,0x18,0x33,0x18,0x33,0x18,0x33,0x18,0x33,
+0x18,0x33,0x18,0x3f,0xf8,0x3f,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x04,0x0f,0x3f,0x00,0x3f,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0xf0,0x03,0x18,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x18,0x03,0xf8,
+0x03,0xf0,0x04,0x0f,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x3f,0x30,0x33,0xb0,0x31,0xb0,0x31,0xb0,0x31,0xb0,0x31,0xb0,
+0x3f,0x30,0x3e,0x30,0x04,0x0f,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x18,0x00,0x1e,0x00,0x1f,0xe0,0x18,0x30,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x30,0x1f,0xf0,0x1f,0xc0,0x04,0x0f,0x0f,0x00,0x3f,0xc0,0x10,0x60,0x00,
+0x60,0x00,0x20,0x00,0x30,0x07,0xf0,0x0f,0xf0,0x00,0x30,0x00,0x30,0x00,0x20,
+0x00,0x60,0x20,0x60,0x3f,0xc0,0x0f,0x00,0x04,0x0f,0x31,0xe0,0x33,0xf0,0x33,
+0x30,0x32,0x18,0x36,0x18,0x36,0x18,0x3e,0x18,0x3e,0x18,0x36,0x18,0x36,0x18,
+0x36,0x18,0x32,0x18,0x33,0x30,0x33,0xf0,0x31,0xe0,0x04,0x0f,0x0f,0xe0,0x1f,
+0xe0,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x1f,0xe0,0x0f,0xe0,
+0x04,0x60,0x0c,0x60,0x18,0x60,0x18,0x60,0x30,0x60,0x30,0x60,0x08,0x0b,0x03,
+0xc0,0x0f,0xe0,0x08,0x30,0x00,0x30,0x01,0xf0,0x0f,0x30,0x1c,0x30,0x18,0x30,
+0x18,0x30,0x1f,0xf0,0x0f,0x10,0x02,0x11,0x00,0x10,0x01,0xf0,0x07,0xc0,0x0e,
+0x00,0x0c,0x00,0x08,0x00,0x19,0xc0,0x1f,0xf0,0x1c,0x30,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x08,0x10,0x0c,0x30,0x07,0xe0,0x03,0xc0,0x08,0x0b,0x1f,
+0xc0,0x1f,0xe0,0x18,0x30,0x18,0x30,0x1f,0xe0,0x1f,0xe0,0x18,0x30,0x18,0x30,
+0x18,0x30,0x1f,0xf0,0x1f,0xc0,0x08,0x0b,0x0f,0xf0,0x0f,0xe0,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x08,0x0f,0x0f,0xe0,0x0f,0xe0,0x0c,0x60,0x0c,0x60,0x08,0x60,0x08,0x60,0x08,
+0x60,0x08,0x60,0x18,0x60,0x3f,0xf0,0x3f,0xf8,0x30,0x18,0x30,0x18,0x30,0x18,
+0x20,0x10,0x08,0x0b,0x07,0x80,0x0f,0xe0,0x18,0x60,0x30,0x30,0x3f,0xf0,0x3f,
+0xf0,0x30,0x00,0x30,0x00,0x18,0x00,0x0f,0xe0,0x07,0xc0,0x08,0x0b,0x63,0x18,
+0x73,0x30,0x13,0x20,0x13,0x60,0x1f,0xe0,0x1f,0xe0,0x13,0x60,0x33,0x20,0x33,
+0x30,0x63,0x10,0x63,0x18,0x08,0x0b,0x07,0xc0,0x1f,0xe0,0x00,0x30,0x00,0x30,
+0x03,0xe0,0x07,0xe0,0x00,0x70,0x00,0x30,0x10,0x30,0x1f,0xe0,0x07,0xc0,0x08,
+0x0b,0x18,0x30,0x18,0x70,0x18,0xf0,0x18,0xb0,0x19,0xb0,0x19,0x30,0x1b,0x30,
+0x1a,0x30,0x1c,0x30,0x1c,0x30,0x18,0x30,0x03,0x10,0x0c,0x60,0x0c,0x60,0x07,
+0xc0,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x70,0x18,0xf0,0x18,0xb0,0x19,0xb0,
+0x19,0x30,0x1b,0x30,0x1a,0x30,0x1c,0x30,0x1c,0x30,0x18,0x30,0x08,0x0b,0x18,
+0x30,0x18,0x60,0x18,0x40,0x18,0xc0,0x1f,0x80,0x1f,0x80,0x18,0xc0,0x18,0xc0,
+0x18,0x60,0x18,0x30,0x18,0x30,0x08,0x0b,0x07,0xf0,0x07,0xf0,0x04,0x30,0x04,
+0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x08,0x30,0x18,0x30,0x30,0x30,
+0x08,0x0b,0x30,0x30,0x38,0x70,0x38,0x70,0x3c,0x70,0x3c,0xf0,0x34,0xb0,0x37,
+0xb0,0x37,0xb0,0x33,0x30,0x33,0x30,0x30,0x30,0x08,0x0b,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x1f,0xf0,0x1f,0xf0,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x08,0x0b,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,0x80,0x08,0x0b,0x1f,
+0xf0,0x1f,0xf0,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x18,0x30,0x08,0x10,0x1b,0xc0,0x1f,0xe0,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x60,0x1f,0xe0,0x1b,0x80,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x08,0x0b,0x03,0xe0,0x07,
+0xf0,0x0c,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0c,0x10,
+0x07,0xf0,0x03,0xe0,0x08,0x0b,0x3f,0xf0,0x3f,0xf0,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x08,0x10,
+0x30,0x10,0x10,0x30,0x18,0x30,0x08,0x20,0x0c,0x60,0x0c,0x60,0x04,0x40,0x06,
+0xc0,0x02,0x80,0x03,0x80,0x03,0x80,0x01,0x00,0x03,0x00,0x02,0x00,0x1e,0x00,
+0x1c,0x00,0x03,0x15,0x01,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x0f,
+0xf0,0x1f,0xf8,0x11,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,
+0x31,0x98,0x1f,0xf8,0x0f,0xf0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,
+0x80,0x08,0x0b,0x18,0x30,0x0c,0x60,0x0c,0x40,0x06,0xc0,0x03,0x80,0x03,0x80,
+0x07,0x80,0x04,0xc0,0x0c,0x40,0x18,0x60,0x18,0x30,0x08,0x0f,0x18,0x30,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x1f,0xf8,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x08,0x08,0x0b,0x18,
+0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x0f,0xf0,0x07,0xf0,0x00,0x30,
+0x00,0x30,0x00,0x30,0x00,0x30,0x08,0x0b,0x33,0x30,0x33,0x30,0x33,0x30,0x33,
+0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x3f,0xf0,
+0x08,0x0f,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x33,
+0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x3f,0xf8,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x08,0x08,0x0b,0x3e,0x00,0x3e,0x00,0x06,0x00,0x06,0x00,0x07,0xc0,0x07,
+0xe0,0x06,0x30,0x06,0x30,0x06,0x30,0x07,0xe0,0x07,0xc0,0x08,0x0b,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x3e,0x30,0x3f,0x30,0x31,0xb0,0x31,0xb0,0x31,
+0xb0,0x37,0x30,0x3e,0x30,0x08,0x0b,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0f,0xc0,0x0f,0xe0,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0xe0,0x0f,0xc0,0x08,
+0x0b,0x0f,0x80,0x1f,0xc0,0x00,0x60,0x00,0x30,0x07,0xf0,0x07,0xf0,0x00,0x30,
+0x00,0x30,0x00,0x60,0x1f,0xc0,0x0f,0x80,0x08,0x0b,0x31,0xe0,0x33,0xf0,0x33,
+0x18,0x36,0x18,0x3e,0x18,0x3e,0x18,0x36,0x18,0x36,0x18,0x33,0x18,0x33,0xf0,
+0x31,0xe0,0x08,0x0b,0x07,0xf0,0x0f,0xf0,0x18,0x30,0x18,0x30,0x18,0x30,0x0f,
+0xf0,0x07,0xf0,0x06,0x30,0x0c,0x30,0x0c,0x30,0x18,0x30,0x02,0x11,0x04,0x00,
+0x06,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,
+0x60,0x30,0x30,0x3f,0xf0,0x3f,0xf0,0x30,0x00,0x30,0x00,0x18,0x00,0x0f,0xe0,
+0x07,0xc0,0x03,0x10,0x0c,0xc0,0x0c,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+0xc0,0x0f,0xe0,0x18,0x20,0x30,0x30,0x3f,0xf0,0x3f,0xf0,0x30,0x00,0x30,0x00,
+0x18,0x00,0x0f,0xe0,0x07,0xc0,0x03,0x15,0x18,0x00,0x18,0x00,0x3f,0xc0,0x3f,
+0xc0,0x18,0x00,0x19,0xc0,0x1b,0xe0,0x1c,0x30,0x18,0x10,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x10,0x00,0x30,0x00,
+0x30,0x00,0xe0,0x01,0xc0,0x02,0x11,0x00,0x60,0x00,0xe0,0x00,0xc0,0x01,0x80,
+0x00,0x00,0x00,0x00,0x0f,0xf0,0x0f,0xe0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x08,0x0b,0x03,0xe0,
+0x07,0xf0,0x0c,0x00,0x18,0x00,0x1f,0xc0,0x1f,0xc0,0x18,0x00,0x18,0x00,0x0c,
+0x00,0x0f,0xf0,0x03,0xe0,0x08,0x0b,0x07,0xc0,0x1f,0xe0,0x18,0x00,0x18,0x00,
+0x0e,0x00,0x07,0xc0,0x00,0x70,0x00,0x30,0x10,0x30,0x1f,0xe0,0x07,0xc0,0x03,
+0x10,0x00,0x80,0x01,0xc0,0x01,0x80,0x00,0x00,0x00,0x00,0x1f,0xc0,0x1f,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x04,0x0f,0x06,0x60,0x06,0x60,0x00,0x00,0x00,0x00,0x1f,0x80,
+0x1f,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,
+0x80,0x01,0x80,0x01,0x80,0x03,0x15,0x00,0x80,0x01,0xc0,0x01,0x80,0x00,0x00,
+0x00,0x00,0x1f,0xc0,0x1f,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x80,
+0x1f,0x80,0x1f,0x00,0x08,0x0b,0x1f,0x00,0x1f,0x00,0x1b,0x00,0x1b,0x00,0x1b,
+0xe0,0x1b,0xf0,0x1b,0x18,0x1b,0x18,0x33,0x18,0x73,0xf0,0x63,0xe0,0x08,0x0b,
+0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x3f,0xe0,0x3f,0xf0,0x33,0x30,0x33,
+0x30,0x33,0x30,0x33,0x70,0x33,0xe0,0x03,0x10,0x18,0x00,0x18,0x00,0x3f,0xc0,
+0x3f,0xc0,0x18,0x00,0x19,0xe0,0x1b,0xf0,0x1c,0x38,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x02,0x11,0x00,0x40,
+0x00,0xc0,0x01,0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x60,0x18,
+0x40,0x18,0xc0,0x1f,0x80,0x1f,0x80,0x18,0xc0,0x18,0xc0,0x18,0x60,0x18,0x30,
+0x18,0x30,0x02,0x11,0x06,0x00,0x07,0x00,0x03,0x00,0x01,0x80,0x00,0x00,0x00,
+0x00,0x18,0x30,0x18,0x70,0x18,0xf0,0x18,0xb0,0x19,0xb0,0x19,0x30,0x1b,0x30,
+0x1a,0x30,0x1c,0x30,0x1c,0x30,0x18,0x30,0x03,0x15,0x00,0x40,0x0c,0x60,0x07,
+0xc0,0x07,0x80,0x00,0x00,0x30,0x18,0x10,0x30,0x18,0x30,0x18,0x20,0x0c,0x60,
+0x0c,0x60,0x04,0x40,0x06,0xc0,0x02,0x80,0x03,0x80,0x01,0x80,0x01,0x00,0x03,
+0x00,0x02,0x00,0x1e,0x00,0x3c,0x00,0x08,0x0f,0x18,0x60,0x18,0x60,0x18,0x60,
+0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x1f,
+0xe0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x10,0x04,0x00,0x06,0x00,
+0x06,0x00,0x3f,0xe0,0x3f,0xe0,0x06,0x00,0x06,0x00,0x07,0x00,0x07,0xf0,0x06,
+0x38,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0xf0,0x07,0xe0,0x05,0x0e,
+0x06,0x00,0x06,0x00,0x06,0x00,0x3f,0xe0,0x3f,0xe0,0x06,0x00,0x06,0x00,0x07,
+0xe0,0x07,0xf0,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x70,0x07,0xe0,0x04,0x0f,
+0x07,0x80,0x0f,0xe0,0x18,0x30,0x18,0x30,0x30,0x10,0x30,0x18,0x3f,0xf8,0x3f,
+0xf8,0x30,0x18,0x30,0x18,0x30,0x10,0x10,0x30,0x18,0x30,0x0f,0xe0,0x07,0x80,
+0x08,0x0b,0x07,0x80,0x1f,0xe0,0x18,0x60,0x30,0x30,0x3f,0xf0,0x3f,0xf0,0x30,
+0x30,0x30,0x30,0x18,0x60,0x1f,0xe0,0x07,0x80,0x04,0x0f,0x30,0x18,0x30,0x38,
+0x10,0x30,0x18,0x20,0x18,0x60,0x18,0x60,0x08,0x60,0x0c,0x40,0x0c,0xc0,0x04,
+0xc0,0x06,0xc0,0x06,0x80,0x07,0x80,0x03,0x80,0x03,0x00,0x08,0x0b,0x10,0x38,
+0x18,0x30,0x18,0x60,0x08,0x60,0x0c,0x40,0x0c,0xc0,0x04,0xc0,0x06,0x80,0x06,
+0x80,0x03,0x80,0x03,0x00,0x01,0x12,0x00,0x18,0x00,0x18,0x00,0x18,0x0f,0xf8,
+0x0f,0xf0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x04,0x0f,
+0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x60,0x0f,0xe0,0x0f,0xe0,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x04,0x0f,0x0f,0xf0,0x0f,0xf0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x3f,0x80,0x3f,0x80,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x08,0x0b,0x0f,0xf8,0x0f,0xf0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x1f,
+0xc0,0x1f,0xc0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x04,0x13,0x63,0x18,
+0x63,0x38,0x33,0x30,0x13,0x20,0x13,0x60,0x1b,0x60,0x1f,0xc0,0x1f,0xc0,0x1b,
+0x60,0x13,0x60,0x33,0x30,0x33,0x30,0x63,0x30,0x63,0x1c,0x63,0x1c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x08,0x0f,0x63,0x18,0x73,0x38,0x13,0x20,0x13,
+0x60,0x1f,0xe0,0x1f,0xe0,0x13,0x60,0x33,0x20,0x33,0x30,0x63,0x10,0x63,0x1c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x04,0x13,0x07,0xc0,0x1f,0xe0,0x08,
+0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x03,0xe0,0x07,0xe0,0x00,0x70,0x00,0x18,
+0x00,0x18,0x00,0x18,0x10,0x10,0x18,0x30,0x0f,0xe0,0x01,0x80,0x01,0x80,0x01,
+0x80,0x01,0x80,0x08,0x0f,0x0f,0x80,0x1f,0xe0,0x00,0x60,0x00,0x60,0x00,0xe0,
+0x07,0xc0,0x07,0xe0,0x00,0x30,0x00,0x30,0x30,0x60,0x1f,0xe0,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x04,0x13,0x18,0x30,0x18,0x70,0x18,0x40,0x18,0xc0,
+0x18,0x80,0x19,0x80,0x1f,0x00,0x1f,0x00,0x19,0x80,0x18,0xc0,0x18,0xc0,0x18,
+0x60,0x18,0x60,0x18,0x38,0x18,0x38,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+0x08,0x0f,0x18,0x30,0x18,0x60,0x18,0xc0,0x18,0x80,0x1f,0x80,0x1f,0x80,0x18,
+0x80,0x18,0xc0,0x18,0x40,0x18,0x60,0x18,0x38,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x18,0x04,0x0f,0x3f,0x0c,0x3f,0x1c,0x03,0x10,0x03,0x30,0x03,0x30,0x03,
+0x20,0x03,0xe0,0x03,0xe0,0x03,0x60,0x03,0x30,0x03,0x30,0x03,0x18,0x03,0x18,
+0x03,0x0c,0x03,0x04,0x08,0x0b,0x7e,0x18,0x3e,0x30,0x06,0x20,0x06,0x60,0x07,
+0xc0,0x07,0xc0,0x06,0x60,0x06,0x20,0x06,0x30,0x06,0x10,0x06,0x18,0x04,0x13,
+0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x1f,0xf0,0x1f,
+0xf0,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x3c,0x18,0x3c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x08,0x0f,0x18,0x30,0x18,0x30,0x18,
+0x30,0x18,0x30,0x1f,0xf0,0x1f,0xf0,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x38,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x04,0x13,0x03,0xc0,0x0f,
+0xf0,0x1c,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+0x30,0x00,0x30,0x00,0x18,0x00,0x0c,0x30,0x0f,0xe0,0x03,0xc0,0x01,0x80,0x01,
+0x80,0x01,0x80,0x01,0x80,0x08,0x0f,0x03,0xe0,0x07,0xf0,0x0c,0x00,0x18,0x00,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0c,0x00,0x0e,0x30,0x07,0xe0,0x01,
+0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x04,0x0f,0x20,0x30,0x30,0x30,0x10,0x60,
+0x18,0x60,0x08,0x40,0x0c,0xc0,0x0c,0x80,0x07,0x80,0x07,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x08,0x10,0x30,0x30,0x30,0x30,
+0x10,0x60,0x18,0x60,0x18,0x40,0x08,0xc0,0x0c,0xc0,0x0c,0x80,0x05,0x80,0x07,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x04,0x0f,
+0x30,0x30,0x30,0x30,0x18,0x20,0x18,0x60,0x08,0x40,0x0c,0xc0,0x04,0xc0,0x06,
+0x80,0x07,0x80,0x1f,0xe0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x08,0x10,0x30,0x30,0x10,0x20,0x18,0x60,0x18,0x60,0x08,0x40,0x0c,0xc0,0x0c,
+0xc0,0x04,0x80,0x07,0x80,0x07,0x80,0x1f,0xe0,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x04,0x13,0x30,0x30,0x18,0x60,0x18,0x60,0x0c,0xc0,0x04,
+0xc0,0x07,0x80,0x03,0x00,0x03,0x00,0x07,0x80,0x04,0x80,0x0c,0xc0,0x08,0xc0,
+0x18,0x60,0x10,0x78,0x30,0x38,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x08,
+0x0f,0x18,0x30,0x08,0x60,0x0c,0x40,0x06,0xc0,0x07,0x80,0x03,0x00,0x07,0x80,
+0x06,0x80,0x0c,0xc0,0x18,0x60,0x10,0x38,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
+0x18,0x04,0x13,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,
+0x18,0x60,0x1f,0xe0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,
+0x78,0x00,0x78,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x08,0x0f,0x18,0x60,
+0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x0f,0xe0,0x07,0xe0,0x00,0x60,0x00,
+0x60,0x00,0x60,0x00,0x78,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x04,0x0f,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,0x1f,
+0xe0,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x03,0x10,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x19,0xc0,0x1f,
+0xe0,0x1c,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,
+0x18,0x30,0x18,0x30,0x04,0x0f,0x1f,0xf0,0x1f,0xf0,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x1f,0xf0,0x1f,0xf0,0x00,0x13,0x0c,0xc0,0x0f,0xc0,0x07,0x80,0x00,
+0x00,0x63,0x18,0x33,0x38,0x13,0x30,0x1b,0x20,0x1b,0x60,0x1b,0x60,0x0f,0xe0,
+0x0f,0xe0,0x1b,0x60,0x1b,0x60,0x13,0x30,0x33,0x30,0x33,0x10,0x63,0x18,0x63,
+0x18,0x03,0x10,0x0c,0x60,0x0c,0xc0,0x07,0xc0,0x00,0x00,0x00,0x00,0x63,0x18,
+0x33,0x18,0x1b,0x30,0x1b,0x20,0x0b,0x60,0x0f,0xe0,0x1b,0x60,0x1b,0x30,0x33,
+0x10,0x33,0x18,0x63,0x08,0x03,0x10,0x3f,0x00,0x1f,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x01,0xf0,0x00,0xf0,0x00,0x13,0x0c,0x60,0x0f,0xc0,
+0x07,0x80,0x00,0x00,0x03,0x80,0x03,0x80,0x02,0x80,0x06,0x80,0x06,0xc0,0x04,
+0xc0,0x0c,0x40,0x0c,0x60,0x08,0x60,0x1f,0xe0,0x18,0x30,0x10,0x30,0x30,0x10,
+0x30,0x18,0x20,0x18,0x02,0x11,0x04,0x20,0x04,0x30,0x06,0x60,0x03,0xe0,0x00,
+0x00,0x00,0x00,0x03,0xc0,0x0f,0xe0,0x08,0x30,0x00,0x30,0x01,0xf0,0x0f,0x30,
+0x1c,0x30,0x18,0x30,0x18,0x30,0x1f,0xf0,0x07,0x10,0x04,0x0f,0x01,0xfc,0x03,
+0xf8,0x03,0xc0,0x02,0xc0,0x06,0xc0,0x06,0xc0,0x0c,0xf0,0x0c,0xf8,0x0c,0xc0,
+0x1f,0xc0,0x1f,0xc0,0x10,0xc0,0x30,0xc0,0x30,0xf8,0x20,0xfc,0x08,0x0b,0x0e,
+0x70,0x1f,0x78,0x01,0x8c,0x01,0x8c,0x07,0xfc,0x1d,0xfc,0x31,0x80,0x31,0x80,
+0x31,0x80,0x3f,0xf8,0x1c,0x78,0x00,0x13,0x0c,0x60,0x07,0xc0,0x03,0x80,0x00,
+0x00,0x1f,0xf0,0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xc0,
+0x1f,0xe0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1f,0xe0,0x1f,
+0xf0,0x02,0x11,0x00,0x40,0x0c,0x60,0x0c,0xc0,0x07,0xc0,0x00,0x00,0x00,0x00,
+0x07,0xc0,0x0f,0xe0,0x18,0x60,0x30,0x30,0x30,0x30,0x3f,0xf0,0x30,0x00,0x30,
+0x00,0x18,0x00,0x0f,0xe0,0x07,0xc0,0x04,0x0f,0x07,0x80,0x0f,0xc0,0x00,0x60,
+0x00,0x20,0x00,0x30,0x00,0x30,0x00,0x30,0x3f,0xf0,0x3f,0xf0,0x30,0x30,0x30,
+0x30,0x10,0x20,0x18,0x60,0x0f,0xc0,0x07,0x80,0x08,0x0b,0x0f,0x80,0x1f,0xe0,
+0x00,0x60,0x00,0x30,0x1f,0xf0,0x3f,0xf0,0x30,0x30,0x30,0x30,0x18,0x60,0x1f,
+0xc0,0x07,0x80,0x01,0x12,0x07,0xe0,0x07,0xe0,0x00,0x00,0x18,0x10,0x18,0x30,
+0x18,0x30,0x18,0x70,0x18,0x50,0x18,0xd0,0x18,0x90,0x19,0x90,0x19,0x10,0x1b,
+0x10,0x1a,0x10,0x1e,0x10,0x1c,0x10,0x1c,0x10,0x18,0x10,0x04,0x0f,0x07,0xc0,
+0x07,0xc0,0x00,0x00,0x00,0x00,0x18,0x30,0x18,0x70,0x18,0xf0,0x18,0xb0,0x19,
+0xb0,0x19,0x30,0x1b,0x30,0x1a,0x30,0x1c,0x30,0x1c,0x30,0x18,0x30,0x01,0x12,
+0x0c,0xc0,0x0c,0xc0,0x00,0x00,0x07,0x80,0x0f,0xe0,0x18,0x30,0x18,0x30,0x30,
+0x10,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x10,0x18,0x30,
+0x18,0x30,0x0f,0xe0,0x07,0x80,0x03,0x10,0x0c,0xc0,0x0c,0xc0,0x00,0x00,0x00,
+0x00,0x00,0x00,0x07,0x80,0x0f,0xc0,0x18,0x60,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x18,0x60,0x1f,0xc0,0x07,0x80,0x04,0x0f,0x07,0x80,0x0f,
+0xe0,0x18,0x30,0x18,0x30,0x30,0x10,0x30,0x18,0x3f,0xf8,0x3f,0xf8,0x30,0x18,
+0x30,0x18,0x30,0x10,0x10,0x30,0x18,0x30,0x0f,0xe0,0x07,0x80,0x08,0x0b,0x07,
+0x80,0x1f,0xe0,0x18,0x60,0x30,0x30,0x3f,0xf0,0x3f,0xf0,0x30,0x30,0x30,0x30,
+0x18,0x60,0x1f,0xe0,0x07,0x80,0x01,0x12,0x07,0xe0,0x07,0xe0,0x00,0x00,0x10,
+0x18,0x18,0x18,0x18,0x10,0x0c,0x30,0x0c,0x30,0x06,0x20,0x06,0x60,0x02,0x60,
+0x03,0x40,0x03,0xc0,0x01,0x80,0x01,0x80,0x01,0x80,0x0f,0x00,0x0e,0x00,0x04,
+0x14,0x07,0xe0,0x07,0xe0,0x00,0x00,0x00,0x00,0x10,0x08,0x18,0x18,0x08,0x10,
+0x0c,0x30,0x0c,0x30,0x06,0x20,0x06,0x60,0x02,0x60,0x03,0x40,0x01,0xc0,0x01,
+0x80,0x01,0x80,0x01,0x80,0x03,0x00,0x1e,0x00,0x1c,0x00,0x00,0x13,0x03,0x60,
+0x02,0x40,0x04,0x40,0x00,0x00,0x30,0x10,0x10,0x30,0x18,0x30,0x18,0x20,0x0c,
+0x60,0x0c,0x60,0x04,0x40,0x06,0xc0,0x06,0x80,0x03,0x80,0x03,0x80,0x01,0x00,
+0x03,0x00,0x0e,0x00,0x0c,0x00,0x02,0x16,0x01,0x20,0x03,0x60,0x02,0x40,0x06,
+0x40,0x00,0x00,0x00,0x00,0x30,0x10,0x10,0x30,0x18,0x30,0x08,0x20,0x0c,0x60,
+0x0c,0x60,0x04,0x40,0x06,0xc0,0x02,0x80,0x03,0x80,0x03,0x80,0x01,0x00,0x03,
+0x00,0x02,0x00,0x1e,0x00,0x1c,0x00,0x0a,0x02,0x1f,0xf0,0x1f,0xf0,0x0c,0x02,
+0x1f,0xf0,0x1f,0xf0,0x0c,0x02,0x1f,0xf0,0x1f,0xf0,0x0c,0x02,0x7f,0xfc,0x7f,
+0xfc,0x0c,0x02,0x7f,0xfc,0x7f,0xfc,0x03,0x15,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,
+0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,
+0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,
+0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x15,0x03,0x3f,0xf0,0x3f,0xf0,0x3f,0xf0,0x04,
+0x07,0x01,0x00,0x03,0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x07,0x00,0x03,0x00,
+0x03,0x07,0x01,0x80,0x03,0xc0,0x03,0xc0,0x00,0xc0,0x00,0x80,0x01,0x80,0x03,
+0x00,0x10,0x07,0x01,0x80,0x03,0xc0,0x03,0xc0,0x00,0xc0,0x00,0x80,0x01,0x80,
+0x03,0x00,0x03,0x07,0x03,0x00,0x07,0x00,0x07,0x00,0x06,0x00,0x06,0x00,0x03,
+0x00,0x01,0x00,0x04,0x07,0x06,0x20,0x0c,0x60,0x18,0xc0,0x18,0xc0,0x1c,0xe0,
+0x1e,0xe0,0x0c,0x60,0x03,0x07,0x0c,0x60,0x1e,0xf0,0x1e,0x70,0x06,0x30,0x04,
+0x30,0x0c,0x60,0x18,0xc0,0x10,0x07,0x0c,0x60,0x1e,0xf0,0x1e,0x70,0x06,0x30,
+0x04,0x30,0x0c,0x60,0x18,0xc0,0x03,0x12,0x01,0x80,0x01,0x80,0x01,0x80,0x01,
+0x80,0x0f,0xf0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x03,
+0x12,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x0f,0xf0,0x01,0x80,0x01,0x80,
+0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x0f,0xe0,0x0f,0xf0,0x01,
+0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x0a,0x06,0x07,0x80,0x0f,0xc0,0x0f,0xc0,
+0x0f,0xc0,0x0f,0xc0,0x07,0x80,0x10,0x03,0x31,0x98,0x3b,0xb8,0x33,0x98,0x00,
+0x00,0x04,0x0f,0x1c,0x00,0x3e,0x00,0x22,0x00,0x22,0x00,0x22,0x18,0x1c,0xe0,
+0x03,0x80,0x0c,0x00,0x00,0x00,0x1c,0x70,0x3e,0xf8,0x22,0x88,0x22,0x88,0x3e,
+0xf8,0x1c,0x70,0x03,0x06,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x03,0x00,0x03,0x06,0x06,0x40,0x06,0x40,0x04,0x40,0x04,0xc0,0x04,0xc0,0x04,
+0x80,0x03,0x06,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x09,0x09,0x00,0x80,0x01,0x80,0x03,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x03,
+0x00,0x01,0x80,0x00,0x80,0x09,0x09,0x04,0x00,0x06,0x00,0x03,0x00,0x01,0x80,
+0x01,0x80,0x01,0x80,0x03,0x00,0x06,0x00,0x04,0x00,0x04,0x0f,0x0c,0x60,0x0c,
+0x60,0x0c,0x60,0x0c,0x60,0x0c,0x60,0x0c,0x60,0x0c,0x60,0x0c,0x60,0x0c,0x60,
+0x0c,0x60,0x00,0x00,0x00,0x00,0x1c,0xe0,0x1c,0xe0,0x1c,0xe0,0x04,0x0f,0x0f,
+0x80,0x1f,0xc0,0x00,0x60,0x06,0x60,0x06,0x60,0x06,0xc0,0x06,0x80,0x07,0x00,
+0x07,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x06,0x00,0x04,
+0x02,0x3f,0xf0,0x3f,0xf0,0x15,0x03,0x80,0x06,0x7f,0xfc,0x1f,0xe0,0x06,0x0c,
+0x00,0x18,0x00,0x30,0x00,0x60,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x0c,0x00,0x18,0x00,0x30,0x00,0x20,0x00,0x04,0x0f,0x1c,0x70,0x3e,0xf8,
+0x03,0x0c,0x03,0x0c,0x02,0x08,0x06,0x18,0x04,0x10,0x0c,0x30,0x08,0x20,0x08,
+0x20,0x00,0x00,0x00,0x00,0x1c,0x70,0x1c,0x70,0x1c,0x70,0x04,0x0f,0x1c,0x30,
+0x3e,0x30,0x03,0x30,0x03,0x30,0x02,0x30,0x06,0x30,0x04,0x30,0x0c,0x30,0x08,
+0x30,0x08,0x30,0x00,0x00,0x00,0x00,0x1c,0x70,0x1c,0x70,0x1c,0x70,0x04,0x0f,
+0x0c,0x70,0x0c,0xf8,0x0c,0x18,0x0c,0x18,0x0c,0x18,0x0c,0x10,0x0c,0x30,0x0c,
+0x20,0x0c,0x60,0x0c,0x60,0x00,0x00,0x00,0x00,0x1c,0x70,0x1c,0x70,0x1c,0x70,
+0x02,0x13,0x00,0xa0,0x01,0x20,0x01,0xe0,0x07,0xf0,0x0d,0x70,0x0d,0x40,0x19,
+0x40,0x19,0x40,0x19,0x40,0x19,0x40,0x1a,0x40,0x1a,0x40,0x1a,0x40,0x0e,0x80,
+0x0e,0x90,0x07,0xf0,0x03,0xe0,0x02,0x80,0x02,0x80,0x04,0x0f,0x0f,0xf0,0x0f,
+0xe0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0f,0xe0,0x0f,0xc0,
+0x0c,0x00,0x0c,0x00,0x3f,0x80,0x3f,0x80,0x0c,0x00,0x0c,0x00,0x04,0x0f,0x01,
+0xe0,0x07,0xf8,0x06,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x1f,0xe0,0x1f,0xe0,
+0x1f,0xe0,0x1f,0xe0,0x06,0x00,0x06,0x00,0x0c,0x00,0x0f,0xf8,0x1f,0xf8,0x04,
+0x0f,0x0c,0x60,0x0c,0x60,0x0e,0x60,0x0a,0x60,0x0a,0x60,0x0a,0x60,0x3f,0xf8,
+0x09,0x60,0x3f,0xf8,0x3f,0xf8,0x0c,0xe0,0x0c,0xe0,0x0c,0xe0,0x0c,0xe0,0x0c,
+0x60,0x04,0x0f,0x0f,0x80,0x0f,0xe0,0x0c,0x60,0x0c,0x20,0x3f,0xf8,0x3f,0xf8,
+0x0c,0x20,0x0c,0x60,0x0f,0xc0,0x0e,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x04,0x0f,0x10,0x10,0x11,0x90,0x13,0x90,0x1b,0x90,0x1b,0x90,
+0x1b,0xb0,0x1f,0xf8,0x3f,0xf8,0x0a,0xb0,0x0a,0xa0,0x0e,0xe0,0x0e,0xe0,0x0e,
+0xe0,0x0e,0x60,0x0c,0x60,0x04,0x0f,0x00,0x60,0x03,0xf0,0x03,0xf0,0x00,0x60,
+0x07,0x60,0x0f,0xe0,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x0f,0xe0,0x07,
+0x60,0x00,0x00,0x1f,0xe0,0x1f,0xe0,0x04,0x0f,0x01,0xe0,0x07,0xf0,0x0c,0x00,
+0x0c,0x00,0x08,0x00,0x1f,0xe0,0x3f,0xe0,0x18,0x00,0x3f,0xc0,0x3f,0xc0,0x18,
+0x00,0x0c,0x00,0x0c,0x10,0x07,0xf0,0x03,0xe0,0x04,0x0f,0x3f,0xf0,0x3f,0xf0,
+0x03,0x00,0x03,0x00,0x03,0x20,0x03,0xc0,0x03,0x00,0x0f,0x20,0x13,0xc0,0x03,
+0x00,0x0f,0x00,0x13,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x04,0x0f,0x0f,0x80,
+0x0f,0xe0,0x0c,0x60,0x0c,0x30,0x3f,0xfc,0x3f,0xfc,0x3f,0xfc,0x0c,0x60,0x0f,
+0xe0,0x0e,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x02,0x13,
+0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xe0,0x0e,0x30,0x0c,0x00,0x18,0x00,0x18,
+0x00,0x18,0x00,0x18,0xf0,0x18,0xf0,0x18,0x30,0x18,0x30,0x0c,0x30,0x0e,0x30,
+0x07,0xe0,0x01,0x80,0x01,0x80,0x01,0x80,0x04,0x0f,0x07,0x80,0x0f,0xc0,0x08,
+0x60,0x00,0x60,0x00,0x60,0x0f,0xf0,0x3f,0xf0,0x03,0x00,0x0f,0xf0,0x3f,0xf0,
+0x18,0x00,0x18,0x00,0x18,0x20,0x0f,0xe0,0x07,0xc0,0x02,0x12,0x00,0x80,0x00,
+0x80,0x03,0xe0,0x07,0xf0,0x0c,0x80,0x0c,0x80,0x18,0x80,0x18,0x80,0x18,0x80,
+0x18,0x80,0x18,0x80,0x18,0x80,0x08,0x80,0x0c,0x80,0x06,0xb0,0x03,0xe0,0x00,
+0x80,0x00,0x80,0x04,0x0f,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x3f,0xf0,0x3f,0xf0,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x06,0x0d,0x1f,0xf0,0x00,0xc0,0x00,0xc0,0x1f,0xf0,
+0x00,0x40,0x00,0xc0,0x1f,0x80,0x1e,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x00,
+0xc0,0x00,0x60,0x04,0x0f,0x0c,0x00,0x0c,0x00,0x0c,0xc0,0x0f,0x00,0x0e,0x00,
+0x3c,0x80,0x2f,0x00,0x0c,0x00,0x3c,0x30,0x2c,0x30,0x0c,0x30,0x0c,0x30,0x0c,
+0xe0,0x0f,0xc0,0x0f,0x00,0x04,0x0f,0x0f,0xe0,0x0f,0xf0,0x0c,0x18,0x0c,0x18,
+0x0c,0x18,0x0c,0x18,0x0c,0x38,0x3f,0xf0,0x3f,0xe0,0x0c,0x00,0x3f,0xf0,0x3f,
+0xf0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x05,0x0e,0x1e,0x00,0x30,0x08,0x20,0x10,
+0x20,0x20,0x20,0x40,0x32,0x00,0x1e,0x00,0x00,0x70,0x00,0xd8,0x0c,0x88,0x08,
+0x88,0x10,0x88,0x20,0xd8,0x00,0x70,0x04,0x0f,0x01,0xc0,0x03,0x60,0x06,0x20,
+0x06,0x20,0x06,0x60,0x06,0x60,0x06,0x40,0x06,0xc0,0x07,0x80,0x07,0x00,0x06,
+0x00,0x0e,0x00,0x06,0x00,0x03,0x20,0x03,0xe0,0x06,0x0d,0x31,0x80,0x31,0x38,
+0x39,0x24,0x39,0x64,0x29,0x64,0x29,0x2c,0x2d,0x38,0x25,0x00,0x25,0x3c,0x27,
+0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x05,0x0e,0x03,0x80,0x0c,0x60,0x10,0x10,
+0x10,0x10,0x23,0x88,0x22,0x48,0x22,0x48,0x22,0x48,0x23,0x88,0x22,0x08,0x12,
+0x10,0x12,0x10,0x08,0x20,0x07,0xc0,0x05,0x07,0x19,0x88,0x21,0x98,0x31,0x98,
+0x19,0x68,0x05,0x68,0x25,0x08,0x39,0x08,0x05,0x07,0x7d,0x98,0x11,0x98,0x11,
+0xd8,0x11,0x68,0x11,0x68,0x11,0x08,0x10,0x08,0x05,0x0e,0x07,0xc0,0x0f,0xe0,
+0x18,0x30,0x10,0x30,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x10,
+0x10,0x18,0x30,0x08,0x20,0x0c,0x60,0x3c,0x78,0x05,0x0f,0x07,0x80,0x08,0x40,
+0x10,0x20,0x30,0x30,0x30,0x30,0x70,0x38,0x70,0x38,0x7f,0xf8,0x70,0x00,0x70,
+0x00,0x30,0x00,0x30,0x00,0x10,0x20,0x08,0x40,0x03,0x00,0x09,0x0a,0x02,0x00,
+0x04,0x00,0x08,0x00,0x10,0x00,0x3f,0xf8,0x30,0x00,0x18,0x00,0x0c,0x00,0x06,
+0x00,0x03,0x00,0x08,0x0c,0x01,0x00,0x03,0x80,0x07,0xc0,0x09,0x60,0x19,0x30,
+0x31,0x18,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x08,
+0x0b,0x01,0x00,0x01,0x80,0x00,0xc0,0x00,0x60,0x00,0x30,0x3f,0xf8,0x00,0x30,
+0x00,0x20,0x00,0x40,0x00,0x80,0x01,0x00,0x08,0x0b,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x21,0x18,0x31,0x30,0x19,0x20,0x0f,0x40,0x07,0x80,
+0x03,0x00,0x09,0x09,0x08,0x00,0x18,0x20,0x10,0x30,0x20,0x18,0x7f,0xfc,0x60,
+0x18,0x30,0x10,0x18,0x30,0x08,0x60,0x07,0x0d,0x01,0x00,0x03,0x80,0x07,0xc0,
+0x19,0x60,0x11,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x19,0x30,0x0d,
+0x60,0x07,0x80,0x03,0x00,0x0a,0x08,0x1f,0xe0,0x1c,0x00,0x16,0x00,0x13,0x00,
+0x11,0x80,0x10,0xc0,0x10,0x60,0x10,0x20,0x0a,0x08,0x1f,0xe0,0x00,0xe0,0x01,
+0xe0,0x03,0xa0,0x07,0x20,0x0e,0x20,0x1c,0x20,0x18,0x20,0x0a,0x08,0x18,0x20,
+0x0c,0x20,0x06,0x20,0x03,0x20,0x01,0xa0,0x00,0xe0,0x00,0x60,0x1f,0xe0,0x0a,
+0x08,0x10,0x60,0x10,0xc0,0x11,0x80,0x13,0x00,0x16,0x00,0x1c,0x00,0x1c,0x00,
+0x1f,0xe0,0x08,0x0e,0x03,0x00,0x0f,0xc0,0x1b,0x60,0x13,0x20,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x13,0x20,0x0b,0x40,0x07,0x80,0x03,0x00,0x00,0x00,
+0x3f,0xf0,0x08,0x0b,0x03,0x00,0x06,0x00,0x0c,0x00,0x1f,0xf8,0x30,0x00,0x20,
+0x00,0x30,0x00,0x1f,0xf8,0x0c,0x00,0x06,0x00,0x03,0x00,0x08,0x0c,0x01,0x00,
+0x03,0x80,0x04,0xc0,0x0c,0x60,0x1c,0x70,0x34,0x58,0x04,0x40,0x04,0x40,0x04,
+0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x08,0x0b,0x01,0x00,0x01,0x80,0x00,0xc0,
+0x3f,0xe0,0x00,0x10,0x00,0x18,0x00,0x10,0x3f,0xe0,0x00,0xc0,0x01,0x80,0x01,
+0x00,0x08,0x0b,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x24,0x48,
+0x34,0x50,0x1c,0x60,0x0c,0x40,0x06,0x80,0x03,0x00,0x0c,0x02,0xff,0xfc,0xff,
+0xfc,0x0b,0x03,0xff,0xfc,0xff,0xfc,0xff,0xfc,0x00,0x18,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,
+0x18,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x0c,0x02,0x3b,0xb8,0x3b,0x98,0x0b,0x03,0x3b,0xb8,0x3b,
+0xb8,0x3b,0xb8,0x01,0x17,0x01,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x17,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x00,0x00,0x00,0x00,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x0c,0x02,0x36,0xd8,0x36,0xd8,
+0x0b,0x03,0x36,0xd8,0x36,0xd8,0x36,0xd8,0x01,0x17,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x00,0x00,0x01,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x17,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x00,0x00,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x00,0x00,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x00,0x00,0x00,0x00,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x0c,
+0x0c,0x03,0xfc,0x03,0xfc,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0b,0x0d,0x03,0xfc,0x03,
+0xfc,0x03,0xfc,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0c,0x0c,0x03,0xfc,0x03,0xfc,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x0b,0x0d,0x03,0xfc,0x03,0xfc,0x03,0xfc,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x0c,0x0c,0xff,0x00,0xff,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0b,0x0d,
+0xff,0x00,0xff,0x00,0xff,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0c,0x0c,0xff,0x80,
+0x7f,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x0b,0x0d,0xff,0x80,0xff,0x80,0xff,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x00,0x0e,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0xfc,0x01,0xfc,0x00,0x0e,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0xfc,0x03,0xfc,0x03,0xfc,0x00,0x0e,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0xfc,0x03,0xfc,0x00,0x0e,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0xfc,0x03,0xfc,0x03,0xfc,0x00,0x0e,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0xff,0x00,0xff,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,
+0x00,0xff,0x00,0xff,0x00,0x00,0x0e,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0xff,0x80,0x7f,0x80,0x00,0x0e,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0xff,
+0x80,0xff,0x80,0xff,0x80,0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0xfc,0x03,0xfc,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x18,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0xfc,0x03,0xfc,0x03,0xfc,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x00,0x18,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0xfc,0x03,0xfc,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x00,0x18,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x03,0xfc,0x03,0xfc,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x00,0x18,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0xfc,0x03,0xfc,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x00,0x18,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0xfc,0x03,0xfc,0x03,0xfc,
+0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x00,0x18,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,
+0xfc,0x03,0xfc,0x03,0xfc,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x00,0x18,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0xfc,0x03,0xfc,0x03,0xfc,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,0x00,0x7f,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,
+0x00,0xff,0x00,0xff,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x18,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0xff,0x80,0x7f,0x80,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x00,0x18,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xff,0x80,0x7f,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x00,0x18,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0xff,0x80,0x7f,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x00,0x18,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0xff,0x80,0xff,0x80,0xff,0x80,0x03,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x00,0x18,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xff,0x80,0xff,0x80,0xff,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x00,0x18,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0xff,
+0x80,0xff,0x80,0xff,0x80,0x07,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x0c,0x0c,0xff,0xfc,0xff,
+0xfc,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x0b,0x0d,0xff,0x00,0xff,0xfc,0xff,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x0b,0x0d,0x03,0xfc,0xff,0xfc,0x03,0xfc,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x0b,0x0d,0xff,0xfc,0xff,0xfc,0xff,0xfc,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x0c,0x0c,0xff,0xfc,0xff,0xfc,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,
+0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x0b,0x0d,0xff,0x80,
+0xff,0xfc,0xff,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x0b,0x0d,0x03,0xfc,0xff,0xfc,
+0x07,0xfc,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x0b,0x0d,0xff,0xfc,0xff,0xfc,0xff,0xfc,
+0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,
+0x80,0x07,0x80,0x07,0x80,0x00,0x0e,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0xff,0xfc,0xff,0xfc,0x00,0x0e,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,
+0x00,0xff,0xfc,0xff,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0xfc,0xff,0xfc,0x03,0xfc,0x00,0x0e,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,
+0xfc,0xff,0xfc,0xff,0xfc,0x00,0x0e,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,
+0x80,0xff,0xfc,0xff,0xfc,0x00,0x0e,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0xff,
+0x80,0xff,0xfc,0xff,0x80,0x00,0x0e,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0xfe,0x7f,0xfe,0x03,0xfe,0x00,0x0e,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0xff,
+0xfc,0xff,0xfc,0xff,0xfc,0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0xff,0xfc,0xff,0xfc,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x18,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0xff,0x00,0xff,0xfc,0xff,0xfc,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0xfc,0xff,0xfc,0x7f,0xfc,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,
+0xfc,0xff,0xfc,0xff,0xfc,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x18,0x07,0x80,0x07,
+0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+0x07,0x80,0x07,0x80,0x07,0x80,0xff,0xfc,0xff,0xfc,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,0xfc,0xff,0xfc,
+0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,
+0x80,0x07,0x80,0x07,0x80,0x00,0x18,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,
+0x80,0xff,0xfc,0xff,0xfc,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x00,0x18,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0xff,0x80,0xff,0xfc,0xff,0xfc,0x03,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x00,0x18,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0xfe,0x7f,0xfe,0x03,0xfe,
+0x01,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x00,0x18,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xff,
+0x80,0xff,0xfc,0xff,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x00,0x18,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x03,0xfc,0xff,0xfc,0x07,0xfc,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x00,0x18,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,
+0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0xff,0xfc,0xff,0xfc,0xff,0xfc,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,
+0xfc,0xff,0xfc,0xff,0xfc,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x00,0x18,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0xff,0x80,0xff,0xfc,0xff,0xfc,0x07,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x00,0x18,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0xfc,0xff,0xfc,0x7f,0xfc,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x00,0x18,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0xff,
+0xfc,0xff,0xfc,0xff,0xfc,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x0c,0x02,0x1c,0x70,0x1c,
+0x70,0x0b,0x03,0x1c,0x70,0x1c,0x70,0x1c,0x70,0x03,0x13,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x13,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x0a,
+0x05,0xff,0xfc,0xff,0xfc,0x00,0x00,0xff,0xfc,0xff,0xfc,0x00,0x18,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x0a,0x0e,0x01,0xfc,0x03,0xfc,0x03,0x00,0x03,0xfc,0x03,0xfc,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x0c,0x0c,0x07,0xfe,0x07,0xfc,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x0a,0x0e,0x07,
+0xfc,0x07,0xfe,0x06,0x00,0x06,0x7c,0x06,0xfe,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x0a,0x0e,0xff,
+0x00,0xff,0x00,0x03,0x00,0xff,0x00,0xff,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0c,0x0c,0xff,
+0xc0,0x7f,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x0a,0x0e,0x7f,0xc0,0xff,0xc0,0x00,
+0xc0,0x7c,0xc0,0xfe,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x00,0x0f,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0xfc,0x03,0xfc,0x03,0x00,0x03,0xfc,0x03,0xfc,0x00,0x0e,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x07,0xfe,0x07,0xfc,0x00,0x0f,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xfc,0x06,0xfe,0x06,0x00,0x07,0xfc,0x07,0xfe,0x00,0x0f,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0xff,0x00,0xff,0x00,0x03,0x00,0xff,0x00,0xff,0x00,0x00,
+0x0e,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0xff,0xc0,0x7f,0xc0,0x00,
+0x0f,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x7e,0xc0,0xfe,0xc0,0x00,0xc0,0x7f,0xc0,0xff,
+0xc0,0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0xfc,0x03,0xfc,0x03,0x00,0x03,
+0x00,0x03,0xfc,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x18,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xfe,0x06,0xfc,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x00,0x18,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xfe,0x06,0xfe,0x06,0x00,0x06,0x00,0x06,0xfe,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,0x00,0xff,0x00,0x03,0x00,0x03,
+0x00,0xff,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x18,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0xfe,0xc0,0x7e,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x00,0x18,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x7e,0xc0,0xfe,0xc0,0x00,0xc0,0x00,0xc0,0xfe,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x0a,0x0e,0xff,0xfc,0xff,0xfc,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x0c,0x0c,0xff,0xfc,0xff,0xfc,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,
+0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x0a,0x0e,0xff,
+0xfc,0xff,0xfc,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x04,0xc0,0x04,0xc0,0x04,0xc0,
+0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x00,0x0f,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0xff,0xfc,0xff,0xfc,0x00,
+0x0e,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,
+0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0xff,0xfc,0xff,0xfc,0x00,
+0x0f,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,
+0x04,0xc0,0x04,0xc0,0x04,0xc0,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xff,
+0xfc,0x00,0x18,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,0xfc,0xff,0xfc,0x03,0x00,0x03,
+0x00,0xff,0xfc,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x18,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,
+0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,
+0x04,0xc0,0xff,0xfc,0xff,0xfc,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,
+0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x00,0x18,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x7e,0xfc,0xfe,0xfe,0x00,0x00,0x7c,0x7c,0xfe,0xfe,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x0c,0x0c,0x00,0x1c,0x00,0x7c,0x00,0xe0,0x01,0x80,0x01,0x80,0x01,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0c,0x0c,0xe0,
+0x00,0xf8,0x00,0x0c,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x06,0x00,
+0x06,0x00,0x1c,0x00,0xf8,0x00,0xc0,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x80,
+0x00,0xc0,0x00,0xe0,0x00,0x3c,0x00,0x0c,0x00,0x18,0x00,0x04,0x00,0x0c,0x00,
+0x18,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0xc0,0x00,0xc0,
+0x01,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x06,0x00,0x06,0x00,0x0c,0x00,0x0c,
+0x00,0x18,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0x00,0x18,
+0x40,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x0c,
+0x00,0x0c,0x00,0x06,0x00,0x06,0x00,0x03,0x00,0x03,0x00,0x01,0x80,0x01,0x80,
+0x00,0xc0,0x00,0xc0,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x18,0x00,
+0x18,0x00,0x0c,0x00,0x18,0x40,0x0c,0x60,0x0c,0x60,0x18,0x30,0x18,0x30,0x30,
+0x18,0x30,0x18,0x60,0x0c,0x60,0x0c,0xc0,0x06,0xc0,0x07,0x80,0x03,0x80,0x03,
+0x00,0x03,0x80,0x07,0x80,0x06,0xc0,0x0c,0xc0,0x0c,0x60,0x18,0x60,0x18,0x30,
+0x30,0x30,0x30,0x18,0x60,0x18,0x60,0x0c,0x0c,0x02,0xff,0x00,0xff,0x00,0x00,
+0x0e,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x0c,
+0x02,0x03,0xfc,0x03,0xfc,0x0c,0x0c,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x0b,0x03,0xff,0x00,0xff,0x00,0xff,0x00,0x00,0x0e,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x0b,0x03,0x03,0xfc,0x03,0xfc,
+0x03,0xfc,0x0c,0x0c,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x0b,0x03,
+0x03,0xfc,0xff,0xfc,0x03,0xfc,0x00,0x18,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x0b,0x03,0xff,0x00,
+0xff,0xfc,0xff,0x00,0x00,0x18,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,
+0x03,0x80,0x03,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x05,0x0e,0x3f,0xf0,0x38,0x70,
+0x38,0x70,0x2c,0xd0,0x24,0x90,0x27,0x90,0x23,0x10,0x23,0x10,0x27,0x90,0x24,
+0x90,0x2c,0xd0,0x38,0x70,0x38,0x70,0x3f,0xf0,
+};
@@ -0,0 +1,409 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Streams the frames to one debugging client on a local socket, such as
+ * streamcat.c.  gr_flip() copies what it drew into a frame kept here and
+ * marks the 16x16 tiles it touched; a sender thread hashes those tiles,
+ * and sends the ones that really changed, deflated.  The render path
+ * never waits: while the sender is taking tiles, the flip leaves its
+ * damage for the next one, and a slow client simply misses the frames
+ * drawn while it was being sent the last.
+ *
+ * Everything is in the device's byte order.  On connecting the client
+ * gets "GRST" and the width, height and pixel format as 32-bit words.
+ * Each update is "GRFR", the frame number, the tile count, the size of
+ * the tiles and the size they were deflated to, as 32-bit words, then
+ * the deflated tiles.  A tile is its left and top edge as 16-bit words
+ * and its rows, packed: up to 16 pixels of up to 16 rows, fewer at the
+ * right and bottom edges.  The first update has every tile. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <sys/un.h>
+
+#include <zlib.h>
+
+#include "graphics.h"
+
+#define GR_TILE 16
+
+static pthread_t gr_stream_thread;
+static pthread_mutex_t gr_stream_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gr_stream_ready = PTHREAD_COND_INITIALIZER;
+static int gr_stream_listen = -1;
+static int gr_stream_client = -1;
+static int gr_stream_stop = 0;
+
+/* The latest frame and its tiles changed since the sender last took
+ * them, under gr_stream_lock; the rest belongs to the sender thread. */
+static unsigned char *gr_stream_pixels = NULL;
+static unsigned char *gr_stream_dirty = NULL;
+static unsigned gr_stream_seq = 0;
+static int gr_stream_width, gr_stream_height, gr_stream_format;
+static int gr_stream_tiles_x, gr_stream_tiles_y;
+
+static unsigned *gr_stream_hash = NULL;
+static unsigned char *gr_stream_raw = NULL;
+static unsigned char *gr_stream_zip = NULL;
+static size_t gr_stream_raw_size, gr_stream_zip_size;
+
+static inline int stream_line(void)
+{
+    return gr_stream_width * gr_bytes_per_pixel(gr_stream_format);
+}
+
+static int send_full(int fd, const void *buf, size_t len)
+{
+    const unsigned char *p = buf;
+    ssize_t n;
+
+    while (len > 0) {
+        n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static void mark_all(void)
+{
+    memset(gr_stream_dirty, 1, gr_stream_tiles_x * gr_stream_tiles_y);
+}
+
+/* Moves the dirty tiles into gr_stream_raw with their positions, and
+ * returns how many there are.  Called with gr_stream_lock held, so it
+ * only copies. */
+static unsigned take_tiles(size_t *size)
+{
+    int bpp = gr_bytes_per_pixel(gr_stream_format), line = stream_line();
+    unsigned char *out = gr_stream_raw;
+    unsigned count = 0;
+    int tx, ty, y;
+
+    for (ty = 0; ty < gr_stream_tiles_y; ty++) {
+        for (tx = 0; tx < gr_stream_tiles_x; tx++) {
+            int x0 = tx * GR_TILE, y0 = ty * GR_TILE, w, h;
+            const unsigned char *src;
+            unsigned char *dirty = &gr_stream_dirty[ty * gr_stream_tiles_x + tx];
+
+            if (!*dirty) continue;
+            *dirty = 0;
+            w = gr_stream_width - x0 < GR_TILE ? gr_stream_width - x0 : GR_TILE;
+            h = gr_stream_height - y0 < GR_TILE ? gr_stream_height - y0 : GR_TILE;
+
+            ((unsigned short *) out)[0] = x0;
+            ((unsigned short *) out)[1] = y0;
+            out += 4;
+            src = gr_stream_pixels + y0 * line + x0 * bpp;
+            for (y = 0; y < h; y++, src += line, out += w * bpp) {
+                memcpy(out, src, w * bpp);
+            }
+            count++;
+        }
+    }
+    *size = out - gr_stream_raw;
+    return count;
+}
+
+static unsigned tile_hash(const unsigned char *p, size_t len)
+{
+    unsigned hash = 2166136261u;
+    size_t i;
+
+    for (i = 0; i + 4 <= len; i += 4) {
+        hash = (hash ^ *(const unsigned *) (p + i)) * 16777619u;
+    }
+    for (; i < len; i++) hash = (hash ^ p[i]) * 16777619u;
+    return hash;
+}
+
+/* Drops the tiles of gr_stream_raw whose hash has not changed since they
+ * were last sent, unless all are to be sent. */
+static unsigned drop_unchanged(unsigned count, size_t *size, int all)
+{
+    int bpp = gr_bytes_per_pixel(gr_stream_format);
+    unsigned char *in = gr_stream_raw, *out = gr_stream_raw;
+    unsigned kept = 0, n;
+
+    for (n = 0; n < count; n++) {
+        int x0 = ((unsigned short *) in)[0], y0 = ((unsigned short *) in)[1];
+        int w = gr_stream_width - x0 < GR_TILE ? gr_stream_width - x0 : GR_TILE;
+        int h = gr_stream_height - y0 < GR_TILE ? gr_stream_height - y0 : GR_TILE;
+        size_t len = 4 + w * h * bpp;
+        unsigned *known = &gr_stream_hash[(y0 / GR_TILE) * gr_stream_tiles_x +
+                                          x0 / GR_TILE];
+        unsigned hash = tile_hash(in + 4, len - 4);
+
+        if (all || hash != *known) {
+            *known = hash;
+            memmove(out, in, len);
+            out += len;
+            kept++;
+        }
+        in += len;
+    }
+    *size = out - gr_stream_raw;
+    return kept;
+}
+
+static int accept_client(void)
+{
+    unsigned hello[4];
+    int fd;
+
+    do {
+        fd = accept(gr_stream_listen, NULL, NULL);
+    } while (fd < 0 && (errno == EINTR || errno == ECONNABORTED) &&
+             !gr_stream_stop);
+    if (fd < 0) return -1;
+
+    memcpy(&hello[0], "GRST", 4);
+    hello[1] = gr_stream_width;
+    hello[2] = gr_stream_height;
+    hello[3] = gr_stream_format;
+    if (send_full(fd, hello, sizeof(hello)) < 0) {
+        close(fd);
+        return 0;
+    }
+
+    pthread_mutex_lock(&gr_stream_lock);
+    gr_stream_client = fd;
+    mark_all();
+    pthread_mutex_unlock(&gr_stream_lock);
+    return 0;
+}
+
+static void *stream_thread(void *cookie)
+{
+    unsigned seen = 0, first = 1;
+
+    /* only idle time goes to the stream */
+    setpriority(PRIO_PROCESS, syscall(__NR_gettid), 19);
+
+    for (;;) {
+        unsigned header[5], count, seq;
+        size_t size;
+        uLongf zsize;
+
+        if (gr_stream_client < 0) {
+            if (accept_client() < 0) break;
+            first = 1;
+            continue;
+        }
+
+        /* take whatever changed, skipping the frames drawn meanwhile */
+        pthread_mutex_lock(&gr_stream_lock);
+        while (!gr_stream_stop && gr_stream_seq == seen && !first) {
+            pthread_cond_wait(&gr_stream_ready, &gr_stream_lock);
+        }
+        if (gr_stream_stop) {
+            pthread_mutex_unlock(&gr_stream_lock);
+            break;
+        }
+        seen = seq = gr_stream_seq;
+        count = take_tiles(&size);
+        pthread_mutex_unlock(&gr_stream_lock);
+
+        count = drop_unchanged(count, &size, first);
+        if (count == 0) continue;
+        first = 0;
+
+        zsize = gr_stream_zip_size;
+        if (compress2(gr_stream_zip, &zsize, gr_stream_raw, size,
+                      Z_BEST_SPEED) != Z_OK) {
+            fprintf(stderr, "stream: cannot deflate frame %u\n", seq);
+            continue;
+        }
+        memcpy(&header[0], "GRFR", 4);
+        header[1] = seq;
+        header[2] = count;
+        header[3] = size;
+        header[4] = zsize;
+        if (send_full(gr_stream_client, header, sizeof(header)) < 0 ||
+            send_full(gr_stream_client, gr_stream_zip, zsize) < 0) {
+            /* gone: the next client starts from a full frame */
+            pthread_mutex_lock(&gr_stream_lock);
+            close(gr_stream_client);
+            gr_stream_client = -1;
+            pthread_mutex_unlock(&gr_stream_lock);
+        }
+    }
+    return NULL;
+}
+
+/* "unix:PATH", or "tcp:PORT" on the loopback interface only */
+static int open_listener(const char *address)
+{
+    int fd, on = 1;
+
+    if (strncmp(address, "unix:", 5) == 0) {
+        struct sockaddr_un sun;
+
+        if (strlen(address + 5) >= sizeof(sun.sun_path)) return -1;
+        memset(&sun, 0, sizeof(sun));
+        sun.sun_family = AF_UNIX;
+        strcpy(sun.sun_path, address + 5);
+        unlink(sun.sun_path);
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        if (bind(fd, (struct sockaddr *) &sun, sizeof(sun)) < 0) {
+            close(fd);
+            return -1;
+        }
+    } else if (strncmp(address, "tcp:", 4) == 0) {
+        struct sockaddr_in sin;
+
+        memset(&sin, 0, sizeof(sin));
+        sin.sin_family = AF_INET;
+        sin.sin_port = htons(atoi(address + 4));
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        if (bind(fd, (struct sockaddr *) &sin, sizeof(sin)) < 0) {
+            close(fd);
+            return -1;
+        }
+    } else {
+        errno = EINVAL;
+        return -1;
+    }
+    if (listen(fd, 1) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int gr_stream_open(const char *address, int width, int height, int format)
+{
+    size_t size = (size_t) height * width * gr_bytes_per_pixel(format);
+    int tiles;
+
+    gr_stream_width = width;
+    gr_stream_height = height;
+    gr_stream_format = format;
+    gr_stream_tiles_x = (width + GR_TILE - 1) / GR_TILE;
+    gr_stream_tiles_y = (height + GR_TILE - 1) / GR_TILE;
+    tiles = gr_stream_tiles_x * gr_stream_tiles_y;
+
+    /* every tile, with its position, and that deflated at worst */
+    gr_stream_raw_size = size + tiles * 4;
+    gr_stream_zip_size = compressBound(gr_stream_raw_size);
+    gr_stream_pixels = calloc(size, 1);
+    gr_stream_dirty = malloc(tiles);
+    gr_stream_hash = malloc(tiles * sizeof(*gr_stream_hash));
+    gr_stream_raw = malloc(gr_stream_raw_size);
+    gr_stream_zip = malloc(gr_stream_zip_size);
+    if (gr_stream_pixels == NULL || gr_stream_dirty == NULL ||
+        gr_stream_hash == NULL || gr_stream_raw == NULL ||
+        gr_stream_zip == NULL) {
+        fprintf(stderr, "stream: out of memory\n");
+        gr_stream_close();
+        return -1;
+    }
+    mark_all();
+
+    gr_stream_listen = open_listener(address);
+    if (gr_stream_listen < 0) {
+        fprintf(stderr, "stream: cannot listen on %s: %s\n", address,
+                strerror(errno));
+        gr_stream_close();
+        return -1;
+    }
+    gr_stream_stop = 0;
+    if (pthread_create(&gr_stream_thread, NULL, stream_thread, NULL) != 0) {
+        close(gr_stream_listen);
+        gr_stream_listen = -1;
+        gr_stream_close();
+        return -1;
+    }
+    fprintf(stderr, "stream: listening on %s\n", address);
+    return 0;
+}
+
+int gr_stream_update(const GGLSurface *frame, const GRRect *rects,
+                     unsigned count)
+{
+    int bpp = gr_bytes_per_pixel(frame->format), line = stream_line();
+    unsigned i;
+
+    if (pthread_mutex_trylock(&gr_stream_lock) != 0) return -1;
+
+    for (i = 0; i < count; i++) {
+        const GRRect *r = &rects[i];
+        const unsigned char *src = frame->data +
+                (r->y0 * frame->stride + r->x0) * bpp;
+        unsigned char *dst = gr_stream_pixels + r->y0 * line + r->x0 * bpp;
+        int y, tx, ty;
+
+        for (y = r->y0; y < r->y1; y++) {
+            memcpy(dst, src, (r->x1 - r->x0) * bpp);
+            src += frame->stride * bpp;
+            dst += line;
+        }
+        for (ty = r->y0 / GR_TILE; ty <= (r->y1 - 1) / GR_TILE; ty++) {
+            for (tx = r->x0 / GR_TILE; tx <= (r->x1 - 1) / GR_TILE; tx++) {
+                gr_stream_dirty[ty * gr_stream_tiles_x + tx] = 1;
+            }
+        }
+    }
+    gr_stream_seq++;
+    pthread_cond_signal(&gr_stream_ready);
+    pthread_mutex_unlock(&gr_stream_lock);
+    return 0;
+}
+
+void gr_stream_close(void)
+{
+    if (gr_stream_listen >= 0) {
+        pthread_mutex_lock(&gr_stream_lock);
+        gr_stream_stop = 1;
+        pthread_cond_signal(&gr_stream_ready);
+        /* wakes the sender from accept() or send() */
+        shutdown(gr_stream_listen, SHUT_RDWR);
+        if (gr_stream_client >= 0) shutdown(gr_stream_client, SHUT_RDWR);
+        pthread_mutex_unlock(&gr_stream_lock);
+        pthread_join(gr_stream_thread, NULL);
+
+        close(gr_stream_listen);
+        gr_stream_listen = -1;
+        if (gr_stream_client >= 0) close(gr_stream_client);
+        gr_stream_client = -1;
+    }
+    free(gr_stream_pixels);
+    free(gr_stream_dirty);
+    free(gr_stream_hash);
+    free(gr_stream_raw);
+    free(gr_stream_zip);
+    gr_stream_pixels = gr_stream_dirty = NULL;
+    gr_stream_hash = NULL;
+    gr_stream_raw = gr_stream_zip = NULL;
+}
@@ -0,0 +1,166 @@
+/*
+ * Watches the frames a bootmenu streams (see stream.c).
+ *
+ *   streamcat unix:PATH|tcp:PORT [OUT.ppm]
+ *
+ * Prints a line for each update: the frame number, the tiles it changed
+ * and the bytes it took.  With OUT.ppm, the whole frame is written there
+ * after each update.  For a device, forward the port first, for example
+ * "adb forward tcp:5900 tcp:5900" with stream=tcp:5900 in bootmenu.prop.
+ * Build it on the host with the device's byte order: cc streamcat.c -lz
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <zlib.h>
+
+/* pixel formats of the device's framebuffer */
+#define RGBX_8888  2
+#define RGB_565    4
+#define BGRA_8888  5
+#define ARGB_8888  0x42
+
+static int read_full(int fd, void *buf, size_t len)
+{
+    unsigned char *p = buf;
+    ssize_t n;
+
+    while (len > 0) {
+        n = read(fd, p, len);
+        if (n <= 0) return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int connect_to(const char *address)
+{
+    int fd;
+
+    if (strncmp(address, "unix:", 5) == 0) {
+        struct sockaddr_un sun;
+        memset(&sun, 0, sizeof(sun));
+        sun.sun_family = AF_UNIX;
+        strncpy(sun.sun_path, address + 5, sizeof(sun.sun_path) - 1);
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && connect(fd, (struct sockaddr *) &sun, sizeof(sun)) == 0)
+            return fd;
+    } else if (strncmp(address, "tcp:", 4) == 0) {
+        struct sockaddr_in sin;
+        memset(&sin, 0, sizeof(sin));
+        sin.sin_family = AF_INET;
+        sin.sin_port = htons(atoi(address + 4));
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd >= 0 && connect(fd, (struct sockaddr *) &sin, sizeof(sin)) == 0)
+            return fd;
+    } else {
+        return -1;
+    }
+    if (fd >= 0) close(fd);
+    return -1;
+}
+
+static void write_ppm(const char *path, const unsigned char *frame,
+                      unsigned width, unsigned height, unsigned format)
+{
+    FILE *f = fopen(path, "wb");
+    unsigned bpp = format == RGB_565 ? 2 : 4, n;
+
+    if (f == NULL) {
+        perror(path);
+        return;
+    }
+    fprintf(f, "P6\n%u %u\n255\n", width, height);
+    for (n = 0; n < width * height; n++) {
+        const unsigned char *p = frame + n * bpp;
+        unsigned char rgb[3];
+        if (format == RGB_565) {
+            unsigned v = p[0] | p[1] << 8;
+            rgb[0] = (v >> 11) << 3;
+            rgb[1] = ((v >> 5) & 0x3f) << 2;
+            rgb[2] = (v & 0x1f) << 3;
+        } else if (format == BGRA_8888) {
+            rgb[0] = p[2]; rgb[1] = p[1]; rgb[2] = p[0];
+        } else if (format == ARGB_8888) {
+            rgb[0] = p[1]; rgb[1] = p[2]; rgb[2] = p[3];
+        } else {
+            rgb[0] = p[0]; rgb[1] = p[1]; rgb[2] = p[2];
+        }
+        fwrite(rgb, 3, 1, f);
+    }
+    fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned hello[4], header[5], width, height, format, bpp, n;
+    unsigned char *frame, *raw = NULL, *zip = NULL;
+    size_t raw_size = 0, zip_size = 0;
+    int fd;
+
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: streamcat unix:PATH|tcp:PORT [OUT.ppm]\n");
+        return 1;
+    }
+    fd = connect_to(argv[1]);
+    if (fd < 0) {
+        fprintf(stderr, "streamcat: cannot connect to %s\n", argv[1]);
+        return 1;
+    }
+    if (read_full(fd, hello, sizeof(hello)) < 0 ||
+        memcmp(&hello[0], "GRST", 4) != 0) {
+        fprintf(stderr, "streamcat: not a frame stream\n");
+        return 1;
+    }
+    width = hello[1];
+    height = hello[2];
+    format = hello[3];
+    bpp = format == RGB_565 ? 2 : 4;
+    frame = calloc(width * height, bpp);
+    printf("%ux%u format %u\n", width, height, format);
+
+    while (read_full(fd, header, sizeof(header)) == 0) {
+        unsigned char *p;
+        uLongf size;
+
+        if (memcmp(&header[0], "GRFR", 4) != 0) {
+            fprintf(stderr, "streamcat: lost sync\n");
+            return 1;
+        }
+        if (header[3] > raw_size) raw = realloc(raw, raw_size = header[3]);
+        if (header[4] > zip_size) zip = realloc(zip, zip_size = header[4]);
+        size = header[3];
+        if (read_full(fd, zip, header[4]) < 0 ||
+            uncompress(raw, &size, zip, header[4]) != Z_OK ||
+            size != header[3]) {
+            fprintf(stderr, "streamcat: bad frame %u\n", header[1]);
+            return 1;
+        }
+
+        for (p = raw, n = 0; n < header[2]; n++) {
+            unsigned x0 = ((unsigned short *) p)[0];
+            unsigned y0 = ((unsigned short *) p)[1];
+            unsigned w = width - x0 < 16 ? width - x0 : 16;
+            unsigned h = height - y0 < 16 ? height - y0 : 16, y;
+            p += 4;
+            for (y = 0; y < h; y++, p += w * bpp) {
+                memcpy(frame + ((y0 + y) * width + x0) * bpp, p, w * bpp);
+            }
+        }
+        printf("frame %u: %u tiles, %u bytes deflated to %u\n",
+               header[1], header[2], header[3], header[4]);
+        fflush(stdout);
+        if (argc == 3) write_ppm(argv[2], frame, width, height, format);
+    }
+    return 0;
+}
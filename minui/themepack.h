@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2007 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _MINUI_THEMEPACK_H_
+#define _MINUI_THEMEPACK_H_
+
+// A theme pack holds every image of a theme in one file, already
+// decoded: a ThemePackHeader, then count ThemePackEntry records sorted
+// by name, then the pixels of each entry at its offset.  The pixels are
+// packed rows in the entry's format, stored as they are or as one LZ4
+// block.  All fields are in the device's byte order.  mkthemepack.c
+// writes packs on the host; pack.c reads them.
+
+#define THEME_PACK_MAGIC    "GRTP"
+#define THEME_PACK_VERSION  1
+#define THEME_PACK_NAME     48      // image name with no ".png", NUL-padded
+
+// Entry formats: the GGL_PIXEL_FORMAT_* and GR_PIXEL_FORMAT_* values.
+// RGBX_8888 and RGBA_8888 are converted for the screen as they load,
+// like a decoded PNG; the others are used only on a screen that draws
+// them as they are.
+#define THEME_PACK_RGBA_8888      1     // straight alpha
+#define THEME_PACK_RGBX_8888      2
+#define THEME_PACK_RGB_565        4
+#define THEME_PACK_BGRA_8888      5
+#define THEME_PACK_RGBA_8888_PRE  0x40
+#define THEME_PACK_BGRA_8888_PRE  0x41
+#define THEME_PACK_ARGB_8888      0x42
+
+#define THEME_PACK_RAW  0
+#define THEME_PACK_LZ4  1
+
+typedef struct {
+    char magic[4];
+    unsigned version;
+    unsigned count;
+} ThemePackHeader;
+
+typedef struct {
+    char name[THEME_PACK_NAME];
+    unsigned width;
+    unsigned height;
+    unsigned format;
+    unsigned compression;
+    unsigned offset;        // from the start of the file
+    unsigned size;          // stored bytes
+} ThemePackEntry;
+
+#endif